@@ -0,0 +1,261 @@
+# R310_clipBank.py - R310 로봇 눈 바이너리 클립 뱅크 생성/확인 도구
+#
+# 펌웨어의 내장 시퀀스(g_R310_frameSeq_*) 또는 JSON 으로 적은 클립을 R310_clip_001.h 의 뱅크 형식으로 변환합니다.
+# 만든 뱅크는 LittleFS(data/r310_clips.bin, PlatformIO uploadfs) 또는 전용 데이터 파티션(r310clips)에 올리고,
+# 시리얼 명령 "clipload" 로 다시 마운트하면 펌웨어를 다시 빌드하지 않고 감정 시퀀스를 바꿀 수 있습니다.
+#
+# 사용법:
+#   python shared/R310_clipBank.py convert [-o 출력.bin] [--only EMT_SMILE,EMT_BLINK]
+#       R310_data2_014.h 의 감정 시퀀스 목록(g_R310_ani_Tables_arr)을 그대로 뱅크로 변환 (수정용 출발점)
+#   python shared/R310_clipBank.py build 클립.json [-o 출력.bin] [--with-builtin]
+#       JSON 클립 (글리프/변환/감정 이름은 펌웨어 헤더의 이름 그대로, 시간은 "G_R310_FRAME_TIME * 2" 같은 식도 가능)
+#   python shared/R310_clipBank.py dump 뱅크.bin
+#
+# JSON 형식:
+#   {"clips": [{"name": "wow", "emotion": "EMT_NONE", "crossfade": false,
+#               "frames": [[["EYE_NEUTRAL", "EYE_NEUTRAL"], "G_R310_FRAME_TIME"],
+#                          [["EYE_LOOK_LEFT_2", "EYE_LOOK_LEFT_2"], 500, ["G_R310_TF_SHIFT(1, 0)", 0]]]}]}
+#   emotion 이 EMT_NONE 이면 "clip wow" 로만 재생하고, 그 외에는 해당 감정의 내장 시퀀스를 대체합니다.
+#
+# 감정/글리프 번호는 펌웨어 헤더에서 읽으므로, 헤더의 열거형 순서를 바꾸면 뱅크를 다시 만들어야 합니다.
+
+import json
+import os
+import re
+import struct
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+R310_DIR = os.path.join(ROOT, "src", "R310_RobotEyes_T31_008")
+DATA_HEADER = os.path.join(R310_DIR, "R310_data2_014.h")
+CONFIG_HEADER = os.path.join(R310_DIR, "R310_config_009.h")
+FONT_HEADER = os.path.join(R310_DIR, "R310_fontGen_001.h")
+DEFAULT_OUTPUT = os.path.join(ROOT, "data", "r310_clips.bin")
+
+# R310_clip_001.h 와 같은 값/배치
+CLIP_MAGIC = 0x42433352         # "R3CB"
+CLIP_VERSION = 1
+CLIP_MAX = 16
+CLIP_NAME_LEN = 8
+CLIP_FLAG_CROSSFADE = 0x01
+HEADER_FMT = "<IBBHI"           # magic, version, clipCount, crc16, totalSize (12바이트)
+INDEX_FMT = "<8sBBBBI"          # name, emotionIdx, flags, frameCount, reserved, frameOffset (16바이트)
+FRAME_FMT = "<BBHBB"            # eyeData[2], timeFrame, eyeTransform[2] (6바이트, T_R310_ani_Frame_t)
+FONT_2BPP_FLAG = 0x80
+
+
+# ---------------------------------------------------------------------------------------------
+# 펌웨어 헤더 읽기
+# ---------------------------------------------------------------------------------------------
+
+def strip_comments(text):
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+    return re.sub(r"//[^\n]*", "", text)
+
+
+def split_top(text, sep=","):
+    """중괄호/괄호 바깥의 구분자로 나눕니다."""
+    parts, depth, cur = [], 0, ""
+    for ch in text:
+        if ch in "{(":
+            depth += 1
+        elif ch in "})":
+            depth -= 1
+        if ch == sep and depth == 0:
+            parts.append(cur.strip())
+            cur = ""
+        else:
+            cur += ch
+    if cur.strip():
+        parts.append(cur.strip())
+    return parts
+
+
+def unbrace(text):
+    text = text.strip()
+    if not (text.startswith("{") and text.endswith("}")):
+        raise ValueError(f"중괄호 초기화가 아닙니다: {text}")
+    return text[1:-1]
+
+
+class Symbols:
+    """펌웨어 헤더의 열거형/매크로 값을 모아 C 식을 계산합니다."""
+
+    def __init__(self):
+        self.values = {"G_R310_FONT_2BPP_FLAG": FONT_2BPP_FLAG}
+        self.enums = {}
+        self.font_len = None
+        self.font2bpp_len = 0
+
+        config = strip_comments(read(CONFIG_HEADER))
+        m = re.search(r"#define\s+G_R310_FRAME_TIME\s+(\d+)", config)
+        self.values["G_R310_FRAME_TIME"] = int(m.group(1))
+
+        data = strip_comments(read(DATA_HEADER))
+        for m in re.finditer(r"#define\s+(G_R310_TF_(?:NONE|MIRROR_H|MIRROR_V|INVERT|ROT180))\s+(.+)", data):
+            self.values[m.group(1)] = self.eval(m.group(2))
+        for m in re.finditer(r"typedef\s+enum\s*\{(.*?)\}\s*(\w+)\s*;", data, flags=re.S):
+            self.enums[m.group(2)] = self.parse_enum(m.group(1))
+        self.font2bpp_len = len(self.enums["T_R310_EyeFont2bppIndex_t"])
+
+        font = strip_comments(read(FONT_HEADER))
+        self.font_len = int(re.search(r"G_R310_ROBOT_EYES_FONT_LEN\s*=\s*(\d+)", font).group(1))
+
+    def parse_enum(self, body):
+        names, value = [], -1
+        for item in split_top(body):
+            name, _, expr = item.partition("=")
+            value = self.eval(expr) if expr.strip() else value + 1
+            self.values[name.strip()] = value
+            names.append(name.strip())
+        return names
+
+    def eval(self, expr):
+        if isinstance(expr, int):
+            return expr
+        py = re.sub(r"\(\s*uint8_t\s*\)", "", str(expr)).replace("/", "//")
+        env = dict(self.values)
+        env["G_R310_TF_SHIFT"] = lambda dx, dy: ((dx & 0x03) << 3) | ((dy & 0x03) << 5)
+        return int(eval(py, {"__builtins__": {}}, env))
+
+    def glyph_ok(self, idx):
+        if idx & FONT_2BPP_FLAG:
+            return (idx & ~FONT_2BPP_FLAG) < self.font2bpp_len
+        return idx < self.font_len
+
+
+def read(path):
+    with open(path, encoding="utf-8") as f:
+        return f.read()
+
+
+def parse_frame(sym, text):
+    fields = split_top(unbrace(text))
+    eyes = [sym.eval(e) for e in split_top(unbrace(fields[0]))]
+    time_frame = sym.eval(fields[1])
+    tf = [sym.eval(t) for t in split_top(unbrace(fields[2]))] if len(fields) > 2 else [0, 0]
+    return (eyes[0], eyes[1], time_frame, tf[0], tf[1])
+
+
+def builtin_clips(sym):
+    """g_R310_ani_Tables_arr 의 감정 시퀀스를 클립 목록으로 변환합니다."""
+    data = strip_comments(read(DATA_HEADER))
+    seqs = {}
+    for m in re.finditer(r"T_R310_ani_Frame_t\s+(g_R310_frameSeq_\w+)\[\]\s*PROGMEM\s*=\s*\{(.*?)\n\};", data, flags=re.S):
+        seqs[m.group(1)] = [parse_frame(sym, f) for f in split_top(m.group(2))]
+
+    table = re.search(r"g_R310_ani_Tables_arr\[\]\s*=\s*\{(.*?)\n\};", data, flags=re.S).group(1)
+    clips = []
+    for entry in split_top(table):
+        emotion, seq, count, blend = split_top(unbrace(entry))
+        size = re.match(r"G_R310_ARRAY_SIZE\((\w+)\)", count)
+        count = len(seqs[size.group(1)]) if size else sym.eval(count)
+        name = emotion.replace("EMT_", "").replace("_", "").lower()[:CLIP_NAME_LEN]
+        clips.append({"name": name, "emotion": emotion, "crossfade": blend == "EMTP_BLEND_CROSSFADE",
+                      "frames": seqs[seq][:count]})
+    return clips
+
+
+def json_clips(sym, path):
+    clips = []
+    for clip in json.loads(read(path))["clips"]:
+        frames = []
+        for frame in clip["frames"]:
+            eyes, time_frame = frame[0], frame[1]
+            tf = frame[2] if len(frame) > 2 else [0, 0]
+            frames.append((sym.eval(eyes[0]), sym.eval(eyes[1]), sym.eval(time_frame), sym.eval(tf[0]), sym.eval(tf[1])))
+        clips.append({"name": clip["name"], "emotion": clip.get("emotion", "EMT_NONE"),
+                      "crossfade": bool(clip.get("crossfade", False)), "frames": frames})
+    return clips
+
+
+# ---------------------------------------------------------------------------------------------
+# 뱅크 쓰기/읽기
+# ---------------------------------------------------------------------------------------------
+
+def crc16(data, crc=0xFFFF):
+    """CRC-16/CCITT-FALSE (R310_clip_crc16 과 같음)"""
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) & 0xFFFF if crc & 0x8000 else (crc << 1) & 0xFFFF
+    return crc
+
+
+def build_bank(sym, clips):
+    if not 0 < len(clips) <= CLIP_MAX:
+        raise ValueError(f"클립 수는 1 ~ {CLIP_MAX} 개여야 합니다 ({len(clips)})")
+    names = set()
+    index, frames = b"", b""
+    data_start = struct.calcsize(HEADER_FMT) + len(clips) * struct.calcsize(INDEX_FMT)
+    for clip in clips:
+        name = clip["name"].encode("ascii")
+        if not 0 < len(name) <= CLIP_NAME_LEN or name in names:
+            raise ValueError(f"클립 이름은 1 ~ {CLIP_NAME_LEN}자이고 겹치지 않아야 합니다: {clip['name']}")
+        names.add(name)
+        if not 0 < len(clip["frames"]) <= 127:
+            raise ValueError(f"{clip['name']}: 프레임 수는 1 ~ 127 개여야 합니다")
+        emotion = sym.eval(clip["emotion"])
+        if emotion >= sym.values["EMT_COUNT"]:
+            raise ValueError(f"{clip['name']}: 알 수 없는 감정 {clip['emotion']}")
+        for right, left, time_frame, tf_right, tf_left in clip["frames"]:
+            if not (sym.glyph_ok(right) and sym.glyph_ok(left)):
+                raise ValueError(f"{clip['name']}: 글리프 인덱스가 폰트 범위를 벗어납니다 ({right}, {left})")
+            if not 0 <= time_frame <= 0xFFFF:
+                raise ValueError(f"{clip['name']}: 프레임 시간 범위 오류 ({time_frame})")
+        flags = CLIP_FLAG_CROSSFADE if clip["crossfade"] else 0
+        index += struct.pack(INDEX_FMT, name, emotion, flags, len(clip["frames"]), 0, data_start + len(frames))
+        frames += b"".join(struct.pack(FRAME_FMT, r, l, t, tr & 0xFF, tl & 0xFF) for r, l, t, tr, tl in clip["frames"])
+    body = index + frames
+    header = struct.pack(HEADER_FMT, CLIP_MAGIC, CLIP_VERSION, len(clips), crc16(body), struct.calcsize(HEADER_FMT) + len(body))
+    return header + body
+
+
+def dump_bank(path):
+    data = open(path, "rb").read()
+    magic, version, count, crc, total = struct.unpack_from(HEADER_FMT, data)
+    ok = magic == CLIP_MAGIC and version == CLIP_VERSION and total == len(data) and crc16(data[12:]) == crc
+    print(f"{path}: {total} bytes, version {version}, {count} clips, crc {'OK' if ok else 'BAD'}")
+    for c in range(count):
+        name, emotion, flags, frame_count, _, offset = struct.unpack_from(INDEX_FMT, data, 12 + c * 16)
+        name = name.rstrip(b"\0").decode()
+        print(f"  [{c}] {name} emotion {emotion}, {frame_count} frames{', crossfade' if flags & CLIP_FLAG_CROSSFADE else ''}")
+        for f in range(frame_count):
+            print("      {%3u, %3u} %5u ms  tf {0x%02X, 0x%02X}" % struct.unpack_from(FRAME_FMT, data, offset + f * 6))
+    return ok
+
+
+def main(argv):
+    if len(argv) < 2 or argv[1] not in ("convert", "build", "dump"):
+        print("usage: R310_clipBank.py convert [-o out.bin] [--only EMT_A,EMT_B] | build clips.json [-o out.bin] [--with-builtin] | dump bank.bin")
+        return 2
+    if argv[1] == "dump":
+        return 0 if dump_bank(argv[2]) else 1
+
+    args = argv[2:]
+    out_path = DEFAULT_OUTPUT
+    if "-o" in args:
+        out_path = args.pop(args.index("-o") + 1)
+        args.remove("-o")
+    sym = Symbols()
+    if argv[1] == "convert":
+        clips = builtin_clips(sym)
+        if "--only" in args:
+            only = set(args[args.index("--only") + 1].split(","))
+            clips = [c for c in clips if c["emotion"] in only]
+    else:
+        clips = json_clips(sym, args[0])
+        if "--with-builtin" in args:
+            clips = builtin_clips(sym) + clips
+
+    bank = build_bank(sym, clips)
+    os.makedirs(os.path.dirname(os.path.abspath(out_path)), exist_ok=True)
+    with open(out_path, "wb") as f:
+        f.write(bank)
+    print(f"R310_clipBank: {os.path.relpath(out_path, ROOT)} 생성 ({len(clips)} clips, {len(bank)} bytes: "
+          f"{', '.join(c['name'] for c in clips)})")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
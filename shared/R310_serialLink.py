@@ -0,0 +1,504 @@
+# R310_serialLink.py - R310 로봇 눈 바이너리 프레임 링크 호스트 도구
+#
+# A02_serialMux_001.h / A03_frameCodec_001.h 의 프레임 채널(COBS + CRC16)로 명령, 원격 표시 프레임, 글리프, 상태 보고를 주고받습니다.
+# 선로 형식과 메시지 배치는 R310_link_001.h 와 같습니다. (바꾸면 양쪽을 함께 수정)
+#
+# 사용법:
+#   python shared/R310_serialLink.py cmd /dev/ttyUSB0 "1:angry"
+#       텍스트 명령 한 줄을 프레임(type 0x01)으로 보냄 (에코 없음)
+#   python shared/R310_serialLink.py stream /dev/ttyUSB0 [--eyes 0] [--fps 60] [--seconds 10] [--panel 8]
+#       원격 표시 테스트 패턴(무지개 스크롤)을 보냄, 멈추면 G_R310_REMOTE_TIMEOUT_MS 뒤 애니메이션으로 복귀
+#   python shared/R310_serialLink.py glyph /dev/ttyUSB0 폰트인덱스 행0 행1 ... [--panel 8]
+#       글리프 한 개를 DRAM 핫 테이블에 올림 (행은 0x3C 같은 비트 값, 재부팅하면 원래대로)
+#   python shared/R310_serialLink.py telemetry /dev/ttyUSB0 [--eyes 0] [--period 100] [--seconds 5]
+#       상태 보고를 요청해 출력 (--period 를 주면 주기 보고, 0 이면 끔)
+#   python shared/R310_serialLink.py loopback [--device test/host/R310_host_serialMux]
+#       가상 터미널(pty) 양 끝에 이 도구와 펌웨어 A02/A03/R310_link 코드를 호스트에서 빌드한 기기 쪽 드라이버를 붙여
+#       모든 메시지 종류를 확인 (Linux, make -C test/host loopback 이 빌드 후 실행)
+#
+# 공통 옵션: --baud 921600 (G_A02_SERIALMUX_BAUD)
+# pyserial 없이 termios 만 사용하므로 Linux/macOS 에서 동작합니다.
+
+import binascii
+import os
+import pty
+import select
+import struct
+import subprocess
+import sys
+import termios
+import time
+import tty
+
+# A02_serialMux_001.h / A03_frameCodec_001.h 와 같은 값
+DEFAULT_BAUD = 921600
+FRAME_TYPE_LINE = 0x01
+FRAME_HEADER_LEN = 2
+FRAME_CRC_LEN = 2
+LINE_MAX = 96
+
+# R310_link_001.h 와 같은 값/배치
+MSG_FRAME = 0x10
+MSG_GLYPH = 0x11
+MSG_TELEMETRY = 0x12
+REMOTE_TIMEOUT_MS = 1000
+TELEMETRY_MIN_MS = 20
+TELEMETRY_FMT = "<I6B9I"
+TELEMETRY_FIELDS = ("uptimeMs", "eyesIdx", "robotState", "emotionIdx", "isRemote", "brightness", "pendingCmds",
+                    "framesSent", "framesSkipped", "remoteFrames", "rxBytes", "rxFramesOk", "rxFramesBad",
+                    "rxSeqGaps", "rxDropsOverlong", "linkErrors")
+
+BAUD_CONSTANTS = {115200: termios.B115200, 230400: termios.B230400}
+for _baud in (460800, 921600, 1000000, 2000000):
+    if hasattr(termios, f"B{_baud}"):
+        BAUD_CONSTANTS[_baud] = getattr(termios, f"B{_baud}")
+
+
+# ---------------------------------------------------------------------------------------------
+# 프레임 코덱 (A03_frameCodec_001.h)
+# ---------------------------------------------------------------------------------------------
+
+def crc16(data, crc=0xFFFF):
+    """CRC-16/CCITT-FALSE (A03_crc16 과 같음)"""
+    return binascii.crc_hqx(data, crc)
+
+
+def cobs_encode(data):
+    out = bytearray(b"\x01")
+    code_pos = 0
+    for byte in data:
+        if byte == 0:
+            code_pos = len(out)
+            out.append(1)
+            continue
+        out.append(byte)
+        out[code_pos] += 1
+        if out[code_pos] == 0xFF:   # 0 없는 254 바이트 블록
+            code_pos = len(out)
+            out.append(1)
+    return bytes(out)
+
+
+def cobs_decode(data):
+    """잘못된 인코딩이면 None"""
+    out = bytearray()
+    pos = 0
+    while pos < len(data):
+        code = data[pos]
+        pos += 1
+        if code == 0 or pos + code - 1 > len(data):
+            return None
+        out += data[pos:pos + code - 1]
+        pos += code - 1
+        if code != 0xFF and pos < len(data):
+            out.append(0)
+    return bytes(out)
+
+
+def build_frame(msg_type, seq, payload=b""):
+    raw = bytes((msg_type, seq & 0xFF)) + bytes(payload)
+    return b"\x00" + cobs_encode(raw + struct.pack("<H", crc16(raw))) + b"\x00"
+
+
+class Decoder:
+    """A02_serialMux_feedBytes 와 같은 규칙으로 텍스트 줄과 프레임을 나눔
+
+    feed() 는 ("line", 문자열) / ("frame", type, seq, payload) 목록을 돌려주고, 오류는 통계에만 셈
+    """
+
+    def __init__(self, frame_max=None):
+        self.frame_max = frame_max
+        self.is_frame = False
+        self.text = bytearray()
+        self.frame = bytearray()
+        self.is_overlong = False
+        self.rx_seq = None
+        self.stats = dict(bytes=0, lines=0, frames_ok=0, frames_bad=0, seq_gaps=0, drops_overlong=0)
+
+    def feed(self, data):
+        events = []
+        self.stats["bytes"] += len(data)
+        for byte in data:
+            if self.is_frame:
+                if byte != 0:
+                    if self.frame_max is not None and len(self.frame) >= self.frame_max:
+                        self.is_overlong = True
+                    else:
+                        self.frame.append(byte)
+                    continue
+                if not self.frame and not self.is_overlong:
+                    continue        # 연속된 구분자 (다음 프레임 시작)
+                self._end_frame(events)
+                continue
+            if byte == 0:           # 프레임 시작 (조립 중이던 텍스트 조각은 버림)
+                self.is_frame = True
+                self.text.clear()
+                continue
+            if byte in b"\r\n":
+                if self.text:
+                    self.stats["lines"] += 1
+                    events.append(("line", self.text.decode("ascii", "replace")))
+                    self.text.clear()
+                continue
+            self.text.append(byte)
+        return events
+
+    def _end_frame(self, events):
+        encoded, is_overlong = bytes(self.frame), self.is_overlong
+        self.frame.clear()
+        self.is_frame = self.is_overlong = False
+        if is_overlong:
+            self.stats["drops_overlong"] += 1
+            return
+        raw = cobs_decode(encoded)
+        if raw is None or len(raw) < FRAME_HEADER_LEN + FRAME_CRC_LEN or crc16(raw[:-2]) != struct.unpack_from("<H", raw, len(raw) - 2)[0]:
+            self.stats["frames_bad"] += 1
+            return
+        self.stats["frames_ok"] += 1
+        if self.rx_seq is not None:
+            self.stats["seq_gaps"] += (raw[1] - self.rx_seq - 1) & 0xFF
+        self.rx_seq = raw[1]
+        events.append(("frame", raw[0], raw[1], raw[FRAME_HEADER_LEN:-FRAME_CRC_LEN]))
+
+
+# ---------------------------------------------------------------------------------------------
+# 메시지 (R310_link_001.h)
+# ---------------------------------------------------------------------------------------------
+
+def frame_payload(eyes, rgb):
+    """rgb: [눈(0: 오른쪽, 1: 왼쪽)][행][열] = (r, g, b)"""
+    return bytes((eyes,)) + bytes(c for eye in rgb for row in eye for pixel in row for c in pixel)
+
+
+def glyph_payload(index, rows, panel):
+    fmt = "<B" if panel == 8 else "<H"
+    return bytes((index,)) + b"".join(struct.pack(fmt, row) for row in rows)
+
+
+def telemetry_request(eyes, period_ms=None):
+    return bytes((eyes,)) if period_ms is None else struct.pack("<BH", eyes, period_ms)
+
+
+def parse_telemetry(payload):
+    if len(payload) != struct.calcsize(TELEMETRY_FMT):
+        return None
+    return dict(zip(TELEMETRY_FIELDS, struct.unpack(TELEMETRY_FMT, payload)))
+
+
+def test_pattern(panel, step):
+    """무지개 대각선 스크롤 (원격 표시 확인용)"""
+    def wheel(pos):
+        pos &= 0xFF
+        if pos < 85:
+            return (255 - pos * 3, pos * 3, 0)
+        if pos < 170:
+            pos -= 85
+            return (0, 255 - pos * 3, pos * 3)
+        pos -= 170
+        return (pos * 3, 0, 255 - pos * 3)
+    return [[[tuple(c // 8 for c in wheel((row + col + eye * panel) * 256 // (2 * panel) + step * 4))
+              for col in range(panel)] for row in range(panel)] for eye in range(2)]
+
+
+class Link:
+    """시리얼 포트(또는 pty) 파일 기술자 위의 프레임 송수신"""
+
+    def __init__(self, fd, baud=DEFAULT_BAUD):
+        self.fd = fd
+        self.seq = 0
+        self.decoder = Decoder()
+        if os.isatty(fd):
+            tty.setraw(fd)
+            if baud in BAUD_CONSTANTS:
+                attrs = termios.tcgetattr(fd)
+                attrs[4] = attrs[5] = BAUD_CONSTANTS[baud]
+                termios.tcsetattr(fd, termios.TCSANOW, attrs)
+
+    @classmethod
+    def open(cls, path, baud=DEFAULT_BAUD):
+        return cls(os.open(path, os.O_RDWR | os.O_NOCTTY), baud)
+
+    def close(self):
+        os.close(self.fd)
+
+    def send(self, msg_type, payload=b""):
+        frame = build_frame(msg_type, self.seq, payload)
+        self.seq = (self.seq + 1) & 0xFF
+        view = memoryview(frame)
+        while view:
+            view = view[os.write(self.fd, view):]
+
+    def command(self, text):
+        self.send(FRAME_TYPE_LINE, text.encode("ascii"))
+
+    def push_frame(self, eyes, rgb):
+        self.send(MSG_FRAME, frame_payload(eyes, rgb))
+
+    def upload_glyph(self, index, rows, panel=8):
+        self.send(MSG_GLYPH, glyph_payload(index, rows, panel))
+
+    def request_telemetry(self, eyes=0, period_ms=None):
+        self.send(MSG_TELEMETRY, telemetry_request(eyes, period_ms))
+
+    def receive(self, timeout):
+        """timeout 초 안에 받은 이벤트 목록 (Decoder.feed 형식)"""
+        events = []
+        deadline = time.monotonic() + timeout
+        while not events:
+            remain = deadline - time.monotonic()
+            if remain <= 0 or not select.select([self.fd], [], [], remain)[0]:
+                break
+            try:
+                data = os.read(self.fd, 4096)
+            except OSError:     # pty 반대쪽이 닫힘
+                break
+            events += self.decoder.feed(data)
+        return events
+
+    def wait_telemetry(self, timeout=1.0):
+        deadline = time.monotonic() + timeout
+        while time.monotonic() < deadline:
+            for event in self.receive(deadline - time.monotonic()):
+                if event[0] == "frame" and event[1] == MSG_TELEMETRY:
+                    return parse_telemetry(event[3])
+                if event[0] == "line":
+                    print(f"  < {event[1]}")
+        return None
+
+
+# ---------------------------------------------------------------------------------------------
+# 루프백 테스트 (pty + 호스트 빌드 기기 드라이버)
+# ---------------------------------------------------------------------------------------------
+
+DEFAULT_DEVICE = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "test", "host", "R310_host_serialMux")
+
+
+class DeviceProcess:
+    """test/host/R310_host_serialMux 를 pty 슬레이브에 붙여 실행하고, 표준 출력의 기록 줄을 읽음
+
+    기록 형식: "ready panel N frameMax N lineMax N telemetry N brightness N", "line text 줄", "line binary 길이 줄",
+              "frame 눈 crc16(rgb)", "glyph 인덱스 행hex"
+    """
+
+    def __init__(self, path, slave):
+        self.proc = subprocess.Popen([path, os.ttyname(slave)], stdout=subprocess.PIPE)
+        self.pending = b""
+        self.log = []
+        self.config = {}
+        ready = self.wait(lambda: self.log, 2.0)
+        if ready and self.log[0].startswith("ready "):
+            words = self.log.pop(0).split()[1:]
+            self.config = {k: int(v) for k, v in zip(words[0::2], words[1::2])}
+
+    def read(self, timeout):
+        fd = self.proc.stdout.fileno()
+        if select.select([fd], [], [], max(timeout, 0))[0]:
+            data = os.read(fd, 4096)
+            if not data:
+                return False
+            lines = (self.pending + data).split(b"\n")
+            self.pending = lines.pop()
+            self.log += [line.decode("ascii", "replace") for line in lines]
+        return True
+
+    def wait(self, predicate, timeout=1.0):
+        """predicate() 가 참이 될 때까지 기록을 읽음 (텍스트 줄은 다음 폴링에서 넘어가므로 상태 보고보다 늦을 수 있음)"""
+        deadline = time.monotonic() + timeout
+        while not predicate():
+            if time.monotonic() >= deadline or not self.read(deadline - time.monotonic()):
+                return False
+        return True
+
+    def entries(self, kind):
+        return [line.split(" ", 1)[1] for line in self.log if line.startswith(kind + " ")]
+
+    def close(self):
+        if self.proc.poll() is None:
+            self.proc.terminate()
+        self.proc.wait(1)
+        self.proc.stdout.close()
+
+
+def loopback(device_path):
+    failures = []
+
+    def check(name, ok, detail=""):
+        print(f"  {'OK  ' if ok else 'FAIL'} {name}{(': ' + detail) if detail else ''}")
+        if not ok:
+            failures.append(name)
+
+    # 코덱 자체 확인 (A03_frameCodec_001.h 의 CRC16 static_assert 와 같은 테이블 규칙)
+    check("crc16 '123456789'", crc16(b"123456789") == 0x29B1)
+    for n in (0, 1, 253, 254, 255, 508, 1000):
+        data = bytes((i * 7) & 0xFF for i in range(n))
+        encoded = cobs_encode(data)
+        check(f"cobs {n} bytes", b"\x00" not in encoded and cobs_decode(encoded) == data and len(encoded) <= n + n // 254 + 1)
+
+    if not os.access(device_path, os.X_OK):
+        print(f"기기 드라이버가 없습니다: {device_path} (make -C test/host R310_host_serialMux)")
+        return 2
+
+    master, slave = pty.openpty()
+    host = Link(master)
+    device = DeviceProcess(device_path, slave)
+    try:
+        config = device.config
+        panel = config.get("panel", 0)
+        check("device ready", panel in (8, 16), str(config))
+        check("telemetry layout", config.get("telemetry") == struct.calcsize(TELEMETRY_FMT),
+              f"sizeof {config.get('telemetry')}, {TELEMETRY_FMT} {struct.calcsize(TELEMETRY_FMT)}")
+        if failures:
+            return 1
+
+        # 텍스트 줄과 LINE 프레임
+        host.command("1:angry")
+        os.write(master, b"smile\n")
+        host.request_telemetry(0)
+        telemetry = host.wait_telemetry()
+        check("telemetry reply", telemetry is not None and telemetry["rxFramesOk"] == 2, str(telemetry))
+        check("telemetry fields", telemetry is not None and telemetry["eyesIdx"] == 0 and
+              telemetry["brightness"] == config["brightness"] and telemetry["rxFramesBad"] == 0 and telemetry["linkErrors"] == 0)
+        device.wait(lambda: len(device.entries("line")) >= 2)
+        check("binary / text command", device.entries("line") == ["binary 7 1:angry", "text smile"], str(device.entries("line")))
+
+        # 텍스트/프레임 전환: 프레임 시작(0x00)이 조립 중이던 텍스트 조각을 버리고, 프레임 뒤 텍스트는 새 줄로 조립
+        os.write(master, b"smi")
+        host.command("wink")
+        os.write(master, b"le\n")
+        # 넘친 줄/프레임은 끝까지 버리고 다음 줄/프레임은 정상 처리 (isOverlong 해제)
+        os.write(master, b"x" * (config["lineMax"] + 20) + b"\n")
+        os.write(master, b"blink\n")
+        os.write(master, build_frame(MSG_FRAME, host.seq, b"\x55" * config["frameMax"]))  # 버퍼 초과 (seq 는 소비하지 않음)
+        # 최대 길이 LINE 프레임: 종료 문자가 CRC 자리에 쓰이므로 줄 끝에 CRC 바이트가 붙지 않아야 함
+        long_line = "".join(chr(ord("a") + i % 26) for i in range(config["frameMax"] - FRAME_HEADER_LEN - FRAME_CRC_LEN))
+        host.command(long_line)
+        host.command("z")
+        host.request_telemetry(0)
+        telemetry = host.wait_telemetry()
+        check("overlong line/frame dropped", telemetry is not None and telemetry["rxDropsOverlong"] == 2,
+              str(telemetry and telemetry["rxDropsOverlong"]))
+        check("frames after overlong", telemetry is not None and telemetry["rxFramesOk"] == 6 and
+              telemetry["rxFramesBad"] == 0 and telemetry["rxSeqGaps"] == 0, str(telemetry))
+        device.wait(lambda: len(device.entries("line")) >= 7)
+        text_lines = [line for line in device.entries("line") if line.startswith("text ")]
+        binary_lines = [line for line in device.entries("line") if line.startswith("binary ")]
+        check("text fragment dropped on frame start", text_lines == ["text smile", "text le", "text blink"], str(text_lines))
+        check("binary lines (max length, terminator over CRC)",
+              binary_lines == ["binary 7 1:angry", "binary 4 wink", f"binary {len(long_line)} {long_line}", "binary 1 z"],
+              str([line[:24] for line in binary_lines]))
+        deadline = time.monotonic() + 0.5
+        while host.decoder.stats["lines"] < 3 and time.monotonic() < deadline:
+            host.receive(0.05)
+        check("text echo only for text lines", host.decoder.stats["lines"] == 3, str(host.decoder.stats))
+
+        # 원격 표시 프레임
+        frames = 60
+        start = time.monotonic()
+        for step in range(frames):
+            host.push_frame(0, test_pattern(panel, step))
+        host.request_telemetry(0)
+        telemetry = host.wait_telemetry()
+        elapsed = time.monotonic() - start
+        check(f"remote frames ({frames} in {elapsed * 1000:.0f} ms)", telemetry is not None and telemetry["remoteFrames"] == frames and
+              telemetry["isRemote"] == 1)
+        expected = f"0 {crc16(frame_payload(0, test_pattern(panel, frames - 1))[1:]):04x}"
+        device.wait(lambda: len(device.entries("frame")) >= frames)
+        check("remote frame content", device.entries("frame")[-1:] == [expected], str(device.entries("frame")[-1:]))
+
+        # 글리프, 형식 오류, CRC 오류, 빠진 seq
+        glyph = [0x3C, 0x42, 0x81, 0x81, 0x81, 0x81, 0x42, 0x3C] * (panel // 8)
+        host.upload_glyph(5, glyph, panel)
+        host.send(MSG_FRAME, b"\x00\x01\x02")                     # 길이 오류
+        bad = bytearray(build_frame(MSG_FRAME, host.seq, b"\x00" * 8))
+        bad[3] ^= 0x55                                            # CRC 오류
+        os.write(master, bytes(bad))
+        host.seq = (host.seq + 2) & 0xFF                          # 빠진 프레임 2개 (CRC 오류 프레임 포함)
+        host.request_telemetry(0, 50)
+        telemetry = host.wait_telemetry()
+        device.wait(lambda: device.entries("glyph"))
+        check("glyph upload", device.entries("glyph") == ["5 " + glyph_payload(5, glyph, panel)[1:].hex()], str(device.entries("glyph")))
+        check("link error", telemetry is not None and telemetry["linkErrors"] == 1, str(telemetry and telemetry["linkErrors"]))
+        check("crc error", telemetry is not None and telemetry["rxFramesBad"] == 1)
+        check("seq gap", telemetry is not None and telemetry["rxSeqGaps"] == 2, str(telemetry and telemetry["rxSeqGaps"]))
+
+        count, deadline = 0, time.monotonic() + 0.5
+        while time.monotonic() < deadline:
+            count += host.wait_telemetry(deadline - time.monotonic()) is not None
+        check("periodic telemetry (50 ms, 0.5 s)", 7 <= count <= 12, f"{count} reports")
+        host.request_telemetry(0, 0)
+        check("host decoder clean", host.decoder.stats["frames_bad"] == 0 and host.decoder.stats["seq_gaps"] == 0, str(host.decoder.stats))
+    finally:
+        os.close(master)
+        device.close()
+        os.close(slave)
+
+    print(f"R310_serialLink loopback: {'OK' if not failures else 'FAIL ' + ', '.join(failures)}")
+    return 0 if not failures else 1
+
+
+# ---------------------------------------------------------------------------------------------
+# 명령줄
+# ---------------------------------------------------------------------------------------------
+
+def pop_option(args, name, default, conv=int):
+    if name not in args:
+        return default
+    value = args.pop(args.index(name) + 1)
+    args.remove(name)
+    return conv(value)
+
+
+def main(argv):
+    if len(argv) < 2 or argv[1] not in ("cmd", "stream", "glyph", "telemetry", "loopback") or (argv[1] != "loopback" and len(argv) < 3):
+        print("usage: R310_serialLink.py cmd 포트 \"명령\" | stream 포트 [--eyes 0] [--fps 60] [--seconds 10] | "
+              "glyph 포트 인덱스 행... | telemetry 포트 [--eyes 0] [--period ms] [--seconds 5] | loopback [--device 경로]  (공통: --baud, --panel)")
+        return 2
+    args = argv[2:]
+    baud = pop_option(args, "--baud", DEFAULT_BAUD)
+    panel = pop_option(args, "--panel", 8)
+    if argv[1] == "loopback":
+        return loopback(pop_option(args, "--device", DEFAULT_DEVICE, str))
+
+    link = Link.open(args.pop(0), baud)
+    try:
+        if argv[1] == "cmd":
+            link.command(" ".join(args))
+        elif argv[1] == "stream":
+            eyes = pop_option(args, "--eyes", 0)
+            fps = pop_option(args, "--fps", 60.0, float)
+            seconds = pop_option(args, "--seconds", 10.0, float)
+            start, step = time.monotonic(), 0
+            while time.monotonic() - start < seconds:
+                link.push_frame(eyes, test_pattern(panel, step))
+                step += 1
+                time.sleep(max(0.0, start + step / fps - time.monotonic()))
+            print(f"R310_serialLink: {step} frames, {step / (time.monotonic() - start):.1f} fps")
+        elif argv[1] == "glyph":
+            index = int(args.pop(0), 0)
+            rows = [int(row, 0) for row in args]
+            if len(rows) != panel:
+                print(f"글리프 행은 {panel} 개여야 합니다 ({len(rows)})")
+                return 2
+            link.upload_glyph(index, rows, panel)
+        else:
+            eyes = pop_option(args, "--eyes", 0)
+            period = pop_option(args, "--period", None)
+            seconds = pop_option(args, "--seconds", 0.0 if period is None else 5.0, float)
+            link.request_telemetry(eyes, period)
+            deadline = time.monotonic() + max(seconds, 1.0)
+            while time.monotonic() < deadline:
+                telemetry = link.wait_telemetry(deadline - time.monotonic())
+                if telemetry is None:
+                    break
+                print(" ".join(f"{k}={v}" for k, v in telemetry.items()))
+                if period is None:
+                    break
+            if period:
+                link.request_telemetry(eyes, 0)
+    finally:
+        link.close()
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
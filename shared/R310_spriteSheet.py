@@ -0,0 +1,330 @@
+# R310_spriteSheet.py - R310 로봇 눈 스프라이트 시트 컴파일러
+#
+# PNG 스프라이트 시트(글리프 격자)와 JSON 설명 파일을 읽어 PROGMEM 폰트 테이블 헤더를 생성합니다.
+#   - 동일 글리프/행 중복 제거, 코덱 선택 (RAW 또는 행 사전 + 반복 길이 ROW_DICT, auto 는 작은 쪽)
+#   - JSON "sequences" 에 적은 애니메이션 시퀀스를 T_R310_ani_Frame_t 배열로 생성
+#
+# 사용법:
+#   python shared/R310_spriteSheet.py [설명파일.json]      (기본: shared/R310_sprites/R310_eyes.json)
+#   PlatformIO: extra_scripts = pre:shared/R310_spriteSheet.py  (원본이 출력보다 새로울 때만 다시 생성)
+#
+# PNG 는 외부 라이브러리 없이 읽습니다. (비인터레이스, 그레이/RGB/팔레트/알파, 팔레트·그레이는 1/2/4/8비트)
+# 휘도가 128 이상인 픽셀이 켜진 픽셀입니다. 격자 간격(gap) 픽셀은 읽지 않습니다.
+
+import json
+import os
+import struct
+import sys
+import zlib
+
+DEFAULT_SPEC = os.path.join("shared", "R310_sprites", "R310_eyes.json")
+
+CODEC_RAW = "FONT_CODEC_RAW"
+CODEC_ROW_DICT = "FONT_CODEC_ROW_DICT"
+ROW_DICT_MAX_ENTRIES = 64   # 토큰 하위 6비트 = 사전 인덱스
+ROW_DICT_MAX_RUN = 4        # 토큰 상위 2비트 = 반복 횟수 - 1
+
+
+# ---------------------------------------------------------------------------------------------
+# PNG 읽기
+# ---------------------------------------------------------------------------------------------
+
+def _paeth(a, b, c):
+    p = a + b - c
+    pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+    if pa <= pb and pa <= pc:
+        return a
+    return b if pb <= pc else c
+
+
+def read_png_luma(path):
+    """PNG 를 읽어 (너비, 높이, 휘도 0~255 행 리스트) 를 반환합니다."""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        raise ValueError(f"{path}: PNG 파일이 아닙니다")
+
+    pos, idat, palette = 8, b"", None
+    width = height = depth = color = interlace = None
+    while pos < len(data):
+        length, ctype = struct.unpack(">I4s", data[pos:pos + 8])
+        chunk = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if ctype == b"IHDR":
+            width, height, depth, color, _, _, interlace = struct.unpack(">IIBBBBB", chunk)
+        elif ctype == b"PLTE":
+            palette = [tuple(chunk[i:i + 3]) for i in range(0, len(chunk), 3)]
+        elif ctype == b"IDAT":
+            idat += chunk
+        elif ctype == b"IEND":
+            break
+
+    if interlace:
+        raise ValueError(f"{path}: 인터레이스 PNG 는 지원하지 않습니다")
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}.get(color)
+    if channels is None or (depth != 8 and color not in (0, 3)):
+        raise ValueError(f"{path}: 지원하지 않는 PNG 형식 (color type {color}, bit depth {depth})")
+
+    bits_pp = channels * depth
+    stride = (width * bits_pp + 7) // 8
+    bpp = max(1, bits_pp // 8)
+    raw = zlib.decompress(idat)
+    prev = bytearray(stride)
+    rows = []
+    for y in range(height):
+        ftype = raw[y * (stride + 1)]
+        line = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+        for i in range(stride):
+            a = line[i - bpp] if i >= bpp else 0
+            b = prev[i]
+            c = prev[i - bpp] if i >= bpp else 0
+            if ftype == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif ftype == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif ftype == 3:
+                line[i] = (line[i] + ((a + b) >> 1)) & 0xFF
+            elif ftype == 4:
+                line[i] = (line[i] + _paeth(a, b, c)) & 0xFF
+        prev = line
+
+        luma = []
+        for x in range(width):
+            if depth < 8:
+                v = (line[(x * depth) // 8] >> (8 - depth - (x * depth) % 8)) & ((1 << depth) - 1)
+                if color == 0:
+                    v = v * 255 // ((1 << depth) - 1)
+            else:
+                v = line[x * channels]
+            if color == 3:
+                r, g, b_ = palette[v]
+                v = (r * 299 + g * 587 + b_ * 114) // 1000
+            elif color in (2, 6):
+                r, g, b_ = line[x * channels:x * channels + 3]
+                v = (r * 299 + g * 587 + b_ * 114) // 1000
+            luma.append(v)
+        rows.append(luma)
+    return width, height, rows
+
+
+def slice_sheet(path, size, columns, gap, count):
+    """시트에서 count 개의 size x size 글리프를 잘라 행 비트(MSB = 열 0) 리스트로 반환합니다."""
+    width, height, luma = read_png_luma(path)
+    glyphs = []
+    for idx in range(count):
+        cx = gap + (idx % columns) * (size + gap)
+        cy = gap + (idx // columns) * (size + gap)
+        if cx + size > width or cy + size > height:
+            raise ValueError(f"{path}: 글리프 {idx} 가 시트 범위를 벗어납니다 ({width}x{height})")
+        glyph = []
+        for y in range(size):
+            bits = 0
+            for x in range(size):
+                bits = (bits << 1) | (1 if luma[cy + y][cx + x] >= 128 else 0)
+            glyph.append(bits)
+        glyphs.append(glyph)
+    return glyphs
+
+
+# ---------------------------------------------------------------------------------------------
+# 인코딩
+# ---------------------------------------------------------------------------------------------
+
+def encode_row_dict(glyphs):
+    """행 사전 + (반복-1)<<6 | 사전 인덱스 토큰 스트림. 동일 글리프는 스트림을 공유합니다."""
+    row_dict, row_index = [], {}
+    stream, offsets, glyph_at = [], [], {}
+    for glyph in glyphs:
+        key = tuple(glyph)
+        if key in glyph_at:
+            offsets.append(glyph_at[key])
+            continue
+        glyph_at[key] = len(stream)
+        offsets.append(len(stream))
+        row = 0
+        while row < len(glyph):
+            bits = glyph[row]
+            if bits not in row_index:
+                row_index[bits] = len(row_dict)
+                row_dict.append(bits)
+            run = 1
+            while run < ROW_DICT_MAX_RUN and row + run < len(glyph) and glyph[row + run] == bits:
+                run += 1
+            stream.append(((run - 1) << 6) | row_index[bits])
+            row += run
+    offsets.append(len(stream))
+    if len(row_dict) > ROW_DICT_MAX_ENTRIES:
+        return None
+    return row_dict, stream, offsets
+
+
+def raw_bytes(glyphs, size):
+    return len(glyphs) * (1 + size // 8 * size)   # T_R310_Glyph_t = width 1바이트 + 데이터
+
+
+def row_dict_bytes(encoded, size):
+    row_dict, stream, offsets = encoded
+    return len(row_dict) * (size // 8) + len(stream) + 2 * len(offsets)
+
+
+# ---------------------------------------------------------------------------------------------
+# 헤더 생성
+# ---------------------------------------------------------------------------------------------
+
+def row_art(bits, size):
+    return " ".join("#" if bits & (1 << (size - 1 - c)) else "." for c in range(size))
+
+
+def row_literal(bits, size):
+    return ", ".join(f"0b{(bits >> (8 * (size // 8 - 1 - b))) & 0xFF:08b}" for b in range(size // 8))
+
+
+def emit_font(out, sheet, names, glyphs):
+    size, name = sheet["size"], sheet["name"]
+    row_t = {8: "uint8_t", 16: "uint16_t", 32: "uint32_t"}[size]
+    raw_size = raw_bytes(glyphs, size)
+    encoded = encode_row_dict(glyphs)
+    codec = sheet.get("codec", "auto")
+    if codec == "auto":
+        codec = "row_dict" if encoded is not None and row_dict_bytes(encoded, size) < raw_size else "raw"
+    if codec == "row_dict" and encoded is None:
+        raise ValueError(f"{name}: 고유 행이 {ROW_DICT_MAX_ENTRIES}개를 넘어 row_dict 코덱을 쓸 수 없습니다")
+
+    seen = {}
+    for idx, glyph in enumerate(glyphs):
+        if tuple(glyph) in seen:
+            print(f"R310_spriteSheet: {name} 글리프 {names[idx]} 는 {names[seen[tuple(glyph)]]} 와 같습니다 (변환/별칭 사용 권장)")
+        seen.setdefault(tuple(glyph), idx)
+
+    out.append("")
+    if codec == "raw":
+        out.append(f"// {size}x{size} 눈 폰트: {len(glyphs)} 글리프, RAW {raw_size} 바이트")
+        out.append(f"const T_R310_Glyph_t<{size}, {size}> {name}_arr[] PROGMEM = {{")
+        for idx, glyph in enumerate(glyphs):
+            out.append(f"    // 인덱스 {idx}: {names[idx]}")
+            out.append(f"    {{{size}, {{")
+            for row, bits in enumerate(glyph):
+                sep = "," if row < size - 1 else " "
+                out.append(f"        {row_literal(bits, size)}{sep} // {row_art(bits, size)}")
+            out.append("    }},")
+        out.append("};")
+        out.append("")
+        out.append(f"constexpr T_R310_PackedFont_t<{size}, {size}> {name} = {{ {CODEC_RAW}, {len(glyphs)}, {name}_arr, nullptr, nullptr, nullptr }};")
+    else:
+        row_dict, stream, offsets = encoded
+        packed = row_dict_bytes(encoded, size)
+        out.append(f"// {size}x{size} 눈 폰트: {len(glyphs)} 글리프, ROW_DICT {packed} 바이트 (RAW {raw_size} 바이트)")
+        out.append(f"// 행 사전 {len(row_dict)}개, 토큰 {len(stream)}개 (토큰 = (반복 - 1) << 6 | 사전 인덱스)")
+        out.append(f"const {row_t} {name}_rowDict[] PROGMEM = {{")
+        for idx, bits in enumerate(row_dict):
+            out.append(f"    0x{bits:0{size // 4}X}, // {idx:2d}: {row_art(bits, size)}")
+        out.append("};")
+        out.append("")
+        out.append(f"const uint8_t {name}_stream[] PROGMEM = {{")
+        for idx in range(len(glyphs)):
+            if any(offsets[j] == offsets[idx] for j in range(idx)):
+                continue    # 앞 글리프와 같은 글리프는 스트림 공유
+            end = min((o for o in offsets[idx + 1:] if o > offsets[idx]), default=len(stream))
+            tokens = stream[offsets[idx]:end]
+            out.append(f"    {', '.join(f'0x{t:02X}' for t in tokens)}, // {idx}: {names[idx]}")
+        out.append("};")
+        out.append("")
+        out.append(f"const uint16_t {name}_offset[] PROGMEM = {{ {', '.join(str(o) for o in offsets)} }};")
+        out.append("")
+        out.append(f"constexpr T_R310_PackedFont_t<{size}, {size}> {name} = {{ {CODEC_ROW_DICT}, {len(glyphs)}, nullptr, {name}_rowDict, {name}_stream, {name}_offset }};")
+    return codec
+
+
+def emit_sequences(out, sequences):
+    if not sequences:
+        return
+    out.append("")
+    out.append("// --- JSON 으로 작성한 애니메이션 시퀀스 (g_R310_ani_Tables_arr 등록은 R310_data2_014.h 에서 합니다, 글리프 범위는 빌드 시점에 검사)")
+    for seq_name, seq in sequences.items():
+        out.append(f"constexpr T_R310_ani_Frame_t g_R310_frameSeq_{seq_name}[] PROGMEM = {{")
+        for frame in seq["frames"]:
+            eyes = frame["eyes"]
+            line = f"    {{{{ {eyes[0]}, {eyes[1]} }}, {frame.get('time', 'G_R310_FRAME_TIME')}"
+            if "transform" in frame:
+                line += f", {{ {frame['transform'][0]}, {frame['transform'][1]} }}"
+            line += " },"
+            if "comment" in frame:
+                line += f" // {frame['comment']}"
+            out.append(line)
+        out.append("};")
+        out.append("")
+
+
+def generate(spec_path, root):
+    with open(spec_path, encoding="utf-8") as f:
+        spec = json.load(f)
+    spec_dir = os.path.dirname(spec_path)
+    names = spec["glyphs"]
+    out_path = os.path.normpath(os.path.join(spec_dir, spec["output"]))
+
+    out = [
+        "#pragma once",
+        "",
+        f"// {os.path.basename(out_path)} - 로봇 눈 폰트 PROGMEM 테이블 (자동 생성 파일, 직접 수정하지 마세요)",
+        f"// 원본: {os.path.relpath(spec_path, root).replace(os.sep, '/')} 및 스프라이트 시트 PNG",
+        "// 생성: python shared/R310_spriteSheet.py (PlatformIO 빌드 전 단계에서 원본이 바뀌면 자동 실행)",
+        "// 글리프 순서는 T_R310_EyeFontIndex_t (R310_data2_014.h) 와 같아야 하며, 아래 static_assert 로 확인합니다.",
+        "",
+        '#include "R310_fontPack_001.h"',
+        "",
+        f"const int G_R310_ROBOT_EYES_FONT_LEN = {len(names)}; // 눈 폰트 글리프 개수 (모든 패널 크기 공통)",
+        "",
+    ]
+    for idx, glyph_name in enumerate(names):
+        out.append(f'static_assert({glyph_name} == {idx}, "스프라이트 시트 글리프 순서가 T_R310_EyeFontIndex_t 와 다릅니다: {glyph_name}");')
+
+    summary = []
+    for sheet in spec["sheets"]:
+        png = os.path.join(spec_dir, sheet["png"])
+        glyphs = slice_sheet(png, sheet["size"], sheet.get("columns", 8), sheet.get("gap", 1), len(names))
+        codec = emit_font(out, sheet, names, glyphs)
+        summary.append(f"{sheet['size']}x{sheet['size']} {codec}")
+
+    emit_sequences(out, spec.get("sequences", {}))
+    text = "\n".join(out).rstrip("\n") + "\n"
+
+    old = None
+    if os.path.exists(out_path):
+        with open(out_path, encoding="utf-8") as f:
+            old = f.read()
+    if old != text:
+        with open(out_path, "w", encoding="utf-8", newline="\n") as f:
+            f.write(text)
+        print(f"R310_spriteSheet: {os.path.relpath(out_path, root)} 생성 ({', '.join(summary)})")
+    return out_path
+
+
+def sources_of(spec_path):
+    with open(spec_path, encoding="utf-8") as f:
+        spec = json.load(f)
+    spec_dir = os.path.dirname(spec_path)
+    out_path = os.path.normpath(os.path.join(spec_dir, spec["output"]))
+    inputs = [spec_path, os.path.abspath(__file__) if "__file__" in globals() else spec_path]
+    inputs += [os.path.join(spec_dir, s["png"]) for s in spec["sheets"]]
+    return inputs, out_path
+
+
+def is_outdated(spec_path):
+    inputs, out_path = sources_of(spec_path)
+    if not os.path.exists(out_path):
+        return True
+    out_time = os.path.getmtime(out_path)
+    return any(os.path.getmtime(p) > out_time for p in inputs if os.path.exists(p))
+
+
+try:
+    Import("env")   # PlatformIO extra_scripts (pre:) 로 실행된 경우
+    _root = env["PROJECT_DIR"]
+    _spec = os.path.join(_root, DEFAULT_SPEC)
+    if is_outdated(_spec):
+        generate(_spec, _root)
+except NameError:
+    if __name__ == "__main__":
+        _root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+        _spec = os.path.abspath(sys.argv[1]) if len(sys.argv) > 1 else os.path.join(_root, DEFAULT_SPEC)
+        generate(_spec, _root)
@@ -555,7 +555,7 @@ void C100_init() { // Arduino 스케치 기본 setup 함수
 
 	// FastLED 초기화
 	FastLED.addLeds<G_C120_LED_TYPE, G_C120_LED_DATA_PIN, G_C120_COLOR_ORDER>(g_C120_leds, G_C120_TOTAL_NUM_LEDS).setCorrection(TypicalLEDStrip); // LED 설정
-	FastLED.setBrightness(80); // 전체 밝기 설정 (0-255), 너무 밝으면 눈부심 및 전력 소모 증가
+	// 밝기는 C120_show() 에서 프레임마다 전원 예산(G_C120_POWER_BUDGET_MA) 안으로 제한해 적용 (사용자 밝기: G_C120_BRIGHTNESS)
 
 	// 초기 필터 값 설정 (첫 센서 값으로 초기화)
 	C110_readMPUData();	 // 초기 값 한번 읽기 (내부 필터가 적용된 값)
@@ -604,7 +604,7 @@ void C100_run() { // Arduino 스케치 기본 loop 함수
 	// 5. 디스플레이에 눈 그리기
 	C120_clearDisplay();		 // 매 프레임 LED 버퍼 초기화
 	C100_drawCurrentEyeState();	 // 현재 눈 상태에 맞는 눈을 그림
-	FastLED.show();				 // LED 업데이트 내용을 실제 LED에 표시
+	C120_show();				 // LED 업데이트 내용을 전원 예산 안의 밝기로 표시
 
 	// 센서 읽기 및 루프 실행 간격 제어 (너무 빠르면 필터링 효과 감소 및 부하 증가)
 	// MPU6050의 샘플링 속도와 처리할 내용에 따라 적절히 조절
@@ -35,15 +35,61 @@ int C120_getLedIndex(uint8_t p_matrix_index, uint8_t p_x, uint8_t p_y) {
 	return v_index;
 }
 
+// --- LED 전원 예산 제한 ---
+// 채널 합은 픽셀을 쓸 때마다 (새 값 - 이전 값) 만큼 갱신하므로 show() 전에 전체 LED를 다시 훑지 않습니다.
+// 채널 합 -> 최대 밝기는 컴파일 타임 테이블(256 구간, 구간 상한 기준)로 한 번에 조회합니다.
+#define G_C120_POWER_MAX_SUM ((uint32_t)G_C120_TOTAL_NUM_LEDS * 255 * 3)
+
+// 채널 합을 테이블 인덱스(0~255)로 줄이는 시프트
+constexpr uint8_t C120_powerSumShift() {
+	uint8_t v_shift = 0;
+	while ((G_C120_POWER_MAX_SUM >> v_shift) > 255) v_shift++;
+	return v_shift;
+}
+
+struct C120_PowerTable {
+	uint8_t maxBrightness[256];
+};
+
+constexpr C120_PowerTable C120_buildPowerTable() {
+	C120_PowerTable v_table{};
+	const uint32_t v_drive_mA = G_C120_POWER_BUDGET_MA - (uint32_t)G_C120_TOTAL_NUM_LEDS * G_C120_POWER_IDLE_MA_PER_LED;
+	for (uint16_t v_i = 0; v_i < 256; v_i++) {
+		uint64_t v_full = ((uint64_t)(v_i + 1) << C120_powerSumShift()) * G_C120_POWER_MA_PER_CHANNEL; // 구간 최대 합에서 밝기 255 전류 x 255
+		uint64_t v_bright = ((uint64_t)v_drive_mA * 255 * 255) / v_full;
+		v_table.maxBrightness[v_i] = (uint8_t)(v_bright > 255 ? 255 : v_bright);
+	}
+	return v_table;
+}
+
+constexpr C120_PowerTable g_C120_powerTable = C120_buildPowerTable();
+
+static_assert((uint32_t)G_C120_TOTAL_NUM_LEDS * G_C120_POWER_IDLE_MA_PER_LED < G_C120_POWER_BUDGET_MA, "전류 예산이 LED 대기 전류보다 작습니다");
+
+// 현재 버퍼를 예산 안에서 표시할 밝기 (p_userBrightness 이하)
+uint8_t C120_limitBrightness(uint8_t p_userBrightness) {
+	uint8_t v_max = g_C120_powerTable.maxBrightness[g_C120_channelSum >> C120_powerSumShift()];
+	g_C120_appliedBrightness = (v_max < p_userBrightness) ? v_max : p_userBrightness;
+	return g_C120_appliedBrightness;
+}
+
+// 버퍼를 전원 예산 안의 밝기로 표시하는 함수 (FastLED.show() 대신 사용)
+void C120_show() {
+	FastLED.show(C120_limitBrightness(G_C120_BRIGHTNESS));
+}
+
 // 모든 LED를 끄는 함수
 void C120_clearDisplay() {
 	FastLED.clear(); // 모든 LED 색상을 CRGB::Black으로 설정
+	g_C120_channelSum = 0; // 모두 꺼졌으므로 채널 합 초기화
 }
 
 // 특정 픽셀에 색상을 설정하는 함수 (C120_getLedIndex 활용)
 void C120_drawPixel(uint8_t p_matrix_index, uint8_t p_x, uint8_t p_y, CRGB p_color) {
 	int v_index = C120_getLedIndex(p_matrix_index, p_x, p_y);
 	if (v_index != -1) { // 유효한 인덱스일 경우
+		const CRGB& v_old = g_C120_leds[v_index];
+		g_C120_channelSum = g_C120_channelSum - (v_old.r + v_old.g + v_old.b) + (p_color.r + p_color.g + p_color.b); // 바뀐 만큼만 반영
 		g_C120_leds[v_index] = p_color;
 	}
 }
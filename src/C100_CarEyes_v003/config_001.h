@@ -23,6 +23,12 @@
 #define G_C120_NUM_LEDS_PER_MATRIX (G_C120_MATRIX_WIDTH * G_C120_MATRIX_HEIGHT)
 #define G_C120_TOTAL_NUM_LEDS (G_C120_NUM_LEDS_PER_MATRIX * G_C120_NUM_MATRICES) // 전체 LED 개수
 
+// --- LED 전원 예산 설정 (전역 상수: C120) ---
+#define G_C120_BRIGHTNESS 80 // 사용자 밝기 (0-255), 전류 예산을 넘는 프레임은 자동으로 낮춤
+#define G_C120_POWER_BUDGET_MA 1000 // LED 전류 예산 (mA)
+#define G_C120_POWER_MA_PER_CHANNEL 20 // 채널 1개 최대 밝기 전류 (mA, WS2812B)
+#define G_C120_POWER_IDLE_MA_PER_LED 1 // LED 1개 대기 전류 (mA)
+
 // --- IMU 데이터 처리 임계값 (전역 상수: C110) ---
 // 가속도 및 자이로 값 단위는 MPU6050 라이브러리 및 설정에 따라 다름 (Adafruit 라이브러리는 가속도 m/s^2, 자이로 deg/s 기본)
 // 여기서는 MPU6050_RANGE_8_G (가속도 약 8*9.8 m/s^2), MPU6050_RANGE_500_DEG (자이로 500 deg/s) 기준 임계값 예시
@@ -7,6 +7,8 @@
 
 // --- LED Matrix 데이터 (전역 변수: C120) ---
 CRGB g_C120_leds[G_C120_TOTAL_NUM_LEDS]; // 전체 LED를 담을 배열
+uint32_t g_C120_channelSum = 0; // 전체 LED 채널 값(R+G+B) 합 (C120_drawPixel 에서 차이만큼 갱신)
+uint8_t g_C120_appliedBrightness = G_C120_BRIGHTNESS; // 마지막으로 적용한 (전원 제한 후) 밝기
 
 // --- IMU 데이터 및 필터링 결과 (전역 변수: C110) ---
 Adafruit_MPU6050 g_C110_mpu; // MPU6050 객체
@@ -0,0 +1,417 @@
+#pragma once
+// A02_serialMux_001.h -----------------------------
+
+// ====================================================================================================
+// 비블로킹 시리얼 명령 멀티플렉서 (R310, M010 등 한 loop() 에서 도는 모듈이 함께 사용)
+// ====================================================================================================
+// 모듈마다 Serial.readStringUntil('\n') 을 부르면 먼저 읽은 모듈이 줄을 가져가 버리고 (예: "set ..." 가 눈 텍스트로 표시),
+// 줄이 덜 들어온 상태에서는 Stream 타임아웃(기본 1초)만큼 loop() 가 멈춥니다.
+// 이 모듈만 시리얼을 읽습니다. 들어온 바이트만 읽어 고정 크기 줄 링에 조립하고 (String/힙 사용 없음, 블로킹 없음),
+// 완성된 줄을 등록된 모듈 핸들러로 나누어 줍니다.
+//
+// 라우팅 순서
+//   1) "<이름>:<명령>"  : 네임스페이스 지정 (예: "m010:printconfig", "r310:1:angry"), 이름과 ':' 를 떼고 전달
+//   2) 접두사 일치      : 핸들러별 접두사 목록 중 가장 긴 것. ' ' 로 끝나는 접두사는 시작 일치, 아니면 첫 단어 일치
+//                         (예: "set " 는 "set x 1", "printconfig" 는 "printconfig" 만)
+//   3) 기본 핸들러      : 어디에도 맞지 않는 줄 (R310: 눈 명령/텍스트)
+//   "muxstats" 는 멀티플렉서가 직접 처리 (핸들러별 처리 시간 통계 출력)
+//
+// 바이너리 프레임 채널 (A03_frameCodec_001.h: 0x00 | COBS(type seq payload crc16) | 0x00)
+//   텍스트 줄에는 0x00 이 없으므로 0x00 을 받으면 프레임 조립으로 바뀌고, 닫는 0x00 에서 CRC 를 확인한 뒤 type 으로 핸들러를 찾습니다.
+//   프레임 본문은 다음 0x00 까지 memchr/memcpy 로 덩어리째 복사하므로 바이트별 분기가 없습니다.
+//   G_A02_FRAME_TYPE_LINE 프레임은 텍스트 한 줄과 같은 경로로 라우팅합니다. (예: 호스트 도구가 보내는 "smile", "set ...")
+//   모듈별 type 은 A02_serialMux_registerFrames 로 등록 (R310: R310_link_001.h)
+//
+// A02_serialMux_poll() 은 여러 모듈이 loop() 안에서 각각 불러도 됩니다. (읽을 바이트가 없으면 available() 한 번으로 끝남)
+
+#include <Arduino.h>
+#include "A03_frameCodec_001.h"
+
+#define G_A02_SERIALMUX_BAUD            921600  // 시리얼 속도 (바이너리 프레임 스트리밍, main.cpp 에서 A02_serialMux_begin)
+#define G_A02_SERIALMUX_RX_BUFFER       2048    // UART 수신 버퍼 (ESP32, 루프가 몇 ms 멈춰도 프레임이 넘치지 않도록)
+#define G_A02_SERIALMUX_LINE_MAX        96      // 한 줄 최대 길이 (종료 문자 포함, 넘는 줄은 통째로 버림)
+#define G_A02_SERIALMUX_LINE_RING       4       // 완성된 줄 링 크기 (2의 거듭제곱)
+#define G_A02_SERIALMUX_HANDLER_MAX     4       // 등록 가능한 모듈 핸들러 수
+#define G_A02_SERIALMUX_READ_CHUNK      64      // 한 번에 읽는 바이트 (스택 버퍼)
+#define G_A02_SERIALMUX_READ_MAX        1024    // 폴링 한 번에 읽는 최대 바이트 (루프 지연 제한, 나머지는 UART 수신 버퍼에 남음)
+#define G_A02_SERIALMUX_LINES_PER_POLL  1       // 폴링 한 번에 핸들러로 넘기는 최대 줄 수
+#ifndef G_A02_SERIALMUX_FRAME_MAX
+    #define G_A02_SERIALMUX_FRAME_MAX   400     // 받는 프레임 최대 디코딩 길이 (type/seq/CRC 포함, 모듈이 include 전에 늘릴 수 있음)
+#endif
+#define G_A02_SERIALMUX_TX_MAX          128     // 보내는 프레임 최대 페이로드
+
+#define G_A02_FRAME_TYPE_LINE           0x01    // 텍스트 명령 한 줄 (페이로드: 종료 문자 없는 문자열)
+
+static_assert(G_A03_COBS_MAX_LEN(G_A02_SERIALMUX_FRAME_MAX) < 32768, "프레임 최대 길이는 int16_t 로 디코딩할 수 있어야 합니다");
+static_assert((G_A02_SERIALMUX_LINE_RING & (G_A02_SERIALMUX_LINE_RING - 1)) == 0 && G_A02_SERIALMUX_LINE_RING <= 128, "줄 링 크기는 128 이하의 2의 거듭제곱이어야 합니다");
+
+// 줄 핸들러 (앞뒤 공백이 제거되고 네임스페이스가 떼어진 한 줄)
+typedef void (*T_A02_SerialMux_Fn_t)(const char* p_line);
+
+// 프레임 핸들러 (CRC 확인이 끝난 페이로드, 다음 프레임을 받기 전까지만 유효)
+typedef void (*T_A02_SerialMux_FrameFn_t)(uint8_t p_type, const uint8_t* p_payload, uint16_t p_len);
+
+// 모듈 핸들러
+typedef struct {
+    const char*             name;           // 네임스페이스 ("m010" 이면 "m010:..." 줄을 받음)
+    const char* const*      prefixes;       // 라우팅 접두사 목록 (nullptr 로 끝남, 없으면 nullptr)
+    T_A02_SerialMux_Fn_t    fn;             // 줄 핸들러 (없으면 nullptr)
+    bool                    isDefault;      // 어디에도 맞지 않는 줄을 받음
+    T_A02_SerialMux_FrameFn_t frameFn;      // 프레임 핸들러 (없으면 nullptr)
+    uint8_t                 typeFirst;      // 받을 프레임 type 범위
+    uint8_t                 typeLast;
+    // 통계 (처리 시간은 줄/프레임 합산)
+    uint32_t                lines;          // 처리한 줄 수
+    uint32_t                frames;         // 처리한 프레임 수
+    uint32_t                usSum;          // 핸들러 처리 누적 시간 (마이크로초)
+    uint32_t                usMax;          // 핸들러 처리 최대 시간 (마이크로초)
+} T_A02_SerialMux_Handler_t;
+
+// 멀티플렉서 상태
+typedef struct {
+    Stream*                     stream = &Serial;                                           // 읽을 시리얼 포트 (나머지 멤버는 전역이므로 0)
+    char                        ring[G_A02_SERIALMUX_LINE_RING][G_A02_SERIALMUX_LINE_MAX];   // 완성된 줄 링 (조립 중인 줄은 ring[head])
+    uint8_t                     head;           // 다음에 조립할 칸 (자유 증가)
+    uint8_t                     tail;           // 다음에 넘길 칸 (자유 증가)
+    uint8_t                     len;            // 조립 중인 줄 길이
+    bool                        isOverlong;     // 조립 중인 줄/프레임이 넘쳐 끝까지 버리는 중
+    bool                        isFrame;        // 0x00 을 받아 프레임을 조립하는 중
+    bool                        isBinary;       // 지금 넘기는 줄이 G_A02_FRAME_TYPE_LINE 프레임에서 왔는지 (에코 생략 등)
+    uint16_t                    frameLen;       // 조립 중인 프레임 길이 (COBS 인코딩 상태)
+    uint8_t                     frame[G_A03_COBS_MAX_LEN(G_A02_SERIALMUX_FRAME_MAX)];  // 조립 중인 프레임 (닫히면 제자리 디코딩)
+    uint8_t                     rxSeq;          // 마지막으로 받은 프레임 seq
+    bool                        isRxSeqValid;   // rxSeq 유효 여부 (첫 프레임은 빠진 수를 세지 않음)
+    uint8_t                     txSeq;          // 다음에 보낼 프레임 seq
+    T_A02_SerialMux_Handler_t   handlers[G_A02_SERIALMUX_HANDLER_MAX];
+    uint8_t                     handlerCount;
+    // 통계
+    uint32_t                    bytes;          // 읽은 바이트 수
+    uint32_t                    lines;          // 완성된 줄 수
+    uint32_t                    dropsOverlong;  // 길이를 넘어 버린 줄/프레임 수
+    uint32_t                    unrouted;       // 받을 핸들러가 없던 줄/프레임 수
+    uint32_t                    readUsMax;      // 폴링의 읽기/조립 최대 시간 (줄 핸들러 제외, 프레임 핸들러 포함, 마이크로초)
+    uint32_t                    framesOk;       // CRC 가 맞은 프레임 수
+    uint32_t                    framesBad;      // COBS/CRC 오류로 버린 프레임 수
+    uint32_t                    seqGaps;        // seq 로 보아 빠진 프레임 수
+    uint32_t                    txFrames;       // 보낸 프레임 수
+    uint32_t                    txDrops;        // 송신 버퍼가 모자라 보내지 않은 프레임 수
+} T_A02_SerialMux_t;
+
+T_A02_SerialMux_t g_A02_serialMux;
+
+
+// 모듈 핸들러를 등록합니다. 같은 이름으로 다시 부르면 내용을 바꿉니다. (모듈 init 에서 호출)
+// @param p_name 네임스페이스 이름 (':' 없이)
+// @param p_prefixes 라우팅 접두사 목록 (nullptr 로 끝나는 정적 배열, 없으면 nullptr)
+// @param p_isDefault true 이면 어디에도 맞지 않는 줄을 받음 (하나만)
+// @return 등록했으면 true, 핸들러 칸이 모자라면 false
+bool A02_serialMux_register(const char* p_name, const char* const* p_prefixes, T_A02_SerialMux_Fn_t p_fn, bool p_isDefault = false) {
+    T_A02_SerialMux_t*          v_mux     = &g_A02_serialMux;
+    T_A02_SerialMux_Handler_t*  v_handler = nullptr;
+
+    for (uint8_t v_i = 0; v_i < v_mux->handlerCount; v_i++) {
+        if (strcmp(v_mux->handlers[v_i].name, p_name) == 0) v_handler = &v_mux->handlers[v_i];
+    }
+    if (v_handler == nullptr) {
+        if (v_mux->handlerCount >= G_A02_SERIALMUX_HANDLER_MAX) {
+            Serial.printf("serialMux: handler table full (%s)\n", p_name);
+            return false;
+        }
+        v_handler = &v_mux->handlers[v_mux->handlerCount++];
+        memset(v_handler, 0, sizeof(T_A02_SerialMux_Handler_t));
+    }
+    v_handler->name      = p_name;
+    v_handler->prefixes  = p_prefixes;
+    v_handler->fn        = p_fn;
+    v_handler->isDefault = p_isDefault;
+    return true;
+}
+
+// 모듈 프레임 핸들러를 등록합니다. (같은 이름의 줄 핸들러와 통계를 함께 씀)
+// @param p_typeFirst, p_typeLast 받을 프레임 type 범위 (G_A02_FRAME_TYPE_LINE 제외)
+// @return 등록했으면 true, 핸들러 칸이 모자라면 false
+bool A02_serialMux_registerFrames(const char* p_name, uint8_t p_typeFirst, uint8_t p_typeLast, T_A02_SerialMux_FrameFn_t p_fn) {
+    T_A02_SerialMux_t* v_mux = &g_A02_serialMux;
+    uint8_t            v_i   = 0;
+
+    while (v_i < v_mux->handlerCount && strcmp(v_mux->handlers[v_i].name, p_name) != 0) v_i++;
+    if (v_i == v_mux->handlerCount && !A02_serialMux_register(p_name, nullptr, nullptr)) return false;
+    v_mux->handlers[v_i].frameFn   = p_fn;
+    v_mux->handlers[v_i].typeFirst = p_typeFirst;
+    v_mux->handlers[v_i].typeLast  = p_typeLast;
+    return true;
+}
+
+// 시리얼 포트를 엽니다. (main.cpp setup() 에서 Serial.begin 대신)
+void A02_serialMux_begin(unsigned long p_baud = G_A02_SERIALMUX_BAUD) {
+#if defined(ARDUINO_ARCH_ESP32)
+    Serial.setRxBufferSize(G_A02_SERIALMUX_RX_BUFFER); // begin 전에 설정해야 함
+#endif
+    Serial.begin(p_baud);
+}
+
+// 받은 바이트 하나를 조립 중인 줄에 더합니다. CR/LF 로 줄을 끝내며, 빈 줄(CRLF 의 나머지 포함)은 버립니다.
+void A02_serialMux_feed(T_A02_SerialMux_t* p_mux, char p_c) {
+    char* v_line = p_mux->ring[p_mux->head & (G_A02_SERIALMUX_LINE_RING - 1)];
+
+    if (p_c == '\n' || p_c == '\r') {
+        if (p_mux->isOverlong) { // 넘친 줄은 여기까지 버림
+            p_mux->isOverlong = false;
+            p_mux->len        = 0;
+            return;
+        }
+        while (p_mux->len > 0 && (v_line[p_mux->len - 1] == ' ' || v_line[p_mux->len - 1] == '\t')) p_mux->len--;
+        if (p_mux->len == 0) return;
+        v_line[p_mux->len] = '\0';
+        p_mux->len         = 0;
+        p_mux->head++;
+        p_mux->lines++;
+        return;
+    }
+    if (p_mux->isOverlong) return;
+    if (p_mux->len == 0 && (p_c == ' ' || p_c == '\t')) return; // 앞 공백 제거
+    if (p_mux->len >= G_A02_SERIALMUX_LINE_MAX - 1) {
+        p_mux->isOverlong = true;
+        p_mux->dropsOverlong++;
+        return;
+    }
+    v_line[p_mux->len++] = p_c;
+}
+
+// 줄을 받을 핸들러를 찾습니다. 네임스페이스로 찾았으면 *p_line 을 명령 시작으로 옮깁니다.
+// @return 핸들러, 없으면 nullptr
+T_A02_SerialMux_Handler_t* A02_serialMux_route(T_A02_SerialMux_t* p_mux, const char** p_line) {
+    const char*                 v_line    = *p_line;
+    T_A02_SerialMux_Handler_t*  v_best    = nullptr;
+    T_A02_SerialMux_Handler_t*  v_default = nullptr;
+    size_t                      v_bestLen = 0;
+
+    for (uint8_t v_i = 0; v_i < p_mux->handlerCount; v_i++) {
+        T_A02_SerialMux_Handler_t* v_handler = &p_mux->handlers[v_i];
+        size_t                     v_nameLen = strlen(v_handler->name);
+        if (v_handler->fn == nullptr) continue; // 프레임 전용
+
+        // 1) 네임스페이스 "이름:"
+        if (strncmp(v_line, v_handler->name, v_nameLen) == 0 && v_line[v_nameLen] == ':') {
+            v_line += v_nameLen + 1;
+            while (*v_line == ' ') v_line++;
+            *p_line = v_line;
+            return v_handler;
+        }
+        // 2) 접두사 (가장 긴 일치)
+        for (const char* const* v_prefix = v_handler->prefixes; v_prefix != nullptr && *v_prefix != nullptr; v_prefix++) {
+            size_t v_len = strlen(*v_prefix);
+            if (v_len <= v_bestLen || strncmp(v_line, *v_prefix, v_len) != 0) continue;
+            if ((*v_prefix)[v_len - 1] != ' ' && v_line[v_len] != '\0' && v_line[v_len] != ' ') continue; // 첫 단어 일치만
+            v_best    = v_handler;
+            v_bestLen = v_len;
+        }
+        if (v_handler->isDefault) v_default = v_handler;
+    }
+    // 3) 기본 핸들러
+    return (v_best != nullptr) ? v_best : v_default;
+}
+
+// 멀티플렉서 통계 출력 (핸들러별 처리 시간)
+void A02_serialMux_printStats() {
+    const T_A02_SerialMux_t* v_mux = &g_A02_serialMux;
+
+    Serial.printf("serialMux: bytes %lu, lines %lu, drops overlong %lu, unrouted %lu, read max %lu us, pending %u\n",
+                  (unsigned long)v_mux->bytes, (unsigned long)v_mux->lines, (unsigned long)v_mux->dropsOverlong,
+                  (unsigned long)v_mux->unrouted, (unsigned long)v_mux->readUsMax, (unsigned)(uint8_t)(v_mux->head - v_mux->tail));
+    Serial.printf("serialMux frames: rx ok %lu, bad %lu, seq gaps %lu, tx %lu (drops %lu)\n",
+                  (unsigned long)v_mux->framesOk, (unsigned long)v_mux->framesBad, (unsigned long)v_mux->seqGaps,
+                  (unsigned long)v_mux->txFrames, (unsigned long)v_mux->txDrops);
+    for (uint8_t v_i = 0; v_i < v_mux->handlerCount; v_i++) {
+        const T_A02_SerialMux_Handler_t* v_handler = &v_mux->handlers[v_i];
+        uint32_t                         v_count   = v_handler->lines + v_handler->frames;
+        Serial.printf("  %-6s%s lines %lu, frames %lu, avg %lu us, max %lu us\n", v_handler->name, v_handler->isDefault ? "*" : " ",
+                      (unsigned long)v_handler->lines, (unsigned long)v_handler->frames,
+                      (unsigned long)(v_count ? v_handler->usSum / v_count : 0), (unsigned long)v_handler->usMax);
+    }
+}
+
+// 핸들러 처리 시간을 기록합니다.
+void A02_serialMux_noteUs(T_A02_SerialMux_Handler_t* p_handler, uint32_t p_startUs) {
+    uint32_t v_us = micros() - p_startUs;
+    p_handler->usSum += v_us;
+    if (v_us > p_handler->usMax) p_handler->usMax = v_us;
+}
+
+// 완성된 줄 하나를 핸들러로 넘기고 처리 시간을 기록합니다.
+void A02_serialMux_dispatch(T_A02_SerialMux_t* p_mux, const char* p_line) {
+    if (strcmp(p_line, "muxstats") == 0) {
+        A02_serialMux_printStats();
+        return;
+    }
+
+    const char*                v_line    = p_line;
+    T_A02_SerialMux_Handler_t* v_handler = A02_serialMux_route(p_mux, &v_line);
+    if (v_handler == nullptr) {
+        p_mux->unrouted++;
+        Serial.printf("serialMux: no handler for '%s'\n", p_line);
+        return;
+    }
+
+    uint32_t v_startUs = micros();
+    v_handler->fn(v_line);
+    v_handler->lines++;
+    A02_serialMux_noteUs(v_handler, v_startUs);
+}
+
+// 닫는 0x00 을 받은 프레임을 디코딩하고 CRC 를 확인한 뒤 type 에 맞는 핸들러로 넘깁니다.
+void A02_serialMux_endFrame(T_A02_SerialMux_t* p_mux) {
+    if (p_mux->frameLen == 0 && !p_mux->isOverlong) return; // 연속된 구분자 (다음 프레임 시작), 프레임 조립 유지
+
+    bool     v_isOverlong = p_mux->isOverlong;
+    uint16_t v_encLen     = p_mux->frameLen;
+    p_mux->isFrame    = false;
+    p_mux->isOverlong = false;
+    p_mux->frameLen   = 0;
+    if (v_isOverlong) return;
+
+    int16_t v_len = A03_cobs_decode(p_mux->frame, v_encLen);
+    if (v_len < G_A03_FRAME_OVERHEAD ||
+        A03_crc16(p_mux->frame, v_len - G_A03_FRAME_CRC_LEN) != (uint16_t)(p_mux->frame[v_len - 2] | (p_mux->frame[v_len - 1] << 8))) {
+        p_mux->framesBad++;
+        return;
+    }
+    p_mux->framesOk++;
+    if (p_mux->isRxSeqValid) p_mux->seqGaps += (uint8_t)(p_mux->frame[1] - p_mux->rxSeq - 1);
+    p_mux->rxSeq        = p_mux->frame[1];
+    p_mux->isRxSeqValid = true;
+
+    uint8_t  v_type       = p_mux->frame[0];
+    uint8_t* v_payload    = &p_mux->frame[G_A03_FRAME_HEADER_LEN];
+    uint16_t v_payloadLen = (uint16_t)(v_len - G_A03_FRAME_OVERHEAD);
+
+    if (v_type == G_A02_FRAME_TYPE_LINE) { // CRC 자리에 종료 문자를 써서 줄로 넘김
+        v_payload[v_payloadLen] = '\0';
+        p_mux->isBinary = true;
+        A02_serialMux_dispatch(p_mux, (const char*)v_payload);
+        p_mux->isBinary = false;
+        return;
+    }
+    for (uint8_t v_i = 0; v_i < p_mux->handlerCount; v_i++) {
+        T_A02_SerialMux_Handler_t* v_handler = &p_mux->handlers[v_i];
+        if (v_handler->frameFn == nullptr || v_type < v_handler->typeFirst || v_type > v_handler->typeLast) continue;
+        uint32_t v_startUs = micros();
+        v_handler->frameFn(v_type, v_payload, v_payloadLen);
+        v_handler->frames++;
+        A02_serialMux_noteUs(v_handler, v_startUs);
+        return;
+    }
+    p_mux->unrouted++;
+}
+
+// 링 맨 앞의 완성된 줄을 핸들러로 넘기고 칸을 반환합니다.
+void A02_serialMux_dispatchNext(T_A02_SerialMux_t* p_mux) {
+    A02_serialMux_dispatch(p_mux, p_mux->ring[p_mux->tail & (G_A02_SERIALMUX_LINE_RING - 1)]);
+    p_mux->tail++; // 핸들러가 끝난 뒤 칸 반환
+}
+
+// 읽은 바이트 덩어리를 줄/프레임으로 조립합니다.
+// 프레임 조립 중에는 다음 0x00 까지 한 번에 복사하고, 텍스트는 바이트 단위로 줄 링에 넣습니다.
+void A02_serialMux_feedBytes(T_A02_SerialMux_t* p_mux, const uint8_t* p_data, uint16_t p_len) {
+    uint16_t v_pos = 0;
+
+    while (v_pos < p_len) {
+        if (p_mux->isFrame) {
+            const uint8_t* v_end = (const uint8_t*)memchr(&p_data[v_pos], 0, p_len - v_pos);
+            uint16_t       v_n   = (v_end != nullptr) ? (uint16_t)(v_end - &p_data[v_pos]) : (uint16_t)(p_len - v_pos);
+            if (!p_mux->isOverlong) {
+                if (p_mux->frameLen + v_n > sizeof(p_mux->frame)) {
+                    p_mux->isOverlong = true;
+                    p_mux->dropsOverlong++;
+                } else {
+                    memcpy(&p_mux->frame[p_mux->frameLen], &p_data[v_pos], v_n);
+                    p_mux->frameLen += v_n;
+                }
+            }
+            v_pos += v_n;
+            if (v_end != nullptr) {
+                v_pos++;
+                A02_serialMux_endFrame(p_mux);
+            }
+            continue;
+        }
+
+        uint8_t v_c = p_data[v_pos++];
+        if (v_c == 0) { // 프레임 시작 (조립 중이던 텍스트 조각은 버림)
+            p_mux->len        = 0;
+            p_mux->isOverlong = false;
+            p_mux->isFrame    = true;
+            p_mux->frameLen   = 0;
+            continue;
+        }
+        if ((uint8_t)(p_mux->head - p_mux->tail) >= G_A02_SERIALMUX_LINE_RING) A02_serialMux_dispatchNext(p_mux); // 링이 가득 차면 맨 앞 줄부터 처리
+        A02_serialMux_feed(p_mux, (char)v_c);
+    }
+}
+
+// 프레임 하나를 보냅니다. 송신 버퍼가 모자라면 기다리지 않고 버립니다. (loop 태스크에서 호출)
+// @param p_len 페이로드 길이 (G_A02_SERIALMUX_TX_MAX 이하)
+// @return 보냈으면 true
+bool A02_serialMux_sendFrame(uint8_t p_type, const uint8_t* p_payload, uint16_t p_len) {
+    T_A02_SerialMux_t* v_mux = &g_A02_serialMux;
+    uint8_t            v_raw[G_A02_SERIALMUX_TX_MAX + G_A03_FRAME_OVERHEAD];
+    uint8_t            v_enc[G_A03_COBS_MAX_LEN(G_A02_SERIALMUX_TX_MAX + G_A03_FRAME_OVERHEAD) + 2];
+
+    if (p_len > G_A02_SERIALMUX_TX_MAX) return false;
+    v_raw[0] = p_type;
+    v_raw[1] = v_mux->txSeq;
+    memcpy(&v_raw[G_A03_FRAME_HEADER_LEN], p_payload, p_len);
+    uint16_t v_crc = A03_crc16(v_raw, G_A03_FRAME_HEADER_LEN + p_len);
+    v_raw[G_A03_FRAME_HEADER_LEN + p_len]     = (uint8_t)v_crc;
+    v_raw[G_A03_FRAME_HEADER_LEN + p_len + 1] = (uint8_t)(v_crc >> 8);
+
+    uint16_t v_encLen = A03_cobs_encode(v_raw, p_len + G_A03_FRAME_OVERHEAD, &v_enc[1]);
+    v_enc[0]            = 0;
+    v_enc[v_encLen + 1] = 0;
+    if (v_mux->stream->availableForWrite() < v_encLen + 2) {
+        v_mux->txDrops++;
+        return false;
+    }
+    v_mux->stream->write(v_enc, v_encLen + 2);
+    v_mux->txSeq++;
+    v_mux->txFrames++;
+    return true;
+}
+
+// 지금 넘기는 줄이 바이너리 프레임(G_A02_FRAME_TYPE_LINE)에서 왔는지 (줄 핸들러에서 에코를 생략할 때)
+bool A02_serialMux_isBinary() {
+    return g_A02_serialMux.isBinary;
+}
+
+// 처리할 입력이 남아 있는지 (링의 완성된 줄 또는 UART 수신 버퍼, 있으면 loop 대기를 건너뛰어 다음 폴링에서 바로 처리)
+bool A02_serialMux_hasPending() {
+    return g_A02_serialMux.tail != g_A02_serialMux.head || g_A02_serialMux.stream->available() > 0;
+}
+
+// 들어온 바이트만 읽어 줄/프레임을 조립합니다. (블로킹 없음)
+// 프레임은 닫히는 즉시 핸들러로 넘기고, 완성된 줄은 G_A02_SERIALMUX_LINES_PER_POLL 개까지 넘깁니다.
+void A02_serialMux_poll() {
+    T_A02_SerialMux_t* v_mux     = &g_A02_serialMux;
+    uint32_t           v_startUs = micros();
+    uint16_t           v_read    = 0;
+    uint8_t            v_chunk[G_A02_SERIALMUX_READ_CHUNK];
+
+    while (v_read < G_A02_SERIALMUX_READ_MAX) {
+        int v_avail = v_mux->stream->available();
+        if (v_avail <= 0) break;
+        uint16_t v_n = (v_avail < G_A02_SERIALMUX_READ_CHUNK) ? (uint16_t)v_avail : G_A02_SERIALMUX_READ_CHUNK;
+        v_n = (uint16_t)v_mux->stream->readBytes((char*)v_chunk, v_n); // 수신 버퍼에 있는 만큼만 요청하므로 기다리지 않음
+        if (v_n == 0) break;
+        A02_serialMux_feedBytes(v_mux, v_chunk, v_n);
+        v_read += v_n;
+    }
+    if (v_read > 0) {
+        uint32_t v_readUs = micros() - v_startUs;
+        v_mux->bytes += v_read;
+        if (v_readUs > v_mux->readUsMax) v_mux->readUsMax = v_readUs;
+    }
+
+    for (uint8_t v_n = 0; v_n < G_A02_SERIALMUX_LINES_PER_POLL && v_mux->tail != v_mux->head; v_n++) {
+        A02_serialMux_dispatchNext(v_mux);
+    }
+}
@@ -0,0 +1,93 @@
+#pragma once
+// A03_frameCodec_001.h -----------------------------
+
+// ====================================================================================================
+// 바이너리 프레임 코덱 (COBS + CRC16), A02_serialMux_001.h 의 프레임 채널과 호스트 도구(shared/R310_serialLink.py)가 같은 규칙 사용
+// ====================================================================================================
+// 선로 형식:  0x00 | COBS( type | seq | payload... | crc16 lo | crc16 hi ) | 0x00
+//   - COBS 로 0x00 을 없애므로 0x00 은 프레임 구분자로만 쓰이고, 텍스트 줄(0x00 없음)과 한 포트에서 섞여도 구분됩니다.
+//   - CRC16 은 CCITT-FALSE (다항식 0x1021, 초기값 0xFFFF, 반사 없음), type 부터 payload 끝까지
+//   - seq 는 보내는 쪽이 프레임마다 1 씩 올림 (받는 쪽은 빠진 프레임 수만 셈)
+
+#include <Arduino.h>
+
+#define G_A03_FRAME_HEADER_LEN      2       // type, seq
+#define G_A03_FRAME_CRC_LEN         2
+#define G_A03_FRAME_OVERHEAD        (G_A03_FRAME_HEADER_LEN + G_A03_FRAME_CRC_LEN)
+
+// 디코딩 길이 p_len 인 프레임의 최대 COBS 인코딩 길이 (구분자 제외)
+#define G_A03_COBS_MAX_LEN(p_len)   ((p_len) + (p_len) / 254 + 1)
+
+// CRC16 바이트 테이블 (빌드 시 생성, 바이트당 테이블 조회 한 번)
+typedef struct {
+    uint16_t    value[256];
+} T_A03_Crc16Table_t;
+
+constexpr T_A03_Crc16Table_t A03_crc16_buildTable() {
+    T_A03_Crc16Table_t v_table = {};
+    for (uint16_t v_i = 0; v_i < 256; v_i++) {
+        uint16_t v_crc = (uint16_t)(v_i << 8);
+        for (uint8_t v_bit = 0; v_bit < 8; v_bit++) {
+            v_crc = (v_crc & 0x8000) ? (uint16_t)((v_crc << 1) ^ 0x1021) : (uint16_t)(v_crc << 1);
+        }
+        v_table.value[v_i] = v_crc;
+    }
+    return v_table;
+}
+
+constexpr T_A03_Crc16Table_t g_A03_crc16Table = A03_crc16_buildTable();
+
+static_assert(g_A03_crc16Table.value[1] == 0x1021 && g_A03_crc16Table.value[255] == 0x1EF0, "CRC16 테이블 생성 오류");
+
+
+// CRC16-CCITT-FALSE (p_crc 에 이전 결과를 넘기면 이어서 계산)
+uint16_t A03_crc16(const uint8_t* p_data, uint16_t p_len, uint16_t p_crc = 0xFFFF) {
+    for (uint16_t v_i = 0; v_i < p_len; v_i++) {
+        p_crc = (uint16_t)((p_crc << 8) ^ g_A03_crc16Table.value[(uint8_t)(p_crc >> 8) ^ p_data[v_i]]);
+    }
+    return p_crc;
+}
+
+// COBS 인코딩 (구분자는 붙이지 않음)
+// @param p_dst G_A03_COBS_MAX_LEN(p_len) 바이트 이상
+// @return 인코딩 길이
+uint16_t A03_cobs_encode(const uint8_t* p_src, uint16_t p_len, uint8_t* p_dst) {
+    uint16_t v_codePos = 0;
+    uint16_t v_out     = 1;
+    uint8_t  v_code    = 1;
+
+    for (uint16_t v_i = 0; v_i < p_len; v_i++) {
+        if (p_src[v_i] == 0) {
+            p_dst[v_codePos] = v_code;
+            v_codePos        = v_out++;
+            v_code           = 1;
+            continue;
+        }
+        p_dst[v_out++] = p_src[v_i];
+        if (++v_code == 0xFF) { // 0 없는 254 바이트 블록
+            p_dst[v_codePos] = v_code;
+            v_codePos        = v_out++;
+            v_code           = 1;
+        }
+    }
+    p_dst[v_codePos] = v_code;
+    return v_out;
+}
+
+// COBS 디코딩 (제자리, 출력은 항상 입력보다 짧음)
+// @param p_len 구분자를 뺀 인코딩 길이
+// @return 디코딩 길이, 인코딩이 잘못되었으면 -1
+int16_t A03_cobs_decode(uint8_t* p_buf, uint16_t p_len) {
+    uint16_t v_in  = 0;
+    uint16_t v_out = 0;
+
+    while (v_in < p_len) {
+        uint8_t v_code = p_buf[v_in++];
+        if (v_code == 0 || v_in + v_code - 1 > p_len) return -1;
+        memmove(&p_buf[v_out], &p_buf[v_in], v_code - 1); // 블록 단위 복사
+        v_in  += v_code - 1;
+        v_out += v_code - 1;
+        if (v_code != 0xFF && v_in < p_len) p_buf[v_out++] = 0;
+    }
+    return (int16_t)v_out;
+}
@@ -0,0 +1,118 @@
+#pragma once
+// A04_rtcSnapshot_001.h -----------------------------
+
+// ====================================================================================================
+// RTC 메모리 상태 스냅샷 (R310 애니메이션, M010 차량 상태 머신이 함께 사용)
+// ====================================================================================================
+// 딥슬립 복귀, 워치독/패닉/소프트웨어 리셋 뒤에도 RTC 저속 메모리(RTC_NOINIT_ATTR)의 값은 남아 있으므로,
+// 모듈이 상태를 작은 구조체로 저장해 두면 다음 부팅에서 초기 상태(EMT_NEUTRAL, E_M010_CARMOVESTATE_UNKNOWN) 대신 이어서 시작합니다.
+// (라이트슬립은 RAM 이 그대로 유지되므로 스냅샷이 필요 없음)
+//
+// 스냅샷 = 헤더(매직, 버전, 길이, CRC16, 저장 시각) + 본문 (모듈별 구조체, 포인터/millis 절대 시간 없이 상대 시간만)
+//   - 전원 투입/브라운아웃 리셋이면 RTC 메모리가 쓰레기 값이므로 읽지 않음 (A04_rtc_isWarmBoot)
+//   - 매직/버전/길이/CRC 가 하나라도 다르면 버림 (펌웨어 구조 변경 시 모듈이 버전을 올림)
+//   - 복원할 때마다 resumeCount 를 올리고, 저장할 때는 그대로 넘겨 줌: 부팅 후 G_A04_RTC_STABLE_MS 동안 리셋 없이
+//     돌았거나 새로 만든 스냅샷(매직/버전 불일치, 콜드 부팅)일 때만 0 으로 되돌림.
+//     복원한 상태로 G_A04_RTC_RESUME_MAX 번 연속 리셋되면 (복원 상태 때문에 멈추는 경우) 스냅샷을 버리고 처음부터 시작
+//
+// 저장 시각은 시스템 시간(gettimeofday, ESP32 는 RTC 타이머 기반이라 딥슬립/소프트웨어 리셋 동안에도 흐름)으로 남기므로,
+// 복원하는 모듈은 A04_rtc_elapsedMs 로 꺼져 있던 시간만큼 정차 시간/잠들기 타이머를 늘릴 수 있습니다.
+//
+// 저장은 CRC16 테이블 계산 한 번 (A03_frameCodec_001.h, 수백 바이트에 수 us), 복원은 검사 + memcpy 입니다.
+
+#include <Arduino.h>
+#include <sys/time.h>
+#include "A03_frameCodec_001.h"
+
+#if defined(ARDUINO_ARCH_ESP32)
+    #include <esp_system.h>
+    #define G_A04_RTC_NOINIT        RTC_NOINIT_ATTR // RTC 저속 메모리, 부팅 시 초기화하지 않음
+#else
+    #define G_A04_RTC_NOINIT                        // 호스트/기타 보드: 일반 RAM (리셋하면 사라짐)
+#endif
+
+#define G_A04_RTC_RESUME_MAX        3       // 저장 없이 연속 복원할 수 있는 횟수 (복원 상태로 리셋이 반복되면 버림)
+#define G_A04_RTC_STABLE_MS         10000   // 복원 후 이 시간(부팅 후 millis) 동안 리셋 없이 돌면 안정된 것으로 보고 복원 횟수를 0 으로
+#define G_A04_RTC_ELAPSED_MAX_MS    (7UL * 24 * 3600 * 1000)   // 이보다 긴 경과 시간은 시계 변경(SNTP 등)으로 보고 0 으로 처리
+
+// 스냅샷 헤더 (본문 앞에 둠)
+typedef struct {
+    uint32_t    magic;              // 모듈 식별 ("R310", "M010" 등)
+    uint16_t    version;            // 본문 구조 버전
+    uint16_t    len;                // 본문 길이 (바이트)
+    uint16_t    crc;                // 본문 CRC16
+    uint8_t     resumeCount;        // 안정적으로 돈 이후 연속 복원 횟수
+    uint8_t     reserved;
+    uint32_t    timeMs;             // 저장 시각 (시스템 시간, 밀리초 하위 32비트)
+} T_A04_RtcHeader_t;
+
+
+// 시스템 시간 (밀리초 하위 32비트, millis 와 달리 재부팅해도 0 으로 돌아가지 않음)
+uint32_t A04_rtc_timeMs() {
+    struct timeval v_tv;
+    gettimeofday(&v_tv, nullptr);
+    return (uint32_t)((int64_t)v_tv.tv_sec * 1000 + v_tv.tv_usec / 1000);
+}
+
+
+// 이번 부팅에서 RTC 메모리를 믿을 수 있는지 (딥슬립 복귀, 워치독/패닉/소프트웨어 리셋)
+bool A04_rtc_isWarmBoot() {
+#if defined(ARDUINO_ARCH_ESP32)
+    switch (esp_reset_reason()) {
+        case ESP_RST_DEEPSLEEP:
+        case ESP_RST_SW:
+        case ESP_RST_PANIC:
+        case ESP_RST_INT_WDT:
+        case ESP_RST_TASK_WDT:
+        case ESP_RST_WDT:
+            return true;
+        default:
+            return false; // 전원 투입, 브라운아웃, 외부 리셋 핀
+    }
+#else
+    return true;
+#endif
+}
+
+// 본문을 저장한 뒤 헤더를 봉인합니다. (본문은 호출 전에 이미 채워져 있어야 함, resumeCount 는 위 규칙대로 유지/초기화)
+void A04_rtc_seal(T_A04_RtcHeader_t* p_header, uint32_t p_magic, uint16_t p_version, const void* p_body, uint16_t p_len) {
+    // 같은 스냅샷을 이어 쓰는 중이면 복원 횟수를 넘겨 주고, 부팅 후 충분히 오래 돌았을 때만 0 으로 (크래시 루프 방지)
+    bool v_isSame = p_header->magic == p_magic && p_header->version == p_version && p_header->len == p_len;
+    if (!v_isSame || millis() >= G_A04_RTC_STABLE_MS) p_header->resumeCount = 0;
+
+    p_header->magic       = p_magic;
+    p_header->version     = p_version;
+    p_header->len         = p_len;
+    p_header->crc         = A03_crc16((const uint8_t*)p_body, p_len);
+    p_header->reserved    = 0;
+    p_header->timeMs      = A04_rtc_timeMs();
+}
+
+// 스냅샷을 확인하고 복원 횟수를 올립니다. (딥슬립 복귀 제외)
+// @return 본문을 복원해도 되면 true (false 면 스냅샷을 무효로 만듦)
+bool A04_rtc_open(T_A04_RtcHeader_t* p_header, uint32_t p_magic, uint16_t p_version, const void* p_body, uint16_t p_len) {
+    bool v_isValid = A04_rtc_isWarmBoot() &&
+                     p_header->magic == p_magic && p_header->version == p_version && p_header->len == p_len &&
+                     p_header->resumeCount < G_A04_RTC_RESUME_MAX &&
+                     A03_crc16((const uint8_t*)p_body, p_len) == p_header->crc;
+    if (!v_isValid) {
+        p_header->magic = 0;
+        return false;
+    }
+#if defined(ARDUINO_ARCH_ESP32)
+    if (esp_reset_reason() == ESP_RST_DEEPSLEEP) return true; // 딥슬립 복귀는 의도한 재시작이므로 크래시 루프로 세지 않음
+#endif
+    p_header->resumeCount++;
+    return true;
+}
+
+// 스냅샷을 저장한 뒤 지난 시간 (리셋/딥슬립으로 꺼져 있던 시간 포함, A04_rtc_open 성공 뒤 호출)
+uint32_t A04_rtc_elapsedMs(const T_A04_RtcHeader_t* p_header) {
+    uint32_t v_elapsed = A04_rtc_timeMs() - p_header->timeMs;
+    return (v_elapsed > G_A04_RTC_ELAPSED_MAX_MS) ? 0 : v_elapsed;
+}
+
+// 스냅샷을 지웁니다. (다음 부팅은 처음부터, 예: 설정 초기화)
+void A04_rtc_invalidate(T_A04_RtcHeader_t* p_header) {
+    p_header->magic = 0;
+}
@@ -14,6 +14,8 @@
 //#define DEBUG_P2 // 필요에 따라 추가적인 디버그 레벨/모듈을 정의할 수 있습니다.
 
 #include "A01_debug_001.h" // 디버그 출력을 위한 라이브러리 포함
+#include "A02_serialMux_001.h" // 모듈 공용 비블로킹 시리얼 멀티플렉서 (R310 눈 명령과 한 포트를 나눠 씀)
+#include "A04_rtcSnapshot_001.h" // 리셋/딥슬립 후 상태 머신을 이어서 시작하는 RTC 메모리 스냅샷
 
 #define G_M010_STREAM_USE
 #ifdef G_M010_STREAM_USE
@@ -73,7 +75,11 @@ const float G_M010_GRAVITY_MPS2         = 9.80665;  // 중력 가속도 (m/s^2)
 const float G_M010_RAD_TO_DEG           = 180.0 / M_PI; // 라디안을 도로 변환하는 상수
 const float G_M010_GYRO_SCALE_FACTOR    = 131.0;    // MPU6050 자이로 스케일 팩터 (deg/s 변환)
 const float G_M010_MPS_TO_KMH_FACTOR    = 3.6;      // m/s를 km/h로 변환하는 상수
-const uint16_t G_M010_DMP_PACKET_SIZE   = 42;       // MPU6050 DMP FIFO 패킷 크기 (바이트)
+const uint16_t G_M010_DMP_PACKET_SIZE_MAX = 42;     // DMP FIFO 패킷 크기 상한 (실제 크기는 dmpGetFIFOPacketSize(), MotionApps612 는 28 바이트)
+const uint16_t G_M010_DMP_OUTPUT_RATE_HZ = 100;     // DMP 패킷 출력 주기 (MotionApps612 기본: 200Hz 샘플 / (1 + MPU6050_DMP_FIFO_RATE_DIVISOR 1))
+const uint16_t G_M010_DMP_FIFO_SIZE     = 1024;     // MPU6050 내부 FIFO 크기 (바이트)
+const uint16_t G_M010_DMP_BURST_BYTES   = 126;      // I2C 한 번에 읽는 최대 바이트 (ESP32 Wire 버퍼 128 바이트 이내, 28 바이트 패킷이면 4개)
+const uint8_t  G_M010_MPU_INT_FIFO_OFLOW = 0x10;    // INT_STATUS 레지스터의 FIFO 오버플로 비트 (MPU6050_INTERRUPT_FIFO_OFLOW_BIT)
 const uint32_t G_M010_I2C_CLOCK_FREQ    = 400000;   // I2C 통신 속도 (Hz)
 
 // 설정값을 담을 구조체 정의
@@ -191,9 +197,19 @@ T_M010_CarStatus g_M010_CarStatus; // 자동차 상태 구조체 인스턴스
 bool        g_M010_dmp_isReady          = false;    // DMP 초기화 완료 여부 플래그
 uint8_t     g_M010_mpu_interruptStatus;             // MPU6050 인터럽트 상태 레지스터 값
 uint8_t     g_M010_dmp_devStatus;                   // 장치 상태 (0=성공, >0=오류 코드)
-uint16_t    g_M010_dmp_fifoCount;                   // FIFO에 저장된 바이트 수
-uint8_t     g_M010_dmp_fifoBuffer[64];              // FIFO 버퍼 (최대 64바이트)
-uint16_t    g_M010_dmp_packetSize;                  // DMP 패킷의 크기 (바이트)
+uint16_t    g_M010_dmp_fifoCount;                   // FIFO에 저장된 바이트 수 (마지막 드레인 후 남은 값)
+uint8_t     g_M010_dmp_fifoBuffer[G_M010_DMP_BURST_BYTES]; // FIFO 버스트 읽기 버퍼
+uint16_t    g_M010_dmp_packetSize;                  // DMP 패킷의 크기 (바이트, dmpInitialize 후 라이브러리에서 읽음)
+uint8_t     g_M010_dmp_burstPackets;                // I2C 한 번에 읽는 패킷 수 (G_M010_DMP_BURST_BYTES / 패킷 크기)
+
+static_assert(G_M010_DMP_BURST_BYTES >= G_M010_DMP_PACKET_SIZE_MAX, "FIFO 버스트 버퍼에 가장 큰 DMP 패킷이 들어가야 합니다");
+
+// DMP FIFO 드레인 통계 (M010_CarStatus_print 에서 출력)
+u_int32_t   g_M010_dmp_drainCount       = 0;        // 패킷을 하나 이상 읽은 드레인 횟수
+u_int32_t   g_M010_dmp_packetCount      = 0;        // 처리한 전체 패킷 수
+u_int32_t   g_M010_dmp_overflowCount    = 0;        // FIFO 오버플로로 FIFO 를 비운 횟수
+uint8_t     g_M010_dmp_lastDrainPackets = 0;        // 마지막 드레인에서 처리한 패킷 수
+uint8_t     g_M010_dmp_maxDrainPackets  = 0;        // 출력 주기 동안 한 번에 처리한 최대 패킷 수 (출력 후 0)
 
 
 // 쿼터니언 및 오일러 각 관련 변수
@@ -219,6 +235,43 @@ u_int32_t   g_M010_stateTransitionStartTime_ms = 0; // 메인 상태 전환 조
 static T_M010_CarTurnState  g_M010_potentialTurnState    = E_M010_CARTURNSTATE_CENTER;   // 잠재적 회전 상태
 static u_int32_t            g_M010_turnStateStartTime_ms = 0;                    // 잠재적 회전 상태가 시작된 시간 (ms)
 
+// ====================================================================================================
+// RTC 메모리 상태 스냅샷 (A04_rtcSnapshot_001.h)
+// 딥슬립/워치독 리셋 후 E_M010_CARMOVESTATE_UNKNOWN 에서 다시 수렴하지 않고 움직임/회전 상태, 추정 속도, 정차 시간을 이어갑니다.
+// 시간은 저장 시점 기준 경과 시간으로 저장하고 (millis 는 재부팅하면 0 부터), 정차 시간에는 꺼져 있던 시간도 더합니다.
+// ====================================================================================================
+#define G_M010_SNAP_MAGIC           0x3031304D  // "M010"
+#define G_M010_SNAP_VERSION         1           // 아래 구조체를 바꾸면 올림
+#define G_M010_SNAP_PERIOD_MS       500         // 상태가 바뀌지 않아도 저장하는 주기 (밀리초, 추정 속도/필터 값 갱신)
+#define G_M010_SNAP_SPEED_KEEP_MS   2000        // 꺼져 있던 시간이 이보다 길면 추정 속도는 버리고 움직임 상태를 다시 인식
+#define G_M010_SNAP_TIME_NONE       0xFFFFFFFF  // 시간 기록 없음 (원래 변수의 0 값)
+
+typedef struct {
+    uint8_t     carMovementState;               // T_M010_CarMovementState
+    uint8_t     carTurnState;                   // T_M010_CarTurnState
+    uint8_t     potentialTurnState;             // 안정화 대기 중인 회전 상태
+    uint8_t     reserved;
+    float       speed_kmh;                      // 추정 속도 (가속도 적분 값, 다시 0 부터 적분하지 않도록)
+    float       yawAngle_deg;
+    float       pitchAngle_deg;
+    float       filteredAx;                     // 가속도 필터 상태
+    float       filteredAy;
+    float       filteredAz;
+    u_int32_t   sinceStopStart;                 // 저장 시점 기준 경과 시간 (G_M010_SNAP_TIME_NONE: 기록 없음)
+    u_int32_t   sinceLastMovement;
+    u_int32_t   sinceStopStableStart;
+    u_int32_t   sinceStateTransitionStart;
+    u_int32_t   sinceTurnStateStart;
+} T_M010_SnapBody_t;
+
+typedef struct {
+    T_A04_RtcHeader_t   header;
+    T_M010_SnapBody_t   body;
+} T_M010_Snapshot_t;
+
+G_A04_RTC_NOINIT T_M010_Snapshot_t  g_M010_snapshot;                // 리셋/딥슬립 후에도 유지
+u_int32_t                           g_M010_snapTime_ms      = 0;    // 마지막 저장 시간 (ms)
+
 // MPU6050 인터럽트 발생 여부 플래그 및 인터럽트 서비스 루틴 (ISR)
 volatile bool g_M010_mpu_isInterrupt = false; // MPU6050 인터럽트 발생 여부 (true = 데이터 준비됨)
 
@@ -232,9 +285,13 @@ void M010_Config_initDefaults();                            // 설정값 기본
 bool M010_Config_load();                                    // LittleFS에서 설정값 로드
 bool M010_Config_save();                                    // LittleFS에 설정값 저장
 void M010_Config_print();                                   // 현재 설정값 시리얼 출력
-void M010_Config_handleSerialInput();                       // 시리얼 입력 처리 (설정 변경/저장/로드)
+void M010_Config_handleSerialLine(const char* p_line);      // 시리얼 명령 한 줄 처리 (설정 변경/저장/로드, 멀티플렉서 핸들러)
 
 void M010_GlobalVar_init();                                 // 전역 변수 초기화
+u_int32_t M010_snap_since(u_int32_t p_time_ms, u_int32_t p_currentTime_ms); // 시간 기록 -> 경과 시간 (스냅샷 저장용)
+u_int32_t M010_snap_at(u_int32_t p_since_ms, u_int32_t p_base_ms);          // 경과 시간 -> 시간 기록 (스냅샷 복원용)
+void M010_snap_save(u_int32_t p_currentTime_ms);            // 상태 머신을 RTC 메모리 스냅샷으로 저장
+bool M010_snap_restore();                                   // RTC 메모리 스냅샷에서 상태 머신 복원 (M010_GlobalVar_init 뒤)
 
 void M010_dmpDataReady_cb() ;
 void M010_MPU6050_init() ;
@@ -242,6 +299,7 @@ void M010_init();
 
 
 void M010_MPU_Read_Data(u_int32_t* p_currentTime_ms);     // MPU6050 데이터를 읽고 자동차 상태를 업데이트하는 함수
+void M010_MPU_processPacket(const uint8_t* p_packet, u_int32_t p_sampleTime_ms, float p_deltaTime_s); // DMP 패킷 하나를 필터/적분에 반영
 void M010_CarMoveState_Recognize(u_int32_t p_currentTime_ms);       // 차량 움직임 상태 정의 함수 (정지, 전진, 후진 등)
 void M010_CarTurnState_Recognize(u_int32_t p_currentTime_ms);   // 차량 회전 상태 정의 함수 (직진, 좌/우회전 정도)
 void M010_CarStatus_print();
@@ -258,6 +316,9 @@ void M010_run() ;
  */
 void M010_dmpDataReady_cb() {
     g_M010_mpu_isInterrupt = true; // 인터럽트 발생 시 플래그 설정
+    #ifdef R310
+        R310_sched_notifyFromISR(); // 다음 마감까지 대기 중인 루프를 바로 깨워 FIFO 를 읽게 함
+    #endif
 }
 
 
@@ -289,7 +350,13 @@ void M010_MPU6050_init() {
         attachInterrupt(digitalPinToInterrupt(G_M010_MPU_INTERRUPT_PIN), M010_dmpDataReady_cb, RISING);
         g_M010_mpu_interruptStatus = g_M010_Mpu.getIntStatus(); // 현재 인터럽트 상태 가져오기
 
-        g_M010_dmp_packetSize = G_M010_DMP_PACKET_SIZE; // DMP에서 출력하는 FIFO 패킷의 크기 (MotionApps612 기준, 상수 사용)
+        // DMP에서 출력하는 FIFO 패킷의 크기 (라이브러리 펌웨어가 정함, MotionApps612: 쿼터니언+가속도+자이로 28 바이트)
+        g_M010_dmp_packetSize = g_M010_Mpu.dmpGetFIFOPacketSize();
+        if (g_M010_dmp_packetSize == 0 || g_M010_dmp_packetSize > G_M010_DMP_PACKET_SIZE_MAX) {
+            dbgP1_printf_F(F("DMP 패킷 크기 오류 (%u 바이트)\n"), g_M010_dmp_packetSize);
+            while (true); // 버스트 버퍼에 들어가지 않으므로 초기화 실패와 같이 처리
+        }
+        g_M010_dmp_burstPackets = (uint8_t)(G_M010_DMP_BURST_BYTES / g_M010_dmp_packetSize);
 
         g_M010_dmp_isReady = true; // DMP 초기화 완료 플래그 설정
         dbgP1_println_F(F("DMP 초기화 완료!"));
@@ -567,91 +634,96 @@ void M010_Config_print() {
     dbgP1_println_F(F("설정 보기: printconfig"));
 }
 
+// 시리얼 멀티플렉서(A02_serialMux_001.h)에서 이 모듈로 보낼 명령 (그 밖의 줄은 R310 눈 명령, "m010:<명령>" 으로도 지정 가능)
+const char* const G_M010_SERIAL_PREFIXES[] = { "set ", "saveconfig", "loadconfig", "printconfig", "resetconfig", nullptr };
+
 /**
- * @brief 시리얼 포트로부터 명령어를 읽어 설정값을 변경하거나 저장/로드/초기화합니다.
+ * @brief 시리얼 멀티플렉서가 넘겨준 명령 한 줄로 설정값을 변경하거나 저장/로드/초기화합니다.
  * 사용자가 시리얼 모니터를 통해 시스템 파라미터를 동적으로 제어할 수 있도록 합니다.
+ * 줄 조립은 멀티플렉서가 비블로킹으로 하므로, 여기서는 String 없이 받은 줄을 그대로 나눕니다.
  * 명령어 형식: "set <항목이름> <값>", "saveconfig", "loadconfig", "printconfig", "resetconfig"
+ * @param p_line 앞뒤 공백이 제거된 명령 한 줄
  */
-void M010_Config_handleSerialInput() {
-    if (Serial.available()) {
-        String v_serial_input = Serial.readStringUntil('\n');
-        v_serial_input.trim(); // 앞뒤 공백 제거
-        dbgP1_printf_F(F("시리얼 입력: %s\n"), v_serial_input.c_str());
-
-        if (v_serial_input.startsWith("set ")) {
-            int firstSpace = v_serial_input.indexOf(' ');
-            int secondSpace = v_serial_input.indexOf(' ', firstSpace + 1);
-            if (firstSpace != -1 && secondSpace != -1) {
-                String paramName = v_serial_input.substring(firstSpace + 1, secondSpace);
-                String valueStr = v_serial_input.substring(secondSpace + 1);
-                
-                // 문자열을 적절한 타입으로 변환하여 설정값 업데이트
-                // 각 설정 항목에 대해 문자열 비교 및 타입 변환을 수행
-                if      (paramName.equals("mvState_accelFilter_Alpha"               )) g_M010_Config.mvState_accelFilter_Alpha = valueStr.toFloat();
-                else if (paramName.equals("mvState_Forward_speedKmh_Threshold_Min"  )) g_M010_Config.mvState_Forward_speedKmh_Threshold_Min = valueStr.toFloat();
-                else if (paramName.equals("mvState_Reverse_speedKmh_Threshold_Min"  )) g_M010_Config.mvState_Reverse_speedKmh_Threshold_Min = valueStr.toFloat();
-                else if (paramName.equals("mvState_Stop_speedKmh_Threshold_Max"     )) g_M010_Config.mvState_Stop_speedKmh_Threshold_Max = valueStr.toFloat();
-                else if (paramName.equals("mvState_Stop_accelMps2_Threshold_Max"    )) g_M010_Config.mvState_Stop_accelMps2_Threshold_Max = valueStr.toFloat();
-                else if (paramName.equals("mvState_Stop_gyroDps_Threshold_Max"      )) g_M010_Config.mvState_Stop_gyroDps_Threshold_Max = valueStr.toFloat();
-                else if (paramName.equals("mvState_stop_durationMs_Stable_Min"      )) g_M010_Config.mvState_stop_durationMs_Stable_Min = valueStr.toInt();
-                else if (paramName.equals("mvState_move_durationMs_Stable_Min"      )) g_M010_Config.mvState_move_durationMs_Stable_Min = valueStr.toInt();
-                else if (paramName.equals("mvState_normalMove_durationMs"           )) g_M010_Config.mvState_normalMove_durationMs = valueStr.toInt();
-                else if (paramName.equals("mvState_Decel_accelMps2_Threshold"       )) g_M010_Config.mvState_Decel_accelMps2_Threshold = valueStr.toFloat();
-                else if (paramName.equals("mvState_Bump_accelMps2_Threshold"        )) g_M010_Config.mvState_Bump_accelMps2_Threshold = valueStr.toFloat();
-                else if (paramName.equals("mvState_Bump_SpeedKmh_Min"               )) g_M010_Config.mvState_Bump_SpeedKmh_Min = valueStr.toFloat();
-                else if (paramName.equals("mvState_Bump_CooldownMs"                 )) g_M010_Config.mvState_Bump_CooldownMs = valueStr.toInt();
-                else if (paramName.equals("mvState_Decel_durationMs_Hold"           )) g_M010_Config.mvState_Decel_durationMs_Hold = valueStr.toInt();
-                else if (paramName.equals("mvState_Bump_durationMs_Hold"            )) g_M010_Config.mvState_Bump_durationMs_Hold = valueStr.toInt();
-                else if (paramName.equals("mvState_PeriodMs_stopGrace"              )) g_M010_Config.mvState_PeriodMs_stopGrace = valueStr.toInt();
-                else if (paramName.equals("mvState_signalWait1_Seconds"             )) g_M010_Config.mvState_signalWait1_Seconds = valueStr.toInt();
-                else if (paramName.equals("mvState_signalWait2_Seconds"             )) g_M010_Config.mvState_signalWait2_Seconds = valueStr.toInt();
-                else if (paramName.equals("mvState_stopped1_Seconds"                )) g_M010_Config.mvState_stopped1_Seconds = valueStr.toInt();
-                else if (paramName.equals("mvState_stopped2_Seconds"                )) g_M010_Config.mvState_stopped2_Seconds = valueStr.toInt();
-                else if (paramName.equals("mvState_park_Seconds"                    )) g_M010_Config.mvState_park_Seconds = valueStr.toInt();
-                else if (paramName.equals("serialPrint_intervalMs"                  )) g_M010_Config.serialPrint_intervalMs = valueStr.toInt();
-                else if (paramName.equals("turnState_Center_yawAngleVelocityDegps_Thresold" )) g_M010_Config.turnState_Center_yawAngleVelocityDegps_Thresold = valueStr.toFloat();
-                else if (paramName.equals("turnState_LR_1_yawAngleVelocityDegps_Thresold"   )) g_M010_Config.turnState_LR_1_yawAngleVelocityDegps_Thresold = valueStr.toFloat();
-                else if (paramName.equals("turnState_LR_2_yawAngleVelocityDegps_Thresold"   )) g_M010_Config.turnState_LR_2_yawAngleVelocityDegps_Thresold = valueStr.toFloat();
-                else if (paramName.equals("turnState_LR_3_yawAngleVelocityDegps_Thresold"   )) g_M010_Config.turnState_LR_3_yawAngleVelocityDegps_Thresold = valueStr.toFloat();
-                else if (paramName.equals("turnState_speedKmh_MinSpeed"             )) g_M010_Config.turnState_speedKmh_MinSpeed = valueStr.toFloat();
-                else if (paramName.equals("turnState_speedKmh_HighSpeed_Threshold"  )) g_M010_Config.turnState_speedKmh_HighSpeed_Threshold = valueStr.toFloat();
-                else if (paramName.equals("turnState_StableDurationMs"              )) g_M010_Config.turnState_StableDurationMs = valueStr.toInt();
-                else {
-                    dbgP1_printf_F(F("알 수 없는 설정 항목: %s\n"), paramName.c_str());
-                    return;
-                }
-                dbgP1_printf_F(F("설정 변경됨: %s = %s\n"), paramName.c_str(), valueStr.c_str());
-            } else {
-                dbgP1_println_F(F("잘못된 'set' 명령어 형식. 예: set mvState_accelFilter_Alpha 0.9"));
-            }
-        } else if (v_serial_input.equals("saveconfig")) {
-            if (M010_Config_save()) {
-                dbgP1_println_F(F("설정값이 LittleFS에 저장되었습니다."));
-            } else {
-                dbgP1_println_F(F("설정값 저장 실패!"));
-            }
-        } else if (v_serial_input.equals("loadconfig")) {
-            if (M010_Config_load()) {
-                dbgP1_println_F(F("설정값이 LittleFS에서 로드되었습니다."));
-                M010_Config_print(); // 로드 후 현재 설정값 출력
-            } else {
-                dbgP1_println_F(F("설정값 로드 실패! 기본값이 사용됩니다."));
-                M010_Config_initDefaults(); // 로드 실패 시 기본값으로 초기화
-                M010_Config_print();
-            }
-        } else if (v_serial_input.equals("printconfig")) {
-            M010_Config_print();
-        } else if (v_serial_input.equals("resetconfig")) {
-            M010_Config_initDefaults(); // 설정값을 기본값으로 초기화
-            if (M010_Config_save()) { // 초기화된 기본값을 파일에 저장
-                 dbgP1_println_F(F("설정값이 기본값으로 초기화되고 저장되었습니다."));
-            } else {
-                dbgP1_println_F(F("설정 초기화 후 저장 실패!"));
+void M010_Config_handleSerialLine(const char* p_line) {
+    dbgP1_printf_F(F("시리얼 입력: %s\n"), p_line);
+
+    if (strncmp(p_line, "set ", 4) == 0) {
+        const char* v_nameStart = p_line + 4;
+        while (*v_nameStart == ' ') v_nameStart++;
+        const char* v_nameEnd   = strchr(v_nameStart, ' ');
+        char        paramName[64];
+        if (v_nameEnd != nullptr && (size_t)(v_nameEnd - v_nameStart) < sizeof(paramName)) {
+            memcpy(paramName, v_nameStart, v_nameEnd - v_nameStart);
+            paramName[v_nameEnd - v_nameStart] = '\0';
+            const char* valueStr = v_nameEnd + 1;
+            while (*valueStr == ' ') valueStr++;
+
+            // 문자열을 적절한 타입으로 변환하여 설정값 업데이트
+            // 각 설정 항목에 대해 문자열 비교 및 타입 변환을 수행
+            if      (strcmp(paramName, "mvState_accelFilter_Alpha"               ) == 0) g_M010_Config.mvState_accelFilter_Alpha = atof(valueStr);
+            else if (strcmp(paramName, "mvState_Forward_speedKmh_Threshold_Min"  ) == 0) g_M010_Config.mvState_Forward_speedKmh_Threshold_Min = atof(valueStr);
+            else if (strcmp(paramName, "mvState_Reverse_speedKmh_Threshold_Min"  ) == 0) g_M010_Config.mvState_Reverse_speedKmh_Threshold_Min = atof(valueStr);
+            else if (strcmp(paramName, "mvState_Stop_speedKmh_Threshold_Max"     ) == 0) g_M010_Config.mvState_Stop_speedKmh_Threshold_Max = atof(valueStr);
+            else if (strcmp(paramName, "mvState_Stop_accelMps2_Threshold_Max"    ) == 0) g_M010_Config.mvState_Stop_accelMps2_Threshold_Max = atof(valueStr);
+            else if (strcmp(paramName, "mvState_Stop_gyroDps_Threshold_Max"      ) == 0) g_M010_Config.mvState_Stop_gyroDps_Threshold_Max = atof(valueStr);
+            else if (strcmp(paramName, "mvState_stop_durationMs_Stable_Min"      ) == 0) g_M010_Config.mvState_stop_durationMs_Stable_Min = atol(valueStr);
+            else if (strcmp(paramName, "mvState_move_durationMs_Stable_Min"      ) == 0) g_M010_Config.mvState_move_durationMs_Stable_Min = atol(valueStr);
+            else if (strcmp(paramName, "mvState_normalMove_durationMs"           ) == 0) g_M010_Config.mvState_normalMove_durationMs = atol(valueStr);
+            else if (strcmp(paramName, "mvState_Decel_accelMps2_Threshold"       ) == 0) g_M010_Config.mvState_Decel_accelMps2_Threshold = atof(valueStr);
+            else if (strcmp(paramName, "mvState_Bump_accelMps2_Threshold"        ) == 0) g_M010_Config.mvState_Bump_accelMps2_Threshold = atof(valueStr);
+            else if (strcmp(paramName, "mvState_Bump_SpeedKmh_Min"               ) == 0) g_M010_Config.mvState_Bump_SpeedKmh_Min = atof(valueStr);
+            else if (strcmp(paramName, "mvState_Bump_CooldownMs"                 ) == 0) g_M010_Config.mvState_Bump_CooldownMs = atol(valueStr);
+            else if (strcmp(paramName, "mvState_Decel_durationMs_Hold"           ) == 0) g_M010_Config.mvState_Decel_durationMs_Hold = atol(valueStr);
+            else if (strcmp(paramName, "mvState_Bump_durationMs_Hold"            ) == 0) g_M010_Config.mvState_Bump_durationMs_Hold = atol(valueStr);
+            else if (strcmp(paramName, "mvState_PeriodMs_stopGrace"              ) == 0) g_M010_Config.mvState_PeriodMs_stopGrace = atol(valueStr);
+            else if (strcmp(paramName, "mvState_signalWait1_Seconds"             ) == 0) g_M010_Config.mvState_signalWait1_Seconds = atol(valueStr);
+            else if (strcmp(paramName, "mvState_signalWait2_Seconds"             ) == 0) g_M010_Config.mvState_signalWait2_Seconds = atol(valueStr);
+            else if (strcmp(paramName, "mvState_stopped1_Seconds"                ) == 0) g_M010_Config.mvState_stopped1_Seconds = atol(valueStr);
+            else if (strcmp(paramName, "mvState_stopped2_Seconds"                ) == 0) g_M010_Config.mvState_stopped2_Seconds = atol(valueStr);
+            else if (strcmp(paramName, "mvState_park_Seconds"                    ) == 0) g_M010_Config.mvState_park_Seconds = atol(valueStr);
+            else if (strcmp(paramName, "serialPrint_intervalMs"                  ) == 0) g_M010_Config.serialPrint_intervalMs = atol(valueStr);
+            else if (strcmp(paramName, "turnState_Center_yawAngleVelocityDegps_Thresold" ) == 0) g_M010_Config.turnState_Center_yawAngleVelocityDegps_Thresold = atof(valueStr);
+            else if (strcmp(paramName, "turnState_LR_1_yawAngleVelocityDegps_Thresold"   ) == 0) g_M010_Config.turnState_LR_1_yawAngleVelocityDegps_Thresold = atof(valueStr);
+            else if (strcmp(paramName, "turnState_LR_2_yawAngleVelocityDegps_Thresold"   ) == 0) g_M010_Config.turnState_LR_2_yawAngleVelocityDegps_Thresold = atof(valueStr);
+            else if (strcmp(paramName, "turnState_LR_3_yawAngleVelocityDegps_Thresold"   ) == 0) g_M010_Config.turnState_LR_3_yawAngleVelocityDegps_Thresold = atof(valueStr);
+            else if (strcmp(paramName, "turnState_speedKmh_MinSpeed"             ) == 0) g_M010_Config.turnState_speedKmh_MinSpeed = atof(valueStr);
+            else if (strcmp(paramName, "turnState_speedKmh_HighSpeed_Threshold"  ) == 0) g_M010_Config.turnState_speedKmh_HighSpeed_Threshold = atof(valueStr);
+            else if (strcmp(paramName, "turnState_StableDurationMs"              ) == 0) g_M010_Config.turnState_StableDurationMs = atol(valueStr);
+            else {
+                dbgP1_printf_F(F("알 수 없는 설정 항목: %s\n"), paramName);
+                return;
             }
+            dbgP1_printf_F(F("설정 변경됨: %s = %s\n"), paramName, valueStr);
+        } else {
+            dbgP1_println_F(F("잘못된 'set' 명령어 형식. 예: set mvState_accelFilter_Alpha 0.9"));
+        }
+    } else if (strcmp(p_line, "saveconfig") == 0) {
+        if (M010_Config_save()) {
+            dbgP1_println_F(F("설정값이 LittleFS에 저장되었습니다."));
+        } else {
+            dbgP1_println_F(F("설정값 저장 실패!"));
+        }
+    } else if (strcmp(p_line, "loadconfig") == 0) {
+        if (M010_Config_load()) {
+            dbgP1_println_F(F("설정값이 LittleFS에서 로드되었습니다."));
+            M010_Config_print(); // 로드 후 현재 설정값 출력
+        } else {
+            dbgP1_println_F(F("설정값 로드 실패! 기본값이 사용됩니다."));
+            M010_Config_initDefaults(); // 로드 실패 시 기본값으로 초기화
             M010_Config_print();
+        }
+    } else if (strcmp(p_line, "printconfig") == 0) {
+        M010_Config_print();
+    } else if (strcmp(p_line, "resetconfig") == 0) {
+        M010_Config_initDefaults(); // 설정값을 기본값으로 초기화
+        if (M010_Config_save()) { // 초기화된 기본값을 파일에 저장
+             dbgP1_println_F(F("설정값이 기본값으로 초기화되고 저장되었습니다."));
         } else {
-            dbgP1_println_F(F("알 수 없는 명령어입니다. 'help'를 입력하여 명령어 목록을 보세요."));
+            dbgP1_println_F(F("설정 초기화 후 저장 실패!"));
         }
+        M010_Config_print();
+    } else {
+        dbgP1_println_F(F("알 수 없는 명령어입니다. 'printconfig'를 입력하여 명령어 목록을 보세요."));
     }
 }
 
@@ -684,6 +756,12 @@ void M010_GlobalVar_init(){
 
     // 시간 관련 전역 변수 초기화
     g_M010_lastSampleTime_ms                = 0;      
+    g_M010_dmp_fifoCount                    = 0;
+    g_M010_dmp_drainCount                   = 0;
+    g_M010_dmp_packetCount                  = 0;
+    g_M010_dmp_overflowCount                = 0;
+    g_M010_dmp_lastDrainPackets             = 0;
+    g_M010_dmp_maxDrainPackets              = 0;
     g_M010_lastSerialPrintTime_ms           = 0; 
     g_M010_lastBumpDetectionTime_ms         = 0; 
     g_M010_lastDecelDetectionTime_ms        = 0; 
@@ -694,6 +772,94 @@ void M010_GlobalVar_init(){
     g_M010_turnStateStartTime_ms            = 0;
 }
 
+/**
+ * @brief 시간 기록을 저장 시점 기준 경과 시간으로 바꿉니다. (0 은 '기록 없음')
+ */
+u_int32_t M010_snap_since(u_int32_t p_time_ms, u_int32_t p_currentTime_ms) {
+    return (p_time_ms == 0) ? G_M010_SNAP_TIME_NONE : (p_currentTime_ms - p_time_ms);
+}
+
+/**
+ * @brief 경과 시간을 이번 부팅의 millis() 기준 시간 기록으로 되돌립니다.
+ * @param p_base_ms 스냅샷 저장 시점에 해당하는 millis() 값 (꺼져 있던 시간만큼 과거, 음수면 감싸짐)
+ */
+u_int32_t M010_snap_at(u_int32_t p_since_ms, u_int32_t p_base_ms) {
+    if (p_since_ms == G_M010_SNAP_TIME_NONE) return 0;
+    u_int32_t v_time_ms = p_base_ms - p_since_ms;
+    return (v_time_ms == 0) ? 1 : v_time_ms; // 0 은 '기록 없음' 이므로 피함
+}
+
+/**
+ * @brief 자동차 상태 머신을 RTC 메모리 스냅샷으로 저장합니다.
+ * 상태가 바뀌었거나 G_M010_SNAP_PERIOD_MS 가 지났을 때 M010_run 에서 호출됩니다. (CRC 계산 포함 수 us)
+ * @param p_currentTime_ms 현재 시간 (millis() 값)
+ */
+void M010_snap_save(u_int32_t p_currentTime_ms) {
+    T_M010_SnapBody_t* v_body = &g_M010_snapshot.body;
+
+    v_body->carMovementState          = (uint8_t)g_M010_CarStatus.carMovementState;
+    v_body->carTurnState              = (uint8_t)g_M010_CarStatus.carTurnState;
+    v_body->potentialTurnState        = (uint8_t)g_M010_potentialTurnState;
+    v_body->reserved                  = 0;
+    v_body->speed_kmh                 = g_M010_CarStatus.speed_kmh;
+    v_body->yawAngle_deg              = g_M010_CarStatus.yawAngle_deg;
+    v_body->pitchAngle_deg            = g_M010_CarStatus.pitchAngle_deg;
+    v_body->filteredAx                = g_M010_filteredAx;
+    v_body->filteredAy                = g_M010_filteredAy;
+    v_body->filteredAz                = g_M010_filteredAz;
+    v_body->sinceStopStart            = M010_snap_since(g_M010_CarStatus.stopStartTime_ms, p_currentTime_ms);
+    v_body->sinceLastMovement         = M010_snap_since(g_M010_CarStatus.lastMovementTime_ms, p_currentTime_ms);
+    v_body->sinceStopStableStart      = M010_snap_since(g_M010_CarStatus.stopStableStartTime_ms, p_currentTime_ms);
+    v_body->sinceStateTransitionStart = M010_snap_since(g_M010_stateTransitionStartTime_ms, p_currentTime_ms);
+    v_body->sinceTurnStateStart       = M010_snap_since(g_M010_turnStateStartTime_ms, p_currentTime_ms);
+
+    A04_rtc_seal(&g_M010_snapshot.header, G_M010_SNAP_MAGIC, G_M010_SNAP_VERSION, v_body, sizeof(T_M010_SnapBody_t));
+    g_M010_snapTime_ms = p_currentTime_ms;
+}
+
+/**
+ * @brief RTC 메모리 스냅샷에서 자동차 상태 머신을 복원합니다. (M010_GlobalVar_init 뒤에 호출)
+ * 정차 시간에는 꺼져 있던 시간을 더하므로 주차 중 딥슬립을 반복해도 PARKED 까지 이어서 셉니다.
+ * 오래 꺼져 있었으면 (G_M010_SNAP_SPEED_KEEP_MS) 추정 속도와 전진/후진 상태는 믿을 수 없으므로 버리고 다시 인식합니다.
+ * @return 복원했으면 true (스냅샷이 없거나 맞지 않으면 false, 초기 상태 유지)
+ */
+bool M010_snap_restore() {
+    if (!A04_rtc_open(&g_M010_snapshot.header, G_M010_SNAP_MAGIC, G_M010_SNAP_VERSION, &g_M010_snapshot.body, sizeof(T_M010_SnapBody_t))) return false;
+
+    const T_M010_SnapBody_t* v_body    = &g_M010_snapshot.body;
+    u_int32_t                v_now_ms  = millis();
+    u_int32_t                v_off_ms  = A04_rtc_elapsedMs(&g_M010_snapshot.header);
+
+    g_M010_CarStatus.carMovementState       = (T_M010_CarMovementState)v_body->carMovementState;
+    g_M010_CarStatus.carTurnState           = (T_M010_CarTurnState)v_body->carTurnState;
+    g_M010_potentialTurnState               = (T_M010_CarTurnState)v_body->potentialTurnState;
+    g_M010_CarStatus.speed_kmh              = v_body->speed_kmh;
+    g_M010_CarStatus.yawAngle_deg           = v_body->yawAngle_deg;
+    g_M010_CarStatus.pitchAngle_deg         = v_body->pitchAngle_deg;
+    g_M010_filteredAx                       = v_body->filteredAx;
+    g_M010_filteredAy                       = v_body->filteredAy;
+    g_M010_filteredAz                       = v_body->filteredAz;
+    g_M010_CarStatus.stopStartTime_ms       = M010_snap_at(v_body->sinceStopStart, v_now_ms - v_off_ms);
+    g_M010_CarStatus.lastMovementTime_ms    = M010_snap_at(v_body->sinceLastMovement, v_now_ms - v_off_ms);
+    g_M010_CarStatus.stopStableStartTime_ms = M010_snap_at(v_body->sinceStopStableStart, v_now_ms - v_off_ms);
+    g_M010_stateTransitionStartTime_ms      = M010_snap_at(v_body->sinceStateTransitionStart, v_now_ms - v_off_ms);
+    g_M010_turnStateStartTime_ms            = M010_snap_at(v_body->sinceTurnStateStart, v_now_ms - v_off_ms);
+
+    if (v_off_ms > G_M010_SNAP_SPEED_KEEP_MS) {
+        g_M010_CarStatus.speed_kmh          = 0.0;
+        g_M010_CarStatus.carTurnState       = E_M010_CARTURNSTATE_CENTER;
+        g_M010_potentialTurnState           = E_M010_CARTURNSTATE_CENTER;
+        g_M010_stateTransitionStartTime_ms  = 0;
+        if (g_M010_CarStatus.carMovementState == E_M010_CARMOVESTATE_FORWARD ||
+            g_M010_CarStatus.carMovementState == E_M010_CARMOVESTATE_REVERSE) {
+            g_M010_CarStatus.carMovementState = E_M010_CARMOVESTATE_UNKNOWN; // 정차 세부 상태는 정차 시간으로 다시 판정
+            g_M010_CarStatus.stopStartTime_ms = v_now_ms;
+        }
+    }
+    g_M010_snapTime_ms = v_now_ms;
+    return true;
+}
+
 /**
  * @brief ESP32가 시작될 때 한 번 실행되는 초기 설정 함수입니다.
  * LittleFS를 통한 설정값 로드 및 MPU6050 센서 초기화를 담당합니다.
@@ -711,101 +877,160 @@ void M010_init() {
     M010_MPU6050_init(); // MPU6050 센서 초기화 (DMP 포함)
 
     M010_GlobalVar_init(); // 모든 전역 변수를 초기 상태로 설정
+    if (M010_snap_restore()) { // 딥슬립/워치독 리셋 전 상태에서 이어서 시작
+        dbgP1_printf_F(F("RTC 스냅샷에서 차량 상태 복원: move %d, turn %d, %.1f km/h\n"),
+                       g_M010_CarStatus.carMovementState, g_M010_CarStatus.carTurnState, g_M010_CarStatus.speed_kmh);
+    }
+
+    A02_serialMux_register("m010", G_M010_SERIAL_PREFIXES, M010_Config_handleSerialLine); // 설정 명령 줄을 이 모듈로
 	
     dbgP1_println_F(F("Setup 완료!"));
 }
 
 /**
- * @brief MPU6050 데이터를 읽고 자동차의 가속도, 속도, 각도, 각속도 등을 업데이트합니다.
- * DMP FIFO 버퍼에서 데이터를 가져와 쿼터니언, 오일러 각, 선형 가속도 등을 계산합니다.
- * 상보 필터 및 속도 드리프트 보정 로직이 적용됩니다.
+ * @brief MPU6050 DMP FIFO 에 쌓인 패킷을 모두 읽어 순서대로 처리합니다. (드레인)
+ * dmpGetCurrentFIFOPacket 은 최신 패킷 하나만 남기고 버리므로, 루프가 느려지면 (웹 UI, 시리얼 출력, LED 표시)
+ * 샘플을 잃고 속도 적분의 시간 간격도 커집니다. 대신 FIFO 바이트 수를 한 번 읽고, 쌓인 패킷을
+ * g_M010_dmp_burstPackets 개씩(G_M010_DMP_BURST_BYTES 이내) I2C 한 번에 읽어 M010_MPU_processPacket 으로 넘깁니다.
+ * 각 패킷의 시간 간격은 DMP 출력 주기(G_M010_DMP_OUTPUT_RATE_HZ)로 고정하고, 마지막 패킷을 현재 시간으로 보고 거꾸로 시각을 매깁니다.
+ * 쓰는 중인 패킷의 일부 바이트는 FIFO 에 남겨 두고, FIFO 가 넘쳤을 때만 비우고 다음 패킷부터 다시 시작합니다. (잃은 구간은 적분하지 않음)
  * @param p_currentTime_ms 현재 시간을 저장할 u_int32_t 포인터 (millis() 값으로 업데이트 됨)
  */
 void M010_MPU_Read_Data(u_int32_t* p_currentTime_ms) {
     if (!g_M010_dmp_isReady) return; // DMP가 준비되지 않았으면 데이터 처리 스킵
 
-    // MPU6050 인터럽트가 발생했거나, FIFO 버퍼에 최소 한 개 이상의 완전한 DMP 패킷이 있는지 확인
-    // (g_M010_mpu_isInterrupt는 ISR에서 설정, g_M010_dmp_fifoCount는 MPU 내부 FIFO의 바이트 수)
+    // MPU6050 인터럽트가 발생했거나, FIFO 버퍼에 최소 한 개 이상의 완전한 DMP 패킷이 남아 있는지 확인
+    // (g_M010_mpu_isInterrupt는 ISR에서 설정, g_M010_dmp_fifoCount는 마지막 드레인 후 남은 FIFO 바이트 수)
     if (!g_M010_mpu_isInterrupt && g_M010_dmp_fifoCount < g_M010_dmp_packetSize) {
         return; // 데이터가 없으면 함수 종료
     }
     
     g_M010_mpu_isInterrupt = false; // 인터럽트 플래그 초기화 (다음 인터럽트를 위해)
 
-    // DMP FIFO에서 최신 패킷을 읽어옴
-    if (g_M010_Mpu.dmpGetCurrentFIFOPacket(g_M010_dmp_fifoBuffer)) { 
-		*p_currentTime_ms           = millis(); // 현재 시간 가져오기
-		
-        // 샘플링 시간 간격 계산 (이전 샘플링 시간과 현재 시간의 차이). 속도 추정 등에 사용.
-		float v_deltaTime_s         = (*p_currentTime_ms - g_M010_lastSampleTime_ms) / 1000.0f;
-        g_M010_lastSampleTime_ms    = *p_currentTime_ms; // 마지막 샘플링 시간 업데이트
-
-        // 쿼터니언 (방향 정보를 효율적으로 표현), Yaw/Pitch/Roll (오일러 각), 중력 벡터 계산
-        g_M010_Mpu.dmpGetQuaternion(&g_M010_Quaternion, g_M010_dmp_fifoBuffer);
-        g_M010_Mpu.dmpGetGravity(&g_M010_gravity, &g_M010_Quaternion); 
-        g_M010_Mpu.dmpGetYawPitchRoll(g_M010_ypr, &g_M010_Quaternion, &g_M010_gravity);
-
-        // Yaw, Pitch 각도를 라디안에서 도로 변환하여 저장
-        g_M010_CarStatus.yawAngle_deg   = g_M010_ypr[0] * G_M010_RAD_TO_DEG;
-        g_M010_CarStatus.pitchAngle_deg = g_M010_ypr[1] * G_M010_RAD_TO_DEG;
-
-        // 선형 가속도 (중력분 제거) 계산
-        VectorInt16 v_accel_raw;        // Raw 가속도 (MPU6050 내부 데이터 형식)
-        VectorInt16 v_accel_linear;     // 중력분이 제거된 선형 가속도 결과
-
-        g_M010_Mpu.dmpGetAccel(&v_accel_raw, g_M010_dmp_fifoBuffer);                        // Raw 가속도 얻기
-        g_M010_Mpu.dmpGetLinearAccel(&v_accel_linear, &v_accel_raw, &g_M010_gravity);       // 선형 가속도 계산
-
-        // 계산된 선형 가속도를 m/s^2 단위로 변환 (중력 가속도 G_M010_GRAVITY_MPS2 곱함)
-        float v_currentAx_ms2 = (float)v_accel_linear.x * (G_M010_GRAVITY_MPS2 / 16384.0f); // MPU6050 가속도 센서 2g 스케일 기준 (16384 LSB/g)
-        float v_currentAy_ms2 = (float)v_accel_linear.y * (G_M010_GRAVITY_MPS2 / 16384.0f); 
-        float v_currentAz_ms2 = (float)v_accel_linear.z * (G_M010_GRAVITY_MPS2 / 16384.0f); 
-
-        // 상보 필터를 사용하여 가속도 데이터 평활화 (노이즈 감소)
-        // alpha 값이 높을수록 이전 값의 영향이 크고, 낮을수록 현재 값의 영향이 커짐.
-        g_M010_filteredAx = g_M010_Config.mvState_accelFilter_Alpha * g_M010_filteredAx + (1 - g_M010_Config.mvState_accelFilter_Alpha) * v_currentAx_ms2;
-        g_M010_filteredAy = g_M010_Config.mvState_accelFilter_Alpha * g_M010_filteredAy + (1 - g_M010_Config.mvState_accelFilter_Alpha) * v_currentAy_ms2;
-        g_M010_filteredAz = g_M010_Config.mvState_accelFilter_Alpha * g_M010_filteredAz + (1 - g_M010_Config.mvState_accelFilter_Alpha) * v_currentAz_ms2;
-
-        // 필터링된 가속도 값을 자동차 상태 구조체에 저장
-        g_M010_CarStatus.accelX_ms2 = g_M010_filteredAx;
-        g_M010_CarStatus.accelY_ms2 = g_M010_filteredAy;
-        g_M010_CarStatus.accelZ_ms2 = g_M010_filteredAz;
-
-        // Yaw 각속도 (Z축 자이로 데이터) 계산
-        VectorInt16 v_Gyro_raw; // 자이로 데이터
-        g_M010_Mpu.dmpGetGyro(&v_Gyro_raw, g_M010_dmp_fifoBuffer); // Raw 자이로 데이터 얻기
-
-        // 자이로 스케일 팩터 (G_M010_GYRO_SCALE_FACTOR)를 이용하여 deg/s 단위로 변환
-        g_M010_yawAngleVelocity_degps           = (float)v_Gyro_raw.z / G_M010_GYRO_SCALE_FACTOR; 
-        g_M010_CarStatus.yawAngleVelocity_degps = g_M010_yawAngleVelocity_degps;
-
-        // 속도 추정 (Y축 가속도 적분)
-        // 이 방법은 오차 누적(드리프트) 가능성이 있으므로, 정지 시 보정 로직이 필수적입니다.
-        float v_speedChange_mps     = g_M010_CarStatus.accelY_ms2 * v_deltaTime_s;
-        g_M010_CarStatus.speed_kmh += (v_speedChange_mps * G_M010_MPS_TO_KMH_FACTOR); // m/s를 km/h로 변환하여 누적
-
-        // 정지 시 속도 드리프트 보정 강화 로직
-        // 가속도 및 각속도 변화가 모두 임계값 이하로 충분히 오래 유지될 때만 속도를 0으로 설정
-        if (fabs(g_M010_CarStatus.accelY_ms2) < g_M010_Config.mvState_Stop_accelMps2_Threshold_Max &&
-            fabs(g_M010_CarStatus.yawAngleVelocity_degps) < g_M010_Config.mvState_Stop_gyroDps_Threshold_Max) {
-            
-            if (g_M010_CarStatus.stopStableStartTime_ms == 0) { // 정지 안정화 조건 만족 시작 시간 기록
-				g_M010_CarStatus.stopStableStartTime_ms = *p_currentTime_ms;
-            } else if ((*p_currentTime_ms - g_M010_CarStatus.stopStableStartTime_ms) >= g_M010_Config.mvState_stop_durationMs_Stable_Min) {
-                // 충분히 안정적인 정지 상태로 판단되면 속도 0으로 보정 (드리프트 방지)
-                g_M010_CarStatus.speed_kmh = 0.0; 
-            }
-        } else {
-            g_M010_CarStatus.stopStableStartTime_ms = 0; // 움직임 감지 시 안정화 시작 시간 리셋
+    // FIFO 오버플로 확인 (INT_STATUS 는 읽으면 지워짐) 및 쌓인 바이트 수 읽기
+    g_M010_mpu_interruptStatus = g_M010_Mpu.getIntStatus();
+    g_M010_dmp_fifoCount       = g_M010_Mpu.getFIFOCount();
+
+    if ((g_M010_mpu_interruptStatus & G_M010_MPU_INT_FIFO_OFLOW) || g_M010_dmp_fifoCount >= G_M010_DMP_FIFO_SIZE) {
+        // 넘친 FIFO 는 패킷 경계를 알 수 없으므로 비우고 다음 패킷부터 다시 시작
+        g_M010_Mpu.resetFIFO();
+        g_M010_dmp_fifoCount = 0;
+        g_M010_dmp_overflowCount++;
+        return;
+    }
+
+    // 완전한 패킷만 읽음 (DMP 가 쓰는 중인 나머지 바이트는 FIFO 에 남겨 두고 다음 드레인에서)
+    uint8_t v_packetTotal = (uint8_t)(g_M010_dmp_fifoCount / g_M010_dmp_packetSize);
+    if (v_packetTotal == 0) return;
+
+    *p_currentTime_ms = millis(); // 현재 시간 가져오기 (마지막 패킷의 시각)
+
+    // 패킷 간격은 DMP 출력 주기로 고정 (루프 지연과 무관하게 일정한 적분 간격)
+    const float     v_deltaTime_s   = 1.0f / G_M010_DMP_OUTPUT_RATE_HZ;
+    const u_int32_t v_period_ms     = 1000 / G_M010_DMP_OUTPUT_RATE_HZ;
+
+    // 첫 패킷의 시각 (이전 드레인의 마지막 시각보다 앞서지 않도록)
+    u_int32_t v_sampleTime_ms = *p_currentTime_ms - (u_int32_t)(v_packetTotal - 1) * v_period_ms;
+    if ((int32_t)(v_sampleTime_ms - g_M010_lastSampleTime_ms) < 0) {
+        v_sampleTime_ms = g_M010_lastSampleTime_ms;
+    }
+
+    uint8_t v_packetIdx = 0;
+    while (v_packetIdx < v_packetTotal) {
+        // 최대 g_M010_dmp_burstPackets 개를 I2C 한 번에 읽음
+        uint8_t v_burst = v_packetTotal - v_packetIdx;
+        if (v_burst > g_M010_dmp_burstPackets) v_burst = g_M010_dmp_burstPackets;
+        g_M010_Mpu.getFIFOBytes(g_M010_dmp_fifoBuffer, (uint16_t)v_burst * g_M010_dmp_packetSize);
+
+        for (uint8_t i = 0; i < v_burst; i++) {
+            M010_MPU_processPacket(&g_M010_dmp_fifoBuffer[(uint16_t)i * g_M010_dmp_packetSize], v_sampleTime_ms, v_deltaTime_s);
+            g_M010_lastSampleTime_ms = v_sampleTime_ms; // 마지막 샘플링 시간 업데이트
+            if ((int32_t)(*p_currentTime_ms - v_sampleTime_ms) > 0) v_sampleTime_ms += v_period_ms;
         }
+        v_packetIdx += v_burst;
+    }
+    g_M010_dmp_fifoCount -= (uint16_t)v_packetTotal * g_M010_dmp_packetSize; // 읽는 동안 새로 쌓인 패킷은 다음 드레인에서
+
+    // 드레인 통계
+    g_M010_dmp_drainCount++;
+    g_M010_dmp_packetCount     += v_packetTotal;
+    g_M010_dmp_lastDrainPackets = v_packetTotal;
+    if (v_packetTotal > g_M010_dmp_maxDrainPackets) g_M010_dmp_maxDrainPackets = v_packetTotal;
+
+    g_M010_mpu_isDataReady = true; // 새로운 데이터가 처리되었음을 알림
+}
 
-        // 추정 속도가 음수로 작아지면 0으로 보정 (뒤로 가지 않는 상황 가정)
-        if (g_M010_CarStatus.speed_kmh < 0 && g_M010_CarStatus.carMovementState != E_M010_CARMOVESTATE_REVERSE) {
-            g_M010_CarStatus.speed_kmh = 0.0;
+/**
+ * @brief DMP 패킷 하나로 자동차의 가속도, 속도, 각도, 각속도 등을 업데이트합니다.
+ * 쿼터니언, 오일러 각, 선형 가속도 등을 계산하고, 상보 필터 및 속도 드리프트 보정 로직을 적용합니다.
+ * @param p_packet DMP FIFO 패킷 (g_M010_dmp_packetSize 바이트)
+ * @param p_sampleTime_ms 패킷의 샘플링 시각 (ms)
+ * @param p_deltaTime_s 이전 패킷과의 시간 간격 (초, DMP 출력 주기)
+ */
+void M010_MPU_processPacket(const uint8_t* p_packet, u_int32_t p_sampleTime_ms, float p_deltaTime_s) {
+    // 쿼터니언 (방향 정보를 효율적으로 표현), Yaw/Pitch/Roll (오일러 각), 중력 벡터 계산
+    g_M010_Mpu.dmpGetQuaternion(&g_M010_Quaternion, p_packet);
+    g_M010_Mpu.dmpGetGravity(&g_M010_gravity, &g_M010_Quaternion); 
+    g_M010_Mpu.dmpGetYawPitchRoll(g_M010_ypr, &g_M010_Quaternion, &g_M010_gravity);
+
+    // Yaw, Pitch 각도를 라디안에서 도로 변환하여 저장
+    g_M010_CarStatus.yawAngle_deg   = g_M010_ypr[0] * G_M010_RAD_TO_DEG;
+    g_M010_CarStatus.pitchAngle_deg = g_M010_ypr[1] * G_M010_RAD_TO_DEG;
+
+    // 선형 가속도 (중력분 제거) 계산
+    VectorInt16 v_accel_raw;        // Raw 가속도 (MPU6050 내부 데이터 형식)
+    VectorInt16 v_accel_linear;     // 중력분이 제거된 선형 가속도 결과
+
+    g_M010_Mpu.dmpGetAccel(&v_accel_raw, p_packet);                        // Raw 가속도 얻기
+    g_M010_Mpu.dmpGetLinearAccel(&v_accel_linear, &v_accel_raw, &g_M010_gravity);       // 선형 가속도 계산
+
+    // 계산된 선형 가속도를 m/s^2 단위로 변환 (중력 가속도 G_M010_GRAVITY_MPS2 곱함)
+    float v_currentAx_ms2 = (float)v_accel_linear.x * (G_M010_GRAVITY_MPS2 / 16384.0f); // MPU6050 가속도 센서 2g 스케일 기준 (16384 LSB/g)
+    float v_currentAy_ms2 = (float)v_accel_linear.y * (G_M010_GRAVITY_MPS2 / 16384.0f); 
+    float v_currentAz_ms2 = (float)v_accel_linear.z * (G_M010_GRAVITY_MPS2 / 16384.0f); 
+
+    // 상보 필터를 사용하여 가속도 데이터 평활화 (노이즈 감소)
+    // alpha 값이 높을수록 이전 값의 영향이 크고, 낮을수록 현재 값의 영향이 커짐.
+    g_M010_filteredAx = g_M010_Config.mvState_accelFilter_Alpha * g_M010_filteredAx + (1 - g_M010_Config.mvState_accelFilter_Alpha) * v_currentAx_ms2;
+    g_M010_filteredAy = g_M010_Config.mvState_accelFilter_Alpha * g_M010_filteredAy + (1 - g_M010_Config.mvState_accelFilter_Alpha) * v_currentAy_ms2;
+    g_M010_filteredAz = g_M010_Config.mvState_accelFilter_Alpha * g_M010_filteredAz + (1 - g_M010_Config.mvState_accelFilter_Alpha) * v_currentAz_ms2;
+
+    // 필터링된 가속도 값을 자동차 상태 구조체에 저장
+    g_M010_CarStatus.accelX_ms2 = g_M010_filteredAx;
+    g_M010_CarStatus.accelY_ms2 = g_M010_filteredAy;
+    g_M010_CarStatus.accelZ_ms2 = g_M010_filteredAz;
+
+    // Yaw 각속도 (Z축 자이로 데이터) 계산
+    VectorInt16 v_Gyro_raw; // 자이로 데이터
+    g_M010_Mpu.dmpGetGyro(&v_Gyro_raw, p_packet); // Raw 자이로 데이터 얻기
+
+    // 자이로 스케일 팩터 (G_M010_GYRO_SCALE_FACTOR)를 이용하여 deg/s 단위로 변환
+    g_M010_yawAngleVelocity_degps           = (float)v_Gyro_raw.z / G_M010_GYRO_SCALE_FACTOR; 
+    g_M010_CarStatus.yawAngleVelocity_degps = g_M010_yawAngleVelocity_degps;
+
+    // 속도 추정 (Y축 가속도 적분)
+    // 이 방법은 오차 누적(드리프트) 가능성이 있으므로, 정지 시 보정 로직이 필수적입니다.
+    float v_speedChange_mps     = g_M010_CarStatus.accelY_ms2 * p_deltaTime_s;
+    g_M010_CarStatus.speed_kmh += (v_speedChange_mps * G_M010_MPS_TO_KMH_FACTOR); // m/s를 km/h로 변환하여 누적
+
+    // 정지 시 속도 드리프트 보정 강화 로직
+    // 가속도 및 각속도 변화가 모두 임계값 이하로 충분히 오래 유지될 때만 속도를 0으로 설정
+    if (fabs(g_M010_CarStatus.accelY_ms2) < g_M010_Config.mvState_Stop_accelMps2_Threshold_Max &&
+        fabs(g_M010_CarStatus.yawAngleVelocity_degps) < g_M010_Config.mvState_Stop_gyroDps_Threshold_Max) {
+        
+        if (g_M010_CarStatus.stopStableStartTime_ms == 0) { // 정지 안정화 조건 만족 시작 시간 기록
+			g_M010_CarStatus.stopStableStartTime_ms = p_sampleTime_ms;
+        } else if ((p_sampleTime_ms - g_M010_CarStatus.stopStableStartTime_ms) >= g_M010_Config.mvState_stop_durationMs_Stable_Min) {
+            // 충분히 안정적인 정지 상태로 판단되면 속도 0으로 보정 (드리프트 방지)
+            g_M010_CarStatus.speed_kmh = 0.0; 
         }
+    } else {
+        g_M010_CarStatus.stopStableStartTime_ms = 0; // 움직임 감지 시 안정화 시작 시간 리셋
+    }
 
-		g_M010_mpu_isDataReady = true; // 새로운 데이터가 처리되었음을 알림
+    // 추정 속도가 음수로 작아지면 0으로 보정 (뒤로 가지 않는 상황 가정)
+    if (g_M010_CarStatus.speed_kmh < 0 && g_M010_CarStatus.carMovementState != E_M010_CARMOVESTATE_REVERSE) {
+        g_M010_CarStatus.speed_kmh = 0.0;
     }
 }
 
@@ -1060,6 +1285,10 @@ void M010_CarStatus_print() {
     dbgP1_print_F(F("Yaw 각속도: "));               dbgP1_print(g_M010_CarStatus.yawAngleVelocity_degps, 2);    dbgP1_println_F(F(" 도/초"));
     dbgP1_print_F(F("급감속: "));                   dbgP1_println_F(g_M010_CarStatus.isEmergencyBraking ? F("감지됨") : F("아님"));
     dbgP1_print_F(F("과속 방지턱: "));               dbgP1_println_F(g_M010_CarStatus.isSpeedBumpDetected ? F("감지됨") : F("아님"));
+    dbgP1_printf_F(F("DMP FIFO: 드레인 %lu회, 패킷 %lu (마지막 %u, 최대 %u/회), 오버플로 %lu회\n"),
+                   (unsigned long)g_M010_dmp_drainCount, (unsigned long)g_M010_dmp_packetCount,
+                   g_M010_dmp_lastDrainPackets, g_M010_dmp_maxDrainPackets, (unsigned long)g_M010_dmp_overflowCount);
+    g_M010_dmp_maxDrainPackets = 0; // 최대값은 출력 주기마다 다시 측정
     dbgP1_println_F(F("--------------------------"));
 }
 
@@ -1079,15 +1308,26 @@ void M010_run() {
 
     // 새로운 MPU 데이터가 준비되었을 때만 상태 정의 함수들을 호출
     if(g_M010_mpu_isDataReady == true){
+        T_M010_CarMovementState v_prevMoveState = g_M010_CarStatus.carMovementState;
+        T_M010_CarTurnState     v_prevTurnState = g_M010_CarStatus.carTurnState;
         // 자동차 움직임 상태 정의 함수 호출
         M010_CarMoveState_Recognize(v_currentTime_ms);
         // 자동차 회전 상태 정의 함수 호출
         M010_CarTurnState_Recognize(v_currentTime_ms); 
+        // 상태가 바뀌었거나 주기가 지나면 RTC 메모리 스냅샷 갱신 (리셋/딥슬립 후 이어서 시작)
+        if (g_M010_CarStatus.carMovementState != v_prevMoveState || g_M010_CarStatus.carTurnState != v_prevTurnState ||
+            (v_currentTime_ms - g_M010_snapTime_ms) >= G_M010_SNAP_PERIOD_MS) {
+            M010_snap_save(v_currentTime_ms);
+        }
+        #ifdef R310
+            // R310 눈 시선 오버레이에 목표 시선 전달 (센서 주기, 애니메이션 시퀀스와 독립)
+            R310_setGazeTarget(g_M010_CarStatus.yawAngleVelocity_degps, g_M010_CarStatus.pitchAngle_deg);
+        #endif
         g_M010_mpu_isDataReady = false; // 데이터 처리 완료 플래그 리셋
     }
     
-    // 시리얼 입력 처리 함수 호출 (설정 변경/저장/로드 등)
-    M010_Config_handleSerialInput();
+    // 시리얼 입력 처리 (들어온 바이트만 읽음, 설정 명령 줄은 M010_Config_handleSerialLine 으로)
+    A02_serialMux_poll();
 
     // 설정된 주기(g_M010_Config.serialPrint_intervalMs)에 따라 자동차 상태를 시리얼 출력
     if (millis() - g_M010_lastSerialPrintTime_ms >= g_M010_Config.serialPrint_intervalMs) {
@@ -1095,6 +1335,10 @@ void M010_run() {
         g_M010_lastSerialPrintTime_ms = millis(); // 마지막 출력 시간 업데이트
     }
 
-    // 이 위치에 LED Matrix 업데이트 등 추가 작업을 구현할 수 있습니다.
-    // 예: M010_updateLEDMatrix(g_M010_CarStatus.carMovementState, g_M010_CarStatus.carTurnState);
+    #ifdef R310
+        // R310 루프 대기에 다음 상태 출력 시간을 알림 (DMP 데이터는 인터럽트가 깨움)
+        R310_sched_setDue(g_M010_lastSerialPrintTime_ms + g_M010_Config.serialPrint_intervalMs);
+    #endif
+
+    // LED Matrix 표현은 R310 이 담당합니다. (위 R310_setGazeTarget 으로 시선 연동)
 }
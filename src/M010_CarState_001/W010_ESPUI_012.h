@@ -541,6 +541,9 @@ void W010_EmbUI_loadConfigToWebUI() {
  * @param p_value ESPUI 라이브러리 내부에서 사용하는 컨트롤의 추가 값 (버튼의 경우 1).
  */
 void W010_ESPUI_callback(Control* p_control, int p_value) {
+    #ifdef R310
+        R310_sched_notify(); // 웹 서버 태스크에서 호출되므로 대기 중인 루프를 깨워 바뀐 설정/주기를 바로 반영
+    #endif
     dbgP1_printf(F("%s ID=%d, Value=%s, Type=%d\n"), 
                  W010_EmbUI_getCommonString("messages.callback_detected", "ESPUI Callback detected:").c_str(),
                  p_control->id, p_control->value.c_str(), p_control->type);
@@ -842,6 +845,9 @@ void W010_EmbUI_run() {
         W010_EmbUI_updateCarStatusWeb();
         v_lastWebUpdateTime_ms = millis();
     }
+    #ifdef R310
+        R310_sched_setDue(v_lastWebUpdateTime_ms + g_M010_Config.serialPrint_intervalMs); // R310 루프 대기에 다음 웹 갱신 시간을 알림
+    #endif
 }
 
 /**
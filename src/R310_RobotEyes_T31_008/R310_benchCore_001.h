@@ -0,0 +1,120 @@
+#pragma once
+
+// R310_benchCore_001.h - 보드 의존성이 없는 R310 벤치마크 (픽셀 매핑 LUT, 명령 분기)
+// 펌웨어에서는 R310_bench_001.h 가 포함해 R310_bench_run() 에서 실행하고,
+// 호스트에서는 test/host 의 드라이버가 같은 코드를 빌드해 실행합니다. (make -C test/host bench)
+// 시간은 micros(), 결과는 Serial.printf 로 출력합니다.
+
+#include "R310_config_009.h"
+#include "R310_data2_014.h"
+#include "R310_pixelMap_001.h"
+#include "R310_fontPack_001.h"
+#include "R310_cmdDispatch_001.h"
+
+#ifndef G_R310_BENCH_FRAMES
+    #define G_R310_BENCH_FRAMES     1000        // 측정 반복 프레임 수 (호스트 드라이버는 더 크게 지정)
+#endif
+#define G_R310_BENCH_MAX_PANELS     4           // 체인 벤치마크 최대 패널 수
+
+CRGB g_R310_bench_leds[G_R310_BENCH_MAX_PANELS * T_R310_EyePanel_t::PIXELS];   // 벤치마크용 스크래치 버퍼 (G_R310_NEOPIXEL_NUM_LEDS 이상)
+
+// 픽셀 매핑 벤치마크는 기존 방식과 비교하기 위해 G_R310_PANEL_SIZE 와 무관하게 8x8 패널로 측정
+typedef T_R310_PanelGeometry_t<8, 8, G_R310_PANEL_ORDER, G_R310_PANEL_ROTATION> T_R310_BenchPanel_t;
+
+// 4패널 체인 LUT (패널을 연속 배선한 경우)
+constexpr uint16_t G_R310_BENCH_CHAIN_START_PIXELS[G_R310_BENCH_MAX_PANELS] = { 0, 64, 128, 192 };
+constexpr T_R310_PixelLut_t<T_R310_BenchPanel_t, G_R310_BENCH_MAX_PANELS> g_R310_bench_chainLut =
+    R310_buildPixelLut<T_R310_BenchPanel_t, G_R310_BENCH_MAX_PANELS>(G_R310_BENCH_CHAIN_START_PIXELS);
+
+// 기존(R310_main_014) 방식의 매핑: 행마다 모듈로 + 분기 + 범위 검사
+uint16_t R310_bench_mapPixel_legacy(uint8_t p_panel, uint8_t p_row, uint8_t p_col) {
+    uint16_t v_pixel_index;
+    if (p_row % 2 == 0) {
+        v_pixel_index = p_panel * 64 + (p_row * 8) + p_col;
+    } else {
+        v_pixel_index = p_panel * 64 + (p_row * 8) + (7 - p_col);
+    }
+    if (v_pixel_index >= G_R310_ARRAY_SIZE(g_R310_bench_leds)) {
+        Serial.print("Error: Mapped pixel index out of bounds: ");
+        Serial.println(v_pixel_index);
+        return 0;
+    }
+    return v_pixel_index;
+}
+
+// 한 프레임 그리기: p_panels 개 패널에 폰트를 순환 배정하여 그립니다.
+// @return 프레임당 평균 소요 시간 (마이크로초)
+float R310_bench_drawFrames(uint8_t p_panels, bool p_useLut) {
+    uint32_t v_start = micros();
+    for (uint32_t v_frame = 0; v_frame < G_R310_BENCH_FRAMES; v_frame++) {
+        memset(g_R310_bench_leds, 0, sizeof(g_R310_bench_leds));
+        for (uint8_t v_panel = 0; v_panel < p_panels; v_panel++) {
+            uint8_t v_glyph[8];
+            R310_font_unpack(&g_R310_RobotEyes_Font, (uint8_t)((v_frame + v_panel) % G_R310_ROBOT_EYES_FONT_LEN), v_glyph);
+            for (uint8_t v_row = 0; v_row < T_R310_BenchPanel_t::HEIGHT; v_row++) {
+                uint8_t         v_rowByte = v_glyph[v_row];
+                const uint16_t* v_rowLut  = g_R310_bench_chainLut.idx[v_panel][v_row];
+                if (p_useLut) {
+                    for (uint8_t v_col = 0; v_col < T_R310_BenchPanel_t::WIDTH; v_col++) {
+                        if (v_rowByte & (0x80 >> v_col)) g_R310_bench_leds[v_rowLut[v_col]] = G_R310_EYE_COLOR;
+                    }
+                } else {
+                    for (uint8_t v_col = 0; v_col < T_R310_BenchPanel_t::WIDTH; v_col++) {
+                        if ((v_rowByte >> (7 - v_col)) & 0x01) g_R310_bench_leds[R310_bench_mapPixel_legacy(v_panel, v_row, v_col)] = G_R310_EYE_COLOR;
+                    }
+                }
+            }
+        }
+    }
+    return (float)(micros() - v_start) / G_R310_BENCH_FRAMES;
+}
+
+// 픽셀 매핑 벤치마크: 8x8 2패널(눈 한 쌍) 및 4패널 체인
+void R310_bench_pixelMap() {
+    const uint8_t v_panelCounts[] = { 2, G_R310_BENCH_MAX_PANELS };
+    for (uint8_t v_i = 0; v_i < G_R310_ARRAY_SIZE(v_panelCounts); v_i++) {
+        float v_legacy_us = R310_bench_drawFrames(v_panelCounts[v_i], false);
+        float v_lut_us    = R310_bench_drawFrames(v_panelCounts[v_i], true);
+        Serial.printf("[R310_BENCH] pixelMap %u panels: legacy %.2f us/frame, LUT %.2f us/frame\n", v_panelCounts[v_i], v_legacy_us, v_lut_us);
+    }
+}
+
+// 명령 분기: 기존 strcmp 연쇄(표 순서대로 비교)와 완전 해시 조회 비교, 토큰 분리 + 옵션 해석 비용
+// 표의 모든 명령어와 명령이 아닌 문자열(텍스트 표시로 가는 경우)을 번갈아 조회합니다.
+void R310_bench_cmdDispatch() {
+    static const char* const v_misses[] = { "hello", "robot eyes", "smiles", "x" };
+    const uint8_t            v_total    = G_R310_CMD_DEF_COUNT + sizeof(v_misses) / sizeof(v_misses[0]);
+    uint32_t                 v_checksum = 0;
+
+    for (uint8_t v_useHash = 0; v_useHash < 2; v_useHash++) {
+        uint32_t v_startUs = micros();
+        for (uint32_t v_i = 0; v_i < G_R310_BENCH_FRAMES; v_i++) {
+            uint8_t     v_k    = v_i % v_total;
+            const char* v_name = (v_k < G_R310_CMD_DEF_COUNT) ? G_R310_CMD_DEFS[v_k].name : v_misses[v_k - G_R310_CMD_DEF_COUNT];
+            uint8_t     v_id   = CMD_NONE;
+            if (v_useHash) {
+                T_R310_CmdTok_t v_tok = { v_name, (uint8_t)strlen(v_name) };
+                v_id = R310_cmd_lookup(&v_tok);
+            } else {
+                for (uint8_t v_d = 0; v_d < G_R310_CMD_DEF_COUNT; v_d++) {
+                    if (strcmp(v_name, G_R310_CMD_DEFS[v_d].name) == 0) { v_id = G_R310_CMD_DEFS[v_d].id; break; }
+                }
+            }
+            v_checksum += v_id;
+        }
+        Serial.printf("[R310_BENCH] cmd dispatch (%s): %.3f us/lookup\n", v_useHash ? "perfect hash" : "strcmp chain",
+                      (float)(micros() - v_startUs) / G_R310_BENCH_FRAMES);
+    }
+
+    T_R310_CmdArgs_t v_args;
+    T_R310_CmdOpts_t v_opts;
+    uint32_t         v_startUs = micros();
+    for (uint32_t v_i = 0; v_i < G_R310_BENCH_FRAMES; v_i++) {
+        R310_cmd_tokenize("blink x3 speed 1.5", &v_args);
+        R310_cmd_parseOpts(&v_args, &v_opts);
+        v_checksum += v_opts.repeat + v_opts.speedQ8;
+    }
+    Serial.printf("[R310_BENCH] cmd tokenize + options: %.3f us (checksum %lu)\n",
+                  (float)(micros() - v_startUs) / G_R310_BENCH_FRAMES, (unsigned long)v_checksum);
+    R310_cmd_printTable();
+}
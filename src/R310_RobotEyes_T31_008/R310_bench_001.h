@@ -0,0 +1,323 @@
+#pragma once
+
+// R310_bench_001.h - R310 렌더링 경로 벤치마크 (R310_BENCH 정의 시에만 포함)
+// R310_init()에서 1회 실행되어 결과를 시리얼로 출력합니다. 실제 LED 출력(FastLED.show)은 측정에 포함하지 않습니다.
+
+#define G_R310_BENCH_TICK_MS        200         // 배치 틱 벤치마크 인스턴스 수별 측정 시간 (밀리초)
+
+#define G_R310_BENCH_STRESS_FILE    "/r310_bench.json"  // 플래시 쓰기 스트레스용 파일 (끝나면 삭제)
+#define G_R310_BENCH_STRESS_BYTES   1024        // 저장 1회 크기 (config.json 과 비슷한 크기)
+#define G_R310_BENCH_STRESS_FRAMES  300         // 스트레스 중 측정 프레임 수 (프레임 사이 1ms 대기)
+#define G_R310_BENCH_STRESS_STACK   4096        // 저장 태스크 스택 크기 (바이트)
+
+#include "R310_benchCore_001.h"   // 픽셀 매핑/명령 분기 벤치마크 (호스트에서도 빌드: test/host)
+
+#if defined(ARDUINO_ARCH_ESP32)
+    #include <LittleFS.h>
+#endif
+
+// 크로스페이드 블렌딩 커널 벤치마크: 전체 픽셀이 다른 최악의 경우 (목표: 프레임당 1ms 미만)
+void R310_bench_crossfade() {
+    for (uint16_t v_i = 0; v_i < G_R310_NEOPIXEL_NUM_LEDS; v_i++) {
+        g_R310_eyes[0].crossfade.from[v_i] = CRGB(random(256), random(256), random(256));
+        g_R310_eyes[0].crossfade.to[v_i]   = CRGB(random(256), random(256), random(256));
+    }
+    uint32_t v_start = micros();
+    for (uint16_t v_frame = 0; v_frame < G_R310_BENCH_FRAMES; v_frame++) {
+        R310_xf_blendRows(g_R310_eyes[0].crossfade.from, g_R310_eyes[0].crossfade.to, g_R310_bench_leds, G_R310_NEOPIXEL_NUM_LEDS, (fract8)v_frame);
+    }
+    float v_blend_us = (float)(micros() - v_start) / G_R310_BENCH_FRAMES;
+    Serial.printf("[R310_BENCH] crossfade %u px: %.2f us/frame\n", G_R310_NEOPIXEL_NUM_LEDS, v_blend_us);
+}
+
+// 시선 오버레이 벤치마크: 오버레이 합성 + CRGB 확장 (100Hz 갱신 기준 프레임당 10ms 예산)
+void R310_bench_gaze() {
+    T_R310_Gaze_t v_gaze;
+    R310_gaze_init(&v_gaze);
+    R310_fb_clear(&g_R310_eyes[0].eyeFb);
+    R310_fb_orGlyph(&g_R310_eyes[0].eyeFb, EYE_RIGHT, EYE_NEUTRAL);
+    R310_fb_orGlyph(&g_R310_eyes[0].eyeFb, EYE_LEFT, EYE_NEUTRAL);
+
+    uint32_t v_start = micros();
+    for (uint16_t v_frame = 0; v_frame < G_R310_BENCH_FRAMES; v_frame++) {
+        v_gaze.offsetX = (int8_t)((v_frame % 5) - 2);
+        v_gaze.offsetY = (int8_t)(((v_frame / 5) % 5) - 2);
+        T_R310_EyeFrameBuf_t v_out = g_R310_eyes[0].eyeFb;
+        R310_gaze_apply(&v_out, &v_gaze);
+        R310_fb_expand(&v_out, g_R310_bench_leds, &G_R310_DEFAULT_PALETTE);
+    }
+    float v_gaze_us = (float)(micros() - v_start) / G_R310_BENCH_FRAMES;
+    Serial.printf("[R310_BENCH] gaze overlay + expand: %.2f us/frame\n", v_gaze_us);
+}
+
+// 타임라인 틱 + 합성 비용: 오버레이 트랙 0개 / 2개(눈꺼풀 + 눈동자) 활성 비교 (활성 트랙 수와 무관해야 함)
+void R310_bench_timeline() {
+    T_R310_Gaze_t v_gaze;
+    R310_gaze_init(&v_gaze);
+    R310_fb_clear(&g_R310_eyes[0].eyeFb);
+    R310_fb_orGlyph(&g_R310_eyes[0].eyeFb, EYE_RIGHT, EYE_NEUTRAL);
+    R310_fb_orGlyph(&g_R310_eyes[0].eyeFb, EYE_LEFT, EYE_NEUTRAL);
+
+    for (uint8_t v_tracks = 0; v_tracks <= TL_TRACK_COUNT; v_tracks += TL_TRACK_COUNT) {
+        T_R310_Timeline_t v_tl;
+        R310_tl_init(&v_tl);
+        uint32_t v_start = micros();
+        for (uint16_t v_frame = 0; v_frame < G_R310_BENCH_FRAMES; v_frame++) {
+            if (v_tracks > 0 && v_tl.activeMask == 0) { // 클립이 끝나면 다시 재생 (프레임 번호를 시계로 사용)
+                R310_tl_play(&v_tl, TL_TRACK_LID, g_R310_tlClip_Blink, sizeof(g_R310_tlClip_Blink) / sizeof(T_R310_tl_Key_t), G_R310_TL_PRIO_AUTO, v_frame);
+                R310_tl_play(&v_tl, TL_TRACK_PUPIL, g_R310_tlClip_Glance, sizeof(g_R310_tlClip_Glance) / sizeof(T_R310_tl_Key_t), G_R310_TL_PRIO_AUTO, v_frame);
+            }
+            R310_tl_step(&v_tl, v_frame);
+            T_R310_EyeFrameBuf_t v_out = g_R310_eyes[0].eyeFb;
+            R310_tl_compose(&v_out, &v_tl, &v_gaze);
+        }
+        float v_tl_us = (float)(micros() - v_start) / G_R310_BENCH_FRAMES;
+        Serial.printf("[R310_BENCH] timeline step + compose (%u overlay tracks): %.2f us/frame\n", v_tracks, v_tl_us);
+    }
+}
+
+// 글리프 변환 합성 벤치마크: 변환 없는 기존 경로와 반전+이동 변환 경로 (두 눈 합성 기준)
+void R310_bench_glyphTransform() {
+    const uint8_t v_transforms[] = { G_R310_TF_NONE, G_R310_TF_MIRROR_H | G_R310_TF_SHIFT(-1, 0), G_R310_TF_ROT180 | G_R310_TF_SHIFT(1, 1) | G_R310_TF_INVERT };
+    for (uint8_t v_i = 0; v_i < G_R310_ARRAY_SIZE(v_transforms); v_i++) {
+        uint32_t v_start = micros();
+        for (uint16_t v_frame = 0; v_frame < G_R310_BENCH_FRAMES; v_frame++) {
+            uint8_t v_fontIdx = (uint8_t)(v_frame % G_R310_ROBOT_EYES_FONT_LEN);
+            R310_fb_clear(&g_R310_eyes[0].eyeFb);
+            R310_fb_orGlyphTf(&g_R310_eyes[0].eyeFb, EYE_RIGHT, v_fontIdx, v_transforms[v_i]);
+            R310_fb_orGlyphTf(&g_R310_eyes[0].eyeFb, EYE_LEFT, v_fontIdx, v_transforms[v_i]);
+        }
+        float v_compose_us = (float)(micros() - v_start) / G_R310_BENCH_FRAMES;
+        Serial.printf("[R310_BENCH] glyph compose transform 0x%02X: %.2f us/frame\n", v_transforms[v_i], v_compose_us);
+    }
+}
+
+// 폰트 디코딩 벤치마크: 패널 크기별 코덱(RAW / ROW_DICT)으로 글리프 하나를 행 배열로 풀기 (프레임 주기 대비)
+void R310_bench_fontUnpack() {
+    uint8_t  v_rows8[8];
+    uint16_t v_rows16[16];
+    uint32_t v_start = micros();
+    for (uint16_t v_i = 0; v_i < G_R310_BENCH_FRAMES; v_i++) R310_font_unpack(&g_R310_RobotEyes_Font, (uint8_t)(v_i % G_R310_ROBOT_EYES_FONT_LEN), v_rows8);
+    float v_unpack8_us = (float)(micros() - v_start) / G_R310_BENCH_FRAMES;
+    v_start = micros();
+    for (uint16_t v_i = 0; v_i < G_R310_BENCH_FRAMES; v_i++) R310_font_unpack(&g_R310_RobotEyes_Font16, (uint8_t)(v_i % G_R310_ROBOT_EYES_FONT_LEN), v_rows16);
+    float v_unpack16_us = (float)(micros() - v_start) / G_R310_BENCH_FRAMES;
+    Serial.printf("[R310_BENCH] font unpack: 8x8 codec %u %.2f us/glyph, 16x16 codec %u %.2f us/glyph (frame %u ms)\n",
+                  g_R310_RobotEyes_Font.codec, v_unpack8_us, g_R310_RobotEyes_Font16.codec, v_unpack16_us, G_R310_FRAME_TIME);
+}
+
+#if defined(ARDUINO_ARCH_ESP32)
+volatile bool     g_R310_bench_stressRun;       // 저장 태스크 실행 요청
+volatile bool     g_R310_bench_stressDone;      // 저장 태스크 종료 알림
+volatile uint32_t g_R310_bench_stressSaves;     // 저장 횟수
+
+// 설정 저장 흉내 태스크 (코어 0): M010_Config_save 처럼 파일을 "w" 로 열어 덮어쓰기를 반복합니다.
+void R310_bench_stressTask(void* p_arg) {
+    uint8_t v_buf[G_R310_BENCH_STRESS_BYTES];
+    memset(v_buf, ' ', sizeof(v_buf));
+    while (g_R310_bench_stressRun) {
+        File v_file = LittleFS.open(G_R310_BENCH_STRESS_FILE, "w");
+        if (v_file) {
+            v_file.write(v_buf, sizeof(v_buf));
+            v_file.close();
+        }
+        g_R310_bench_stressSaves++;
+        vTaskDelay(1);
+    }
+    g_R310_bench_stressDone = true;
+    vTaskDelete(nullptr);
+}
+
+// 저장을 반복하는 동안 깜빡임 시퀀스 프레임(프레임 읽기 + 두 눈 합성 + CRGB 확장)의 평균/최악 지연을 잽니다.
+void R310_bench_stressFrames(const char* p_label) {
+    T_R310_ani_Table_t v_table;
+    R310_hot_readAniTable(EMT_BLINK, &v_table);
+
+    uint32_t v_worstUs = 0;
+    uint32_t v_totalUs = 0;
+    for (uint16_t v_frame = 0; v_frame < G_R310_BENCH_STRESS_FRAMES; v_frame++) {
+        uint32_t           v_start = micros();
+        T_R310_ani_Frame_t v_aniFrame;
+        R310_hot_readAniFrame(&v_table.seq[v_frame % v_table.seqSize], &v_aniFrame);
+        R310_fb_clear(&g_R310_eyes[0].eyeFb);
+        R310_fb_orGlyphTf(&g_R310_eyes[0].eyeFb, EYE_RIGHT, v_aniFrame.eyeData[0], v_aniFrame.eyeTransform[0]);
+        R310_fb_orGlyphTf(&g_R310_eyes[0].eyeFb, EYE_LEFT, v_aniFrame.eyeData[1], v_aniFrame.eyeTransform[1]);
+        R310_fb_expand(&g_R310_eyes[0].eyeFb, g_R310_bench_leds, &G_R310_DEFAULT_PALETTE);
+        uint32_t v_us = micros() - v_start;
+        v_totalUs += v_us;
+        if (v_us > v_worstUs) v_worstUs = v_us;
+        delay(1); // 프레임 사이에 저장 태스크가 캐시를 밀어내도록 양보
+    }
+    Serial.printf("[R310_BENCH] flash stress (%s): avg %.2f us/frame, worst %lu us/frame\n",
+                  p_label, (float)v_totalUs / G_R310_BENCH_STRESS_FRAMES, (unsigned long)v_worstUs);
+}
+#endif
+
+#if defined(ARDUINO_ARCH_ESP32)
+T_R310_CmdQueue_t g_R310_bench_cmdq;            // 코어 간 요청 큐 벤치마크용 큐
+volatile bool     g_R310_bench_cmdqDone;        // 생산자 태스크 종료 알림
+
+// 요청 생산자 태스크 (코어 0): 일련번호를 감정 칸에 넣어 G_R310_BENCH_FRAMES 개를 넣습니다. (링이 차면 한 틱 쉬고 재시도)
+void R310_bench_cmdqTask(void* p_arg) {
+    T_R310_AniCmd_t v_cmd = { 0, EMTP_AUTO_REVERSE_OFF, EMTP_PLY_DIR_FIRST, CMDQ_APPEND, -1, G_R310_TL_SPEED_1X, 0 };
+    for (uint16_t v_i = 0; v_i < G_R310_BENCH_FRAMES; v_i++) {
+        v_cmd.emotionIdx = (uint8_t)v_i;
+        while (!R310_cmdq_post(&g_R310_bench_cmdq, CMDQ_SRC_EXTERN, &v_cmd)) vTaskDelay(1);
+    }
+    g_R310_bench_cmdqDone = true;
+    vTaskDelete(nullptr);
+}
+#endif
+
+// 애니메이션 요청 큐: 넣기/비우기 비용 (같은 태스크), ESP32 에서는 코어 간 유실/순서 검사
+void R310_bench_cmdQueue() {
+    static T_R310_CmdQueue_t v_queue;
+    T_R310_AniCmd_t          v_cmd = { EMT_SMILE, EMTP_AUTO_REVERSE_ON, EMTP_PLY_DIR_FIRST, CMDQ_APPEND, -1, G_R310_TL_SPEED_1X, 0 };
+    T_R310_AniCmd_t          v_start;
+    uint32_t                 v_postUs  = 0;
+    uint32_t                 v_drainUs = 0;
+
+    R310_cmdq_init(&v_queue);
+    for (uint16_t v_i = 0; v_i < G_R310_BENCH_FRAMES; v_i++) {
+        v_cmd.mode = (uint8_t)(v_i % 3); // REPLACE / APPEND / DROP_IF_BUSY 섞어서
+        uint32_t v_startUs = micros();
+        R310_cmdq_post(&v_queue, CMDQ_SRC_LOOP, &v_cmd);
+        v_postUs += micros() - v_startUs;
+        if ((v_i & 3) == 3) { // 틱마다 요청 4개 (한 프레임에 여러 요청이 몰리는 경우)
+            v_startUs = micros();
+            R310_cmdq_drain(&v_queue, true, &v_start);
+            while (R310_cmdq_pop(&v_queue, &v_start)) {}
+            v_drainUs += micros() - v_startUs;
+        }
+    }
+    Serial.printf("[R310_BENCH] cmd queue: post %.2f us, drain of 4 %.2f us\n",
+                  (float)v_postUs / G_R310_BENCH_FRAMES, (float)v_drainUs / (G_R310_BENCH_FRAMES / 4));
+    R310_cmdq_printStats(&v_queue);
+
+#if defined(ARDUINO_ARCH_ESP32)
+    R310_cmdq_init(&g_R310_bench_cmdq);
+    g_R310_bench_cmdqDone = false;
+    xTaskCreatePinnedToCore(R310_bench_cmdqTask, "R310_benchQ", 2048, nullptr, 1, nullptr, 0);
+
+    uint16_t v_received    = 0;
+    uint16_t v_orderErrors = 0;
+    uint32_t v_startMs     = millis();
+    while (v_received < G_R310_BENCH_FRAMES && (millis() - v_startMs) < 2000) {
+        R310_cmdq_drain(&g_R310_bench_cmdq, false, &v_start);
+        while (R310_cmdq_pop(&g_R310_bench_cmdq, &v_start)) {
+            if (v_start.emotionIdx != (uint8_t)v_received) v_orderErrors++;
+            v_received++;
+        }
+    }
+    while (!g_R310_bench_cmdqDone && (millis() - v_startMs) < 2000) delay(1);
+    Serial.printf("[R310_BENCH] cmd queue cross-core: %u/%u received, %u order errors, %lu full retries\n",
+                  (unsigned)v_received, (unsigned)G_R310_BENCH_FRAMES, (unsigned)v_orderErrors,
+                  (unsigned long)g_R310_bench_cmdq.rings[CMDQ_SRC_EXTERN].dropsFull);
+#endif
+}
+
+// 클립 전환 지연: R310_loadSequence + 첫 프레임 읽기 (내장 시퀀스 vs 외부 클립 뱅크)
+// 측정 중 G_R310_BENCH_FRAMES 번 감정을 바꾸며, 외부 클립은 마운트된 뱅크가 있을 때만 측정합니다.
+void R310_bench_clipSwitch() {
+    T_R310_Eyes_t* v_eyes = &g_R310_eyes[0];
+    T_R310_ani_Frame_t v_frame;
+
+    for (uint8_t v_useClip = 0; v_useClip < 2; v_useClip++) {
+        if (v_useClip && g_R310_clipBank.clipCount == 0) {
+            Serial.println("[R310_BENCH] clip switch (bank): no clip bank mounted");
+            break;
+        }
+        uint32_t v_maxUs   = 0;
+        uint32_t v_totalUs = 0;
+        for (uint16_t v_i = 0; v_i < G_R310_BENCH_FRAMES; v_i++) {
+            uint32_t v_startUs = micros();
+            if (v_useClip) {
+                v_eyes->aniControl.clipNext = (int8_t)(v_i % g_R310_clipBank.clipCount);
+                R310_loadSequence(v_eyes, EMT_NEUTRAL);
+            } else {
+                v_eyes->aniControl.clipNext = -1;
+                R310_loadSequence(v_eyes, (T_R310_emotion_idx_t)(EMT_BLINK + v_i % (EMT_ANGRY_COLOR - EMT_BLINK + 1)));
+            }
+            v_eyes->aniControl.aniFrameIndex = 0;
+            R310_loadFrame(v_eyes, &v_frame);
+            uint32_t v_us = micros() - v_startUs;
+            v_totalUs += v_us;
+            if (v_us > v_maxUs) v_maxUs = v_us;
+        }
+        Serial.printf("[R310_BENCH] clip switch (%s): %.2f us avg, %lu us max\n", v_useClip ? "bank" : "built-in",
+                      (float)v_totalUs / G_R310_BENCH_FRAMES, (unsigned long)v_maxUs);
+    }
+    v_eyes->aniControl.clipSlot = -1;
+    v_eyes->aniControl.clipNext = -1;
+}
+
+// 배치 틱 벤치마크: 인스턴스 1 ~ G_R310_EYES_COUNT 개가 시퀀스를 재생하는 동안 틱 하나의 평균 비용
+// 대부분의 틱은 모든 인스턴스가 대기 중이므로 타이머 배열만 훑고 끝나며, 때가 된 틱만 상태 머신/합성을 실행합니다.
+// g_R310_eyes 를 임시 배치로 돌린 뒤 초기 상태로 되돌립니다. (더 많은 인스턴스는 -DG_R310_EYES_COUNT=4 등으로 측정)
+void R310_bench_batchTick() {
+    for (uint8_t v_count = 1; v_count <= G_R310_EYES_COUNT; v_count++) {
+        T_R310_EyesBatch_t v_batch;
+        R310_batch_init(&v_batch);
+        for (uint8_t v_i = 0; v_i < v_count; v_i++) {
+            R310_batch_add(&v_batch, &g_R310_eyes[v_i]);
+            R310_setAnimation(&g_R310_eyes[v_i], EMT_SCAN_LR, EMTP_AUTO_REVERSE_ON, EMTP_PLY_DIR_FIRST, EMTP_FORCE_PLY_ON);
+        }
+
+        uint32_t v_ticks   = 0;
+        uint32_t v_startMs = millis();
+        uint32_t v_startUs = micros();
+        while (millis() - v_startMs < G_R310_BENCH_TICK_MS) {
+            R310_batch_tick(&v_batch, millis());
+            v_ticks++;
+        }
+        float v_tick_us = (float)(micros() - v_startUs) / v_ticks;
+        Serial.printf("[R310_BENCH] batch tick %u eyes: %.2f us/tick (%.2f us/eyes), %lu ticks\n",
+                      v_count, v_tick_us, v_tick_us / v_count, (unsigned long)v_ticks);
+
+        for (uint8_t v_i = 0; v_i < v_count; v_i++) {
+            R310_eyes_init(&g_R310_eyes[v_i], g_R310_eyes[v_i].output.leds, g_R310_eyes[v_i].output.ledOffset);
+        }
+    }
+}
+
+// 플래시 쓰기 스트레스 벤치마크: 코어 0 에서 설정 저장(LittleFS 쓰기)을 반복하는 동안 렌더링 최악 지연 측정
+// 핫 테이블 사본을 끈 경우(PROGMEM 읽기)와 켠 경우(DRAM 읽기)를 비교합니다. (IRAM 배치는 두 경우 모두 적용)
+void R310_bench_flashStress() {
+#if defined(ARDUINO_ARCH_ESP32)
+    if (!LittleFS.begin()) {
+        Serial.println("[R310_BENCH] flash stress: LittleFS mount failed, skipped");
+        return;
+    }
+    g_R310_bench_stressRun   = true;
+    g_R310_bench_stressDone  = false;
+    g_R310_bench_stressSaves = 0;
+    xTaskCreatePinnedToCore(R310_bench_stressTask, "R310_benchFs", G_R310_BENCH_STRESS_STACK, nullptr, 1, nullptr, 0);
+
+    g_R310_hot.isReady = false;
+    R310_bench_stressFrames("PROGMEM tables");
+    g_R310_hot.isReady = true;
+    R310_bench_stressFrames("DRAM tables");
+
+    g_R310_bench_stressRun = false;
+    while (!g_R310_bench_stressDone) delay(1);
+    LittleFS.remove(G_R310_BENCH_STRESS_FILE);
+    Serial.printf("[R310_BENCH] flash stress: %lu saves during measurement\n", (unsigned long)g_R310_bench_stressSaves);
+#else
+    Serial.println("[R310_BENCH] flash stress: ESP32 only, skipped");
+#endif
+}
+
+// 전체 벤치마크 실행
+void R310_bench_run() {
+    R310_bench_pixelMap();
+    R310_bench_crossfade();
+    R310_bench_gaze();
+    R310_bench_timeline();
+    R310_bench_glyphTransform();
+    R310_bench_fontUnpack();
+    R310_bench_clipSwitch();
+    R310_bench_cmdQueue();
+    R310_bench_cmdDispatch();
+    R310_bench_batchTick();
+    R310_bench_flashStress();
+}
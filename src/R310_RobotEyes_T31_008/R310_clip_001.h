@@ -0,0 +1,313 @@
+#pragma once
+
+// R310_clip_001.h - 외부 바이너리 애니메이션 클립 뱅크 (펌웨어 재빌드 없이 감정 시퀀스 추가/수정)
+// shared/R310_clipBank.py 로 만든 클립 뱅크를 전용 데이터 파티션 또는 LittleFS 파일에서 읽습니다.
+//   파티션 (ESP32) : 라벨 G_R310_CLIP_PARTITION (type data, subtype 0x40 등) 을 esp_partition_mmap 으로 매핑하고
+//                    프레임을 매핑 주소에서 바로 읽습니다. (복사 없음, 클립 전환 = 색인 조회)
+//                    기록: parttool.py write_partition --partition-name r310clips --input data/r310_clips.bin
+//   LittleFS 파일  : G_R310_CLIP_FILE 을 열어 둔 채 프레임마다 레코드 하나(6바이트)만 읽습니다. (PlatformIO uploadfs)
+// 파티션이 없으면 파일을 씁니다. 어느 쪽이든 RAM 에는 색인(클립당 16바이트)만 둡니다.
+//
+// 뱅크 형식 (리틀 엔디언, 버전 1)
+//   헤더 12바이트 : magic "R3CB", version, clipCount, crc16(헤더 뒤 전체, CRC-16/CCITT-FALSE), totalSize(헤더 포함)
+//   색인 16바이트 x clipCount : name[8], emotionIdx, flags, frameCount, reserved, frameOffset(뱅크 시작 기준)
+//   프레임 6바이트 x 합계    : T_R310_ani_Frame_t 와 같은 배치 (eyeData[2], timeFrame, eyeTransform[2])
+// emotionIdx 가 EMT_NONE 이 아니면 그 감정의 내장 시퀀스를 대체하고, EMT_NONE 이면 이름으로만 재생합니다. ("clip <이름>")
+// 뱅크는 마운트할 때 헤더/색인/CRC/글리프 범위를 모두 검사하며, 하나라도 틀리면 뱅크 전체를 쓰지 않습니다.
+
+#include "R310_config_009.h"
+#include "R310_data2_014.h"
+#include "R310_palette_001.h"
+
+#if defined(ARDUINO_ARCH_ESP32)
+    #define G_R310_CLIP_USE_PARTITION
+    #include <esp_partition.h>
+#endif
+#if defined(ARDUINO_ARCH_ESP32)
+    #define G_R310_CLIP_USE_LITTLEFS
+    #include <LittleFS.h>
+#endif
+
+#define G_R310_CLIP_MAGIC           0x42433352UL        // "R3CB"
+#define G_R310_CLIP_VERSION         1
+#define G_R310_CLIP_MAX             16                  // 뱅크 최대 클립 수 (색인 RAM = 16 x 16바이트)
+#define G_R310_CLIP_NAME_LEN        8                   // 클립 이름 최대 길이 (NUL 없이 8자까지)
+#define G_R310_CLIP_FILE            "/r310_clips.bin"   // LittleFS 뱅크 파일
+#define G_R310_CLIP_PARTITION       "r310clips"         // 전용 데이터 파티션 라벨
+#define G_R310_CLIP_FLAG_CROSSFADE  0x01                // 프레임 전환을 크로스페이드 (EMTP_BLEND_CROSSFADE)
+#define G_R310_CLIP_CHUNK           64                  // 파일 검사 시 한 번에 읽는 크기 (바이트)
+
+// 뱅크 헤더
+typedef struct {
+    uint32_t    magic;              // G_R310_CLIP_MAGIC
+    uint8_t     version;            // G_R310_CLIP_VERSION
+    uint8_t     clipCount;          // 클립 수 (1 ~ G_R310_CLIP_MAX)
+    uint16_t    crc16;              // 헤더 뒤 전체(색인 + 프레임) CRC
+    uint32_t    totalSize;          // 뱅크 전체 크기 (헤더 포함, 바이트)
+} T_R310_ClipBankHeader_t;
+
+// 클립 색인 항목
+typedef struct {
+    char        name[G_R310_CLIP_NAME_LEN];     // 클립 이름 (8자 미만이면 NUL 채움)
+    uint8_t     emotionIdx;                     // 대체할 감정 (T_R310_emotion_idx_t, EMT_NONE = 이름으로만 재생)
+    uint8_t     flags;                          // G_R310_CLIP_FLAG_*
+    uint8_t     frameCount;                     // 프레임 수 (1 ~ 127)
+    uint8_t     reserved;
+    uint32_t    frameOffset;                    // 첫 프레임 위치 (뱅크 시작 기준, 바이트)
+} T_R310_ClipIndex_t;
+
+static_assert(sizeof(T_R310_ClipBankHeader_t) == 12, "클립 뱅크 헤더는 12바이트여야 합니다 (shared/R310_clipBank.py 와 같은 배치)");
+static_assert(sizeof(T_R310_ClipIndex_t) == 16, "클립 색인 항목은 16바이트여야 합니다 (shared/R310_clipBank.py 와 같은 배치)");
+static_assert(sizeof(T_R310_ani_Frame_t) == 6, "클립 프레임 레코드는 T_R310_ani_Frame_t 와 같은 6바이트여야 합니다");
+
+// 뱅크 원본
+typedef enum {
+    CLIP_SRC_NONE,          // 마운트된 뱅크 없음 (내장 시퀀스만 사용)
+    CLIP_SRC_PARTITION,     // 데이터 파티션 매핑
+    CLIP_SRC_FILE,          // LittleFS 파일 스트리밍
+} T_R310_ClipSource_t;
+
+// 마운트된 클립 뱅크 (모든 눈 인스턴스 공용, 루프 태스크에서만 접근)
+typedef struct {
+    T_R310_ClipSource_t         source;
+    uint8_t                     clipCount;
+    T_R310_ClipIndex_t          index[G_R310_CLIP_MAX];     // 색인 (프레임은 매핑/스트리밍으로 읽음)
+    int8_t                      emotionSlot[EMT_COUNT];     // 감정 -> 대체 클립 슬롯 (-1: 내장 시퀀스)
+    uint32_t                    frameReads;                 // 프레임 읽기 횟수
+    uint32_t                    maxReadUs;                  // 프레임 하나 읽기 최대 시간 (마이크로초)
+#if defined(G_R310_CLIP_USE_PARTITION)
+    const uint8_t*              mapped;                     // 파티션 매핑 주소 (CLIP_SRC_PARTITION)
+    esp_partition_mmap_handle_t mapHandle;
+#endif
+#if defined(G_R310_CLIP_USE_LITTLEFS)
+    File                        file;                       // 열어 둔 뱅크 파일 (CLIP_SRC_FILE)
+#endif
+} T_R310_ClipBank_t;
+
+T_R310_ClipBank_t g_R310_clipBank;
+
+
+// CRC-16/CCITT-FALSE (다항식 0x1021, 초기값 0xFFFF), 조각 단위로 이어서 계산
+uint16_t R310_clip_crc16(uint16_t p_crc, const uint8_t* p_data, size_t p_len) {
+    for (size_t v_i = 0; v_i < p_len; v_i++) {
+        p_crc ^= (uint16_t)p_data[v_i] << 8;
+        for (uint8_t v_bit = 0; v_bit < 8; v_bit++) {
+            p_crc = (p_crc & 0x8000) ? (uint16_t)((p_crc << 1) ^ 0x1021) : (uint16_t)(p_crc << 1);
+        }
+    }
+    return p_crc;
+}
+
+// 헤더와 색인이 뱅크 크기 안에서 올바른지 검사합니다.
+bool R310_clip_isIndexValid(const T_R310_ClipBankHeader_t* p_header, const T_R310_ClipIndex_t* p_index) {
+    if (p_header->magic != G_R310_CLIP_MAGIC || p_header->version != G_R310_CLIP_VERSION) return false;
+    if (p_header->clipCount == 0 || p_header->clipCount > G_R310_CLIP_MAX) return false;
+    uint32_t v_dataStart = sizeof(T_R310_ClipBankHeader_t) + (uint32_t)p_header->clipCount * sizeof(T_R310_ClipIndex_t);
+    if (p_header->totalSize < v_dataStart) return false;
+
+    for (uint8_t v_c = 0; v_c < p_header->clipCount; v_c++) {
+        const T_R310_ClipIndex_t* v_clip = &p_index[v_c];
+        if (v_clip->name[0] == '\0' || v_clip->emotionIdx >= EMT_COUNT) return false;
+        if (v_clip->frameCount == 0 || v_clip->frameCount > INT8_MAX) return false;
+        // frameOffset + frameCount * 6 는 손상된 색인에서 넘칠 수 있으므로 남은 크기로 나누어 비교
+        if (v_clip->frameOffset < v_dataStart || v_clip->frameOffset > p_header->totalSize ||
+            v_clip->frameCount > (p_header->totalSize - v_clip->frameOffset) / sizeof(T_R310_ani_Frame_t)) return false;
+    }
+    return true;
+}
+
+// 프레임의 글리프 인덱스가 이 펌웨어의 폰트 범위 안인지 검사합니다. (R310_ani_isGlyphValid 의 실행 시점 판)
+bool R310_clip_isFrameValid(const T_R310_ani_Frame_t* p_frame) {
+    for (uint8_t v_eye = 0; v_eye < 2; v_eye++) {
+        uint8_t v_idx = p_frame->eyeData[v_eye];
+        if (v_idx & G_R310_FONT_2BPP_FLAG) {
+            if ((v_idx & ~G_R310_FONT_2BPP_FLAG) >= G_R310_ROBOT_EYES_FONT2BPP_LEN) return false;
+        } else if (v_idx >= G_R310_ROBOT_EYES_FONT_LEN) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// 마운트된 뱅크를 내려놓습니다. (매핑 해제, 파일 닫기)
+void R310_clip_unmount() {
+#if defined(G_R310_CLIP_USE_PARTITION)
+    if (g_R310_clipBank.source == CLIP_SRC_PARTITION) esp_partition_munmap(g_R310_clipBank.mapHandle);
+#endif
+#if defined(G_R310_CLIP_USE_LITTLEFS)
+    if (g_R310_clipBank.source == CLIP_SRC_FILE) g_R310_clipBank.file.close();
+#endif
+    g_R310_clipBank.source    = CLIP_SRC_NONE;
+    g_R310_clipBank.clipCount = 0;
+    memset(g_R310_clipBank.emotionSlot, -1, sizeof(g_R310_clipBank.emotionSlot));
+}
+
+#if defined(G_R310_CLIP_USE_PARTITION)
+// 전용 데이터 파티션의 뱅크를 매핑합니다.
+bool R310_clip_mountPartition() {
+    const esp_partition_t* v_part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, G_R310_CLIP_PARTITION);
+    if (v_part == nullptr) return false;
+
+    T_R310_ClipBankHeader_t v_header;
+    if (esp_partition_read(v_part, 0, &v_header, sizeof(v_header)) != ESP_OK) return false;
+    if (v_header.magic != G_R310_CLIP_MAGIC || v_header.totalSize > v_part->size) return false;
+
+    const void* v_mapped = nullptr;
+    if (esp_partition_mmap(v_part, 0, v_header.totalSize, ESP_PARTITION_MMAP_DATA, &v_mapped, &g_R310_clipBank.mapHandle) != ESP_OK) return false;
+    const uint8_t* v_bytes = (const uint8_t*)v_mapped;
+
+    const T_R310_ClipIndex_t* v_index = (const T_R310_ClipIndex_t*)(v_bytes + sizeof(T_R310_ClipBankHeader_t));
+    bool v_isValid = R310_clip_isIndexValid(&v_header, v_index) &&
+                     R310_clip_crc16(0xFFFF, v_bytes + sizeof(T_R310_ClipBankHeader_t), v_header.totalSize - sizeof(T_R310_ClipBankHeader_t)) == v_header.crc16;
+    for (uint8_t v_c = 0; v_isValid && v_c < v_header.clipCount; v_c++) {
+        const T_R310_ani_Frame_t* v_frames = (const T_R310_ani_Frame_t*)(v_bytes + v_index[v_c].frameOffset);
+        for (uint8_t v_f = 0; v_isValid && v_f < v_index[v_c].frameCount; v_f++) v_isValid = R310_clip_isFrameValid(&v_frames[v_f]);
+    }
+    if (!v_isValid) {
+        esp_partition_munmap(g_R310_clipBank.mapHandle);
+        Serial.println("R310 clip: partition bank invalid, ignored");
+        return false;
+    }
+
+    memcpy(g_R310_clipBank.index, v_index, v_header.clipCount * sizeof(T_R310_ClipIndex_t));
+    g_R310_clipBank.clipCount = v_header.clipCount;
+    g_R310_clipBank.mapped    = v_bytes;
+    g_R310_clipBank.source    = CLIP_SRC_PARTITION;
+    return true;
+}
+#endif
+
+#if defined(G_R310_CLIP_USE_LITTLEFS)
+// LittleFS 뱅크 파일을 열고 검사합니다. 파일은 열어 둔 채 프레임을 읽을 때마다 필요한 레코드만 읽습니다.
+bool R310_clip_mountFile() {
+    if (!LittleFS.begin()) return false;
+    File v_file = LittleFS.open(G_R310_CLIP_FILE, "r");
+    if (!v_file) return false;
+
+    T_R310_ClipBankHeader_t v_header;
+    T_R310_ClipIndex_t      v_index[G_R310_CLIP_MAX];
+    bool v_isValid = v_file.read((uint8_t*)&v_header, sizeof(v_header)) == sizeof(v_header) &&
+                     v_header.magic == G_R310_CLIP_MAGIC && v_header.clipCount > 0 && v_header.clipCount <= G_R310_CLIP_MAX &&
+                     v_header.totalSize == v_file.size();
+    if (v_isValid) {
+        size_t v_indexBytes = v_header.clipCount * sizeof(T_R310_ClipIndex_t);
+        v_isValid = v_file.read((uint8_t*)v_index, v_indexBytes) == v_indexBytes && R310_clip_isIndexValid(&v_header, v_index);
+    }
+
+    // CRC 는 작은 조각으로 읽어 계산 (파일 전체를 RAM 에 올리지 않음)
+    if (v_isValid) {
+        uint8_t  v_chunk[G_R310_CLIP_CHUNK];
+        uint16_t v_crc = 0xFFFF;
+        v_file.seek(sizeof(T_R310_ClipBankHeader_t));
+        for (uint32_t v_left = v_header.totalSize - sizeof(T_R310_ClipBankHeader_t); v_isValid && v_left > 0; ) {
+            size_t v_len = (v_left > sizeof(v_chunk)) ? sizeof(v_chunk) : v_left;
+            v_isValid = v_file.read(v_chunk, v_len) == v_len;
+            v_crc     = R310_clip_crc16(v_crc, v_chunk, v_len);
+            v_left   -= v_len;
+        }
+        v_isValid = v_isValid && v_crc == v_header.crc16;
+    }
+    for (uint8_t v_c = 0; v_isValid && v_c < v_header.clipCount; v_c++) {
+        v_file.seek(v_index[v_c].frameOffset);
+        for (uint8_t v_f = 0; v_isValid && v_f < v_index[v_c].frameCount; v_f++) {
+            T_R310_ani_Frame_t v_frame;
+            v_isValid = v_file.read((uint8_t*)&v_frame, sizeof(v_frame)) == sizeof(v_frame) && R310_clip_isFrameValid(&v_frame);
+        }
+    }
+    if (!v_isValid) {
+        v_file.close();
+        Serial.println("R310 clip: " G_R310_CLIP_FILE " invalid, ignored");
+        return false;
+    }
+
+    memcpy(g_R310_clipBank.index, v_index, v_header.clipCount * sizeof(T_R310_ClipIndex_t));
+    g_R310_clipBank.clipCount = v_header.clipCount;
+    g_R310_clipBank.file      = v_file;
+    g_R310_clipBank.source    = CLIP_SRC_FILE;
+    return true;
+}
+#endif
+
+// 클립 뱅크를 (다시) 마운트합니다. 파티션 -> LittleFS 파일 순서로 찾고, 없으면 내장 시퀀스만 씁니다.
+// @return 마운트한 클립 수
+uint8_t R310_clip_mount() {
+    R310_clip_unmount();
+    g_R310_clipBank.frameReads = 0;
+    g_R310_clipBank.maxReadUs  = 0;
+
+#if defined(G_R310_CLIP_USE_PARTITION)
+    if (g_R310_clipBank.source == CLIP_SRC_NONE) R310_clip_mountPartition();
+#endif
+#if defined(G_R310_CLIP_USE_LITTLEFS)
+    if (g_R310_clipBank.source == CLIP_SRC_NONE) R310_clip_mountFile();
+#endif
+
+    for (uint8_t v_c = 0; v_c < g_R310_clipBank.clipCount; v_c++) {
+        uint8_t v_emotionIdx = g_R310_clipBank.index[v_c].emotionIdx;
+        if (v_emotionIdx != EMT_NONE) g_R310_clipBank.emotionSlot[v_emotionIdx] = (int8_t)v_c; // 같은 감정이 여럿이면 뒤 클립 우선
+    }
+    return g_R310_clipBank.clipCount;
+}
+
+// 감정을 대체하는 클립 슬롯 (-1: 없음)
+int8_t R310_clip_findByEmotion(T_R310_emotion_idx_t p_emotionIdx) {
+    return (p_emotionIdx < EMT_COUNT) ? g_R310_clipBank.emotionSlot[p_emotionIdx] : -1;
+}
+
+// 이름으로 클립 슬롯을 찾습니다. (-1: 없음)
+int8_t R310_clip_findByName(const char* p_name) {
+    for (uint8_t v_c = 0; v_c < g_R310_clipBank.clipCount; v_c++) {
+        if (strncmp(g_R310_clipBank.index[v_c].name, p_name, G_R310_CLIP_NAME_LEN) == 0 && strlen(p_name) <= G_R310_CLIP_NAME_LEN) return (int8_t)v_c;
+    }
+    return -1;
+}
+
+// 클립의 프레임 하나를 읽습니다. (파티션: 매핑 주소에서 복사, 파일: 레코드 하나만 읽기)
+// 다른 모듈이 LittleFS 를 내렸다 올려 파일 핸들이 무효가 되었으면 한 번 다시 열어 읽습니다.
+// @return 읽었으면 true (실패하면 p_frame 은 EYE_NEUTRAL 정지 프레임)
+bool G_R310_HOT_CODE R310_clip_readFrame(uint8_t p_slot, uint8_t p_frameIdx, T_R310_ani_Frame_t* p_frame) {
+    uint32_t v_startUs = micros();
+    bool     v_isRead  = false;
+
+    if (p_slot < g_R310_clipBank.clipCount && p_frameIdx < g_R310_clipBank.index[p_slot].frameCount) {
+        uint32_t v_offset = g_R310_clipBank.index[p_slot].frameOffset + (uint32_t)p_frameIdx * sizeof(T_R310_ani_Frame_t);
+#if defined(G_R310_CLIP_USE_PARTITION)
+        if (g_R310_clipBank.source == CLIP_SRC_PARTITION) {
+            memcpy(p_frame, g_R310_clipBank.mapped + v_offset, sizeof(T_R310_ani_Frame_t));
+            v_isRead = true;
+        }
+#endif
+#if defined(G_R310_CLIP_USE_LITTLEFS)
+        if (g_R310_clipBank.source == CLIP_SRC_FILE) {
+            for (uint8_t v_try = 0; v_try < 2 && !v_isRead; v_try++) {
+                if (v_try > 0) { // 파일 핸들 복구
+                    g_R310_clipBank.file.close();
+                    if (!LittleFS.begin()) break;
+                    g_R310_clipBank.file = LittleFS.open(G_R310_CLIP_FILE, "r");
+                    if (!g_R310_clipBank.file) break;
+                }
+                v_isRead = g_R310_clipBank.file.seek(v_offset) &&
+                           g_R310_clipBank.file.read((uint8_t*)p_frame, sizeof(T_R310_ani_Frame_t)) == sizeof(T_R310_ani_Frame_t);
+            }
+        }
+#endif
+    }
+    if (!v_isRead) *p_frame = {{EYE_NEUTRAL, EYE_NEUTRAL}, 0, {G_R310_TF_NONE, G_R310_TF_NONE}};
+
+    uint32_t v_readUs = micros() - v_startUs;
+    g_R310_clipBank.frameReads++;
+    if (v_readUs > g_R310_clipBank.maxReadUs) g_R310_clipBank.maxReadUs = v_readUs;
+    return v_isRead;
+}
+
+// 마운트된 클립 목록 출력
+void R310_clip_printList() {
+    static const char* const v_sourceNames[] = {"none", "partition " G_R310_CLIP_PARTITION, "LittleFS " G_R310_CLIP_FILE};
+    Serial.printf("R310 clip bank: %s, %u clips, %lu frame reads (max %lu us)\n", v_sourceNames[g_R310_clipBank.source],
+                  (unsigned)g_R310_clipBank.clipCount, (unsigned long)g_R310_clipBank.frameReads, (unsigned long)g_R310_clipBank.maxReadUs);
+    for (uint8_t v_c = 0; v_c < g_R310_clipBank.clipCount; v_c++) {
+        const T_R310_ClipIndex_t* v_clip = &g_R310_clipBank.index[v_c];
+        Serial.printf("  [%u] %.8s emotion %u, %u frames%s\n", (unsigned)v_c, v_clip->name, (unsigned)v_clip->emotionIdx,
+                      (unsigned)v_clip->frameCount, (v_clip->flags & G_R310_CLIP_FLAG_CROSSFADE) ? ", crossfade" : "");
+    }
+}
@@ -0,0 +1,286 @@
+#pragma once
+
+// R310_cmdDispatch_001.h - 시리얼 명령 완전 해시 분기 + 인자 토큰 분리
+// 명령어 표(G_R310_CMD_DEFS)에서 충돌 없는 FNV-1a 시드를 컴파일 시간에 찾아 슬롯 표를 만듭니다.
+// 실행 시에는 첫 토큰 해시 1회 + 슬롯 읽기 1회 + 이름 비교 1회로 명령 번호를 얻으므로, 명령 수와 무관하게 일정한 시간입니다.
+// 충돌 없는 시드를 못 찾거나 같은 이름이 두 번 있으면 static_assert 로 빌드가 실패합니다. (명령 추가 시 표 충돌 검사)
+//
+// 토큰 분리는 원본 문자열을 고치거나 복사하지 않고 (시작 포인터, 길이) 쌍만 기록합니다.
+//   look 30 -20          : 위치 인자 (정수)
+//   blink x3 speed 2     : 반복 횟수 "x<N>", 속도 배율 "speed <실수>" (0.5 처럼 소수 가능)
+
+#include "R310_config_009.h"
+
+#define G_R310_CMD_TABLE_BITS   7                               // 슬롯 표 크기 (2^7 = 128, 명령 수의 4배 정도면 시드를 금방 찾음)
+#define G_R310_CMD_TABLE_SIZE   (1 << G_R310_CMD_TABLE_BITS)
+#define G_R310_CMD_SEED_LIMIT   2000                            // 컴파일 시간 시드 탐색 상한 (슬롯 128 개면 보통 수십 번 안에 찾음)
+#define G_R310_CMD_MAX_TOKENS   8                               // 한 명령의 최대 토큰 수 (명령어 포함)
+#define G_R310_CMD_MAX_REPEAT   9                               // "x<N>" 최대 반복 횟수
+#define G_R310_CMD_SPEED_1X     256                             // 속도 배율 1 (Q8.8 고정소수점)
+#define G_R310_CMD_SPEED_MIN    (G_R310_CMD_SPEED_1X / 8)       // 최소 속도 배율 (1/8 배)
+#define G_R310_CMD_SPEED_MAX    (G_R310_CMD_SPEED_1X * 8)       // 최대 속도 배율 (8 배)
+
+// 명령 번호
+typedef enum {
+    CMD_NONE,           // 명령이 아님 (텍스트 표시)
+    CMD_NEUTRAL,
+    CMD_BLINK,
+    CMD_WINK,
+    CMD_DROWSY,
+    CMD_GLANCE,
+    CMD_BLINKSEQ,
+    CMD_WINKSEQ,
+    CMD_LEFT,
+    CMD_RIGHT,
+    CMD_UP,
+    CMD_DOWN,
+    CMD_UPDOWN,
+    CMD_LEFTRIGHT,
+    CMD_ANGRY,
+    CMD_SMILE,
+    CMD_SLEEP,
+    CMD_SLEEPBLINK,
+    CMD_ANGRYCOLOR,
+    CMD_PROCLOOK,
+    CMD_PROCANGRY,
+    CMD_AWAKE,
+    CMD_SLEEPING,
+    CMD_FRAMESTATS,
+    CMD_CLIPS,
+    CMD_CLIPLOAD,
+    CMD_CLIP,
+    CMD_GAZE,
+    CMD_BRIGHT,
+    CMD_LOOK,
+    CMD_COUNT
+} T_R310_Cmd_Id_t;
+
+// 명령어 정의
+typedef struct {
+    const char*     name;       // 명령어 (첫 토큰)
+    uint8_t         id;         // T_R310_Cmd_Id_t
+} T_R310_CmdDef_t;
+
+constexpr T_R310_CmdDef_t G_R310_CMD_DEFS[] = {
+    { "neutral",    CMD_NEUTRAL    },
+    { "blink",      CMD_BLINK      },
+    { "wink",       CMD_WINK       },
+    { "drowsy",     CMD_DROWSY     },
+    { "glance",     CMD_GLANCE     },
+    { "blinkseq",   CMD_BLINKSEQ   },
+    { "winkseq",    CMD_WINKSEQ    },
+    { "left",       CMD_LEFT       },
+    { "right",      CMD_RIGHT      },
+    { "up",         CMD_UP         },
+    { "down",       CMD_DOWN       },
+    { "updown",     CMD_UPDOWN     },
+    { "leftright",  CMD_LEFTRIGHT  },
+    { "angry",      CMD_ANGRY      },
+    { "smile",      CMD_SMILE      },
+    { "sleep",      CMD_SLEEP      },
+    { "sleepblink", CMD_SLEEPBLINK },
+    { "angrycolor", CMD_ANGRYCOLOR },
+    { "proclook",   CMD_PROCLOOK   },
+    { "procangry",  CMD_PROCANGRY  },
+    { "awake",      CMD_AWAKE      },
+    { "sleeping",   CMD_SLEEPING   },
+    { "framestats", CMD_FRAMESTATS },
+    { "clips",      CMD_CLIPS      },
+    { "clipload",   CMD_CLIPLOAD   },
+    { "clip",       CMD_CLIP       },
+    { "gaze",       CMD_GAZE       },
+    { "bright",     CMD_BRIGHT     },
+    { "look",       CMD_LOOK       },
+};
+constexpr uint8_t G_R310_CMD_DEF_COUNT = sizeof(G_R310_CMD_DEFS) / sizeof(T_R310_CmdDef_t);
+
+static_assert(G_R310_CMD_DEF_COUNT == CMD_COUNT - 1, "G_R310_CMD_DEFS 와 T_R310_Cmd_Id_t 의 명령 수가 다릅니다");
+static_assert(G_R310_CMD_DEF_COUNT * 2 <= G_R310_CMD_TABLE_SIZE, "명령 수에 비해 G_R310_CMD_TABLE_BITS 가 작습니다");
+
+// 완전 해시 슬롯 표
+typedef struct {
+    uint32_t    seed;                               // 충돌 없는 FNV-1a 시드 (못 찾으면 0xFFFFFFFF)
+    uint8_t     slots[G_R310_CMD_TABLE_SIZE];       // 슬롯 -> G_R310_CMD_DEFS 인덱스 + 1 (0: 빈 슬롯)
+} T_R310_CmdTable_t;
+
+// 토큰 (원본 문자열 안의 위치, 널 종료 아님)
+typedef struct {
+    const char*     str;
+    uint8_t         len;
+} T_R310_CmdTok_t;
+
+// 토큰 분리 결과
+typedef struct {
+    T_R310_CmdTok_t tok[G_R310_CMD_MAX_TOKENS];     // tok[0] 은 명령어
+    uint8_t         count;
+} T_R310_CmdArgs_t;
+
+// 명령 공통 옵션 (반복/속도)
+typedef struct {
+    uint8_t         repeat;         // "x<N>" 재생 횟수 (기본 1)
+    uint16_t        speedQ8;        // "speed <실수>" 속도 배율 (Q8.8, 기본 G_R310_CMD_SPEED_1X)
+} T_R310_CmdOpts_t;
+
+
+// 시드를 섞은 FNV-1a 해시 (컴파일 시간/실행 시간 공용)
+constexpr uint32_t R310_cmd_hash(const char* p_str, uint8_t p_len, uint32_t p_seed) {
+    uint32_t v_hash = 2166136261u ^ (p_seed * 0x9E3779B9u);
+    for (uint8_t v_i = 0; v_i < p_len; v_i++) {
+        v_hash ^= (uint8_t)p_str[v_i];
+        v_hash *= 16777619u;
+    }
+    return v_hash;
+}
+
+// 해시 -> 슬롯 (상위 비트 사용, 하위 비트보다 고르게 섞임)
+constexpr uint8_t R310_cmd_slot(uint32_t p_hash) {
+    return (uint8_t)(p_hash >> (32 - G_R310_CMD_TABLE_BITS));
+}
+
+constexpr uint8_t R310_cmd_nameLen(const char* p_name) {
+    uint8_t v_len = 0;
+    while (p_name[v_len] != '\0') v_len++;
+    return v_len;
+}
+
+// 명령어 표에 같은 이름이 있는지 (컴파일 시간, 있으면 어떤 시드로도 충돌하므로 먼저 검사)
+constexpr bool R310_cmd_hasDuplicate() {
+    for (uint8_t v_a = 0; v_a < G_R310_CMD_DEF_COUNT; v_a++) {
+        for (uint8_t v_b = v_a + 1; v_b < G_R310_CMD_DEF_COUNT; v_b++) {
+            const char* v_nameA = G_R310_CMD_DEFS[v_a].name;
+            const char* v_nameB = G_R310_CMD_DEFS[v_b].name;
+            uint8_t     v_i     = 0;
+            while (v_nameA[v_i] != '\0' && v_nameA[v_i] == v_nameB[v_i]) v_i++;
+            if (v_nameA[v_i] == v_nameB[v_i]) return true;
+        }
+    }
+    return false;
+}
+
+static_assert(!R310_cmd_hasDuplicate(), "G_R310_CMD_DEFS 에 같은 명령어가 두 번 있습니다");
+
+// 충돌 없는 시드를 찾아 슬롯 표를 만듭니다. (컴파일 시간)
+constexpr T_R310_CmdTable_t R310_cmd_buildTable() {
+    T_R310_CmdTable_t v_table = {};
+    for (uint32_t v_seed = 0; v_seed < G_R310_CMD_SEED_LIMIT; v_seed++) {
+        for (uint8_t v_s = 0; v_s < G_R310_CMD_TABLE_SIZE; v_s++) v_table.slots[v_s] = 0;
+        bool v_isPerfect = true;
+        for (uint8_t v_d = 0; v_d < G_R310_CMD_DEF_COUNT && v_isPerfect; v_d++) {
+            const char* v_name = G_R310_CMD_DEFS[v_d].name;
+            uint8_t     v_slot = R310_cmd_slot(R310_cmd_hash(v_name, R310_cmd_nameLen(v_name), v_seed));
+            if (v_table.slots[v_slot] != 0) v_isPerfect = false;
+            else v_table.slots[v_slot] = v_d + 1;
+        }
+        if (v_isPerfect) {
+            v_table.seed = v_seed;
+            return v_table;
+        }
+    }
+    v_table.seed = 0xFFFFFFFF;
+    return v_table;
+}
+
+constexpr T_R310_CmdTable_t g_R310_cmdTable = R310_cmd_buildTable();
+
+static_assert(g_R310_cmdTable.seed != 0xFFFFFFFF, "명령어 표에서 충돌 없는 해시 시드를 찾지 못했습니다 (G_R310_CMD_TABLE_BITS 를 늘리세요)");
+
+
+// 명령어 토큰 -> 명령 번호 (해시 1회 + 이름 비교 1회)
+// @return T_R310_Cmd_Id_t (없으면 CMD_NONE)
+uint8_t R310_cmd_lookup(const T_R310_CmdTok_t* p_tok) {
+    uint8_t v_entry = g_R310_cmdTable.slots[R310_cmd_slot(R310_cmd_hash(p_tok->str, p_tok->len, g_R310_cmdTable.seed))];
+    if (v_entry == 0) return CMD_NONE;
+
+    const T_R310_CmdDef_t* v_def = &G_R310_CMD_DEFS[v_entry - 1];
+    if (strncmp(v_def->name, p_tok->str, p_tok->len) != 0 || v_def->name[p_tok->len] != '\0') return CMD_NONE;
+    return v_def->id;
+}
+
+// 공백으로 토큰을 나눕니다. (원본을 고치지 않음, G_R310_CMD_MAX_TOKENS 를 넘는 토큰은 무시)
+// @return 토큰 수
+uint8_t R310_cmd_tokenize(const char* p_line, T_R310_CmdArgs_t* p_args) {
+    p_args->count = 0;
+    while (*p_line != '\0' && p_args->count < G_R310_CMD_MAX_TOKENS) {
+        while (*p_line == ' ') p_line++;
+        if (*p_line == '\0') break;
+
+        const char* v_start = p_line;
+        while (*p_line != '\0' && *p_line != ' ') p_line++;
+        p_args->tok[p_args->count].str = v_start;
+        p_args->tok[p_args->count].len = (p_line - v_start > 255) ? 255 : (uint8_t)(p_line - v_start);
+        p_args->count++;
+    }
+    return p_args->count;
+}
+
+// 정수 토큰 ("-20", "30")
+// @return 숫자로만 이루어져 있으면 true
+bool R310_cmd_toInt(const T_R310_CmdTok_t* p_tok, int16_t* p_value) {
+    uint8_t v_i   = (p_tok->len > 0 && (p_tok->str[0] == '-' || p_tok->str[0] == '+')) ? 1 : 0;
+    int32_t v_val = 0;
+    if (v_i >= p_tok->len) return false;
+    for (; v_i < p_tok->len; v_i++) {
+        if (p_tok->str[v_i] < '0' || p_tok->str[v_i] > '9') return false;
+        v_val = v_val * 10 + (p_tok->str[v_i] - '0');
+        if (v_val > 32767) return false;
+    }
+    *p_value = (int16_t)((p_tok->str[0] == '-') ? -v_val : v_val);
+    return true;
+}
+
+// 고정소수점 토큰 ("2", "0.5", "1.25" -> Q8.8, 양수만)
+// @return 형식이 맞으면 true
+bool R310_cmd_toQ8(const T_R310_CmdTok_t* p_tok, uint16_t* p_valueQ8) {
+    uint32_t v_int   = 0;
+    uint32_t v_frac  = 0;
+    uint32_t v_scale = 1;
+    bool     v_isFrac = false;
+    if (p_tok->len == 0) return false;
+    for (uint8_t v_i = 0; v_i < p_tok->len; v_i++) {
+        char v_c = p_tok->str[v_i];
+        if (v_c == '.' && !v_isFrac) {
+            v_isFrac = true;
+        } else if (v_c >= '0' && v_c <= '9') {
+            if (v_isFrac) {
+                if (v_scale < 10000) { v_frac = v_frac * 10 + (v_c - '0'); v_scale *= 10; }
+            } else {
+                v_int = v_int * 10 + (v_c - '0');
+                if (v_int > 255) return false;
+            }
+        } else {
+            return false;
+        }
+    }
+    *p_valueQ8 = (uint16_t)((v_int << 8) + (v_frac << 8) / v_scale);
+    return true;
+}
+
+// p_idx 번째 토큰을 정수로 (없거나 숫자가 아니면 p_default)
+int16_t R310_cmd_argInt(const T_R310_CmdArgs_t* p_args, uint8_t p_idx, int16_t p_default) {
+    int16_t v_value;
+    if (p_idx >= p_args->count || !R310_cmd_toInt(&p_args->tok[p_idx], &v_value)) return p_default;
+    return v_value;
+}
+
+// 공통 옵션 "x<N>", "speed <실수>" 를 찾습니다. (위치와 무관, 없으면 기본값)
+void R310_cmd_parseOpts(const T_R310_CmdArgs_t* p_args, T_R310_CmdOpts_t* p_opts) {
+    p_opts->repeat  = 1;
+    p_opts->speedQ8 = G_R310_CMD_SPEED_1X;
+    for (uint8_t v_i = 1; v_i < p_args->count; v_i++) {
+        const T_R310_CmdTok_t* v_tok = &p_args->tok[v_i];
+        if (v_tok->len >= 2 && v_tok->str[0] == 'x') {
+            T_R310_CmdTok_t v_num = { v_tok->str + 1, (uint8_t)(v_tok->len - 1) };
+            int16_t         v_repeat;
+            if (R310_cmd_toInt(&v_num, &v_repeat)) p_opts->repeat = (uint8_t)constrain((int)v_repeat, 1, G_R310_CMD_MAX_REPEAT);
+        } else if (v_tok->len == 5 && strncmp(v_tok->str, "speed", 5) == 0 && v_i + 1 < p_args->count) {
+            uint16_t v_speedQ8;
+            if (R310_cmd_toQ8(&p_args->tok[++v_i], &v_speedQ8)) p_opts->speedQ8 = (uint16_t)constrain((int)v_speedQ8, G_R310_CMD_SPEED_MIN, G_R310_CMD_SPEED_MAX);
+        }
+    }
+}
+
+// 표 상태 출력 (시드, 사용 슬롯)
+void R310_cmd_printTable() {
+    Serial.printf("R310 cmd table: %u commands in %u slots, seed %lu\n",
+                  (unsigned)G_R310_CMD_DEF_COUNT, (unsigned)G_R310_CMD_TABLE_SIZE, (unsigned long)g_R310_cmdTable.seed);
+}
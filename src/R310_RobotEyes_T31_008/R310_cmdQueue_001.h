@@ -0,0 +1,186 @@
+#pragma once
+
+// R310_cmdQueue_001.h - 애니메이션 요청 큐 (생산자별 단일 생산자/단일 소비자 무잠금 링 + 소비자 측 재생 대기열)
+// emotionIdx_next 한 칸만 있으면 한 프레임에 들어온 여러 요청(시리얼, 차량 상태 이벤트 등) 중 마지막만 남습니다.
+// 생산자(요청을 넣는 태스크)마다 링을 하나씩 두어 다른 태스크/코어에서도 잠금 없이 넣을 수 있게 하고,
+// 소비자(R310 루프)는 틱마다 링을 비우면서 요청별 병합 방식으로 재생 대기열에 옮깁니다.
+//   CMDQ_REPLACE      : 대기열을 비우고 바로 재생 (같은 틱의 앞선 REPLACE 는 병합되어 버려짐, 기존 강제 재생과 같음)
+//   CMDQ_APPEND       : 대기열 끝에 추가, 현재 시퀀스/텍스트가 끝나면 순서대로 재생
+//   CMDQ_DROP_IF_BUSY : 재생 중이거나 대기열이 있으면 버림 (자동 반응처럼 끼어들 필요 없는 요청)
+//
+// 링 인덱스는 자유 증가 uint8_t 이며, head 는 생산자만, tail 은 소비자만 씁니다. (획득/해제 순서의 원자적 읽기/쓰기)
+
+#include "R310_config_009.h"
+
+#define G_R310_CMDQ_RING_SIZE   8       // 생산자별 링 크기 (2의 거듭제곱)
+#define G_R310_CMDQ_LIST_SIZE   8       // 재생 대기열 크기 (APPEND)
+
+static_assert((G_R310_CMDQ_RING_SIZE & (G_R310_CMDQ_RING_SIZE - 1)) == 0 && G_R310_CMDQ_RING_SIZE <= 128, "링 크기는 128 이하의 2의 거듭제곱이어야 합니다");
+
+// 병합 방식
+typedef enum {
+    CMDQ_REPLACE,
+    CMDQ_APPEND,
+    CMDQ_DROP_IF_BUSY,
+} T_R310_CmdQ_Mode_t;
+
+// 생산자 (링 하나씩, 같은 링에는 한 태스크만 넣어야 함)
+typedef enum {
+    CMDQ_SRC_LOOP,      // R310 루프 태스크 (시리얼 명령)
+    CMDQ_SRC_EXTERN,    // 다른 태스크/코어 (차량 상태 이벤트 등, R310_postAnimation)
+    CMDQ_SRC_COUNT
+} T_R310_CmdQ_Src_t;
+
+// 애니메이션 요청
+typedef struct {
+    uint8_t     emotionIdx;         // T_R310_emotion_idx_t
+    uint8_t     autoReverse;        // EMTP_Ply_AutoReverse_t
+    uint8_t     playDirection;      // EMTP_Ply_Direct_t
+    uint8_t     mode;               // T_R310_CmdQ_Mode_t
+    int8_t      clipSlot;           // 이름으로 재생할 외부 클립 슬롯 (R310_clip_001.h, -1: 감정으로 조회)
+    uint16_t    speedQ8;            // 재생 속도 배율 (Q8.8, 256 = 1배)
+    uint32_t    postUs;             // 넣은 시각 (대기 지연 통계, 마이크로초)
+} T_R310_AniCmd_t;
+
+// 단일 생산자/단일 소비자 링
+typedef struct {
+    T_R310_AniCmd_t     slots[G_R310_CMDQ_RING_SIZE];
+    uint8_t             head;           // 다음에 쓸 위치 (생산자만 씀)
+    uint8_t             tail;           // 다음에 읽을 위치 (소비자만 씀)
+    uint32_t            posted;         // 넣은 요청 수 (생산자)
+    uint32_t            dropsFull;      // 링이 가득 차 버린 요청 수 (생산자)
+    uint32_t            postUsMax;      // 넣기 최대 소요 시간 (생산자, 마이크로초)
+} T_R310_CmdRing_t;
+
+// 인스턴스 요청 큐
+typedef struct {
+    T_R310_CmdRing_t    rings[CMDQ_SRC_COUNT];
+    T_R310_AniCmd_t     list[G_R310_CMDQ_LIST_SIZE];   // 재생 대기열 (소비자 전용)
+    uint8_t             listHead;
+    uint8_t             listCount;
+    // 소비자 통계
+    uint32_t            started;        // 재생을 시작한 요청 수
+    uint32_t            coalesced;      // 뒤 REPLACE 에 병합되어 버려진 요청 수 (대기열에서 지워진 APPEND 포함)
+    uint32_t            dropsBusy;      // DROP_IF_BUSY 로 버린 요청 수
+    uint32_t            dropsList;      // 대기열이 가득 차 버린 요청 수
+    uint32_t            waitUsSum;      // 넣은 뒤 재생 시작까지 누적 시간
+    uint32_t            waitUsMax;      // 넣은 뒤 재생 시작까지 최대 시간
+} T_R310_CmdQueue_t;
+
+
+// 요청 큐 초기화 (생산자가 없을 때만 호출)
+void R310_cmdq_init(T_R310_CmdQueue_t* p_queue) {
+    memset(p_queue, 0, sizeof(T_R310_CmdQueue_t));
+}
+
+// 요청을 생산자 링에 넣습니다. (생산자 태스크에서 호출, 잠금/블로킹 없음)
+// @return 넣었으면 true, 링이 가득 찼으면 false (dropsFull 증가)
+bool G_R310_HOT_CODE R310_cmdq_post(T_R310_CmdQueue_t* p_queue, T_R310_CmdQ_Src_t p_src, const T_R310_AniCmd_t* p_cmd) {
+    uint32_t          v_startUs = micros();
+    T_R310_CmdRing_t* v_ring    = &p_queue->rings[p_src];
+    uint8_t           v_head    = v_ring->head;
+    uint8_t           v_tail    = __atomic_load_n(&v_ring->tail, __ATOMIC_ACQUIRE);
+
+    if ((uint8_t)(v_head - v_tail) >= G_R310_CMDQ_RING_SIZE) {
+        v_ring->dropsFull++;
+        return false;
+    }
+    v_ring->slots[v_head & (G_R310_CMDQ_RING_SIZE - 1)]        = *p_cmd;
+    v_ring->slots[v_head & (G_R310_CMDQ_RING_SIZE - 1)].postUs = v_startUs;
+    __atomic_store_n(&v_ring->head, (uint8_t)(v_head + 1), __ATOMIC_RELEASE); // 슬롯 기록이 head 갱신보다 먼저 보이도록
+
+    v_ring->posted++;
+    uint32_t v_postUs = micros() - v_startUs;
+    if (v_postUs > v_ring->postUsMax) v_ring->postUsMax = v_postUs;
+    return true;
+}
+
+// 소비자가 아직 꺼내지 않은 요청이 링에 있는지 (틱마다 인스턴스 상태를 읽기 전에 확인)
+bool G_R310_HOT_CODE R310_cmdq_hasPosted(T_R310_CmdQueue_t* p_queue) {
+    for (uint8_t v_src = 0; v_src < CMDQ_SRC_COUNT; v_src++) {
+        if (__atomic_load_n(&p_queue->rings[v_src].head, __ATOMIC_ACQUIRE) != p_queue->rings[v_src].tail) return true;
+    }
+    return false;
+}
+
+// 재생 대기열 끝에 추가합니다. (소비자 전용)
+void R310_cmdq_listPush(T_R310_CmdQueue_t* p_queue, const T_R310_AniCmd_t* p_cmd) {
+    if (p_queue->listCount >= G_R310_CMDQ_LIST_SIZE) {
+        p_queue->dropsList++;
+        return;
+    }
+    p_queue->list[(p_queue->listHead + p_queue->listCount) % G_R310_CMDQ_LIST_SIZE] = *p_cmd;
+    p_queue->listCount++;
+}
+
+// 모든 생산자 링을 비우면서 병합 방식을 적용합니다. (소비자 전용, 틱마다 호출)
+// 링이 비어 있으면 생산자별 head 비교 한 번으로 끝납니다.
+// @param p_isBusy 현재 시퀀스/텍스트를 재생 중인지 (DROP_IF_BUSY 판정)
+// @param p_start 바로 재생할 요청 (REPLACE, 여럿이면 마지막)
+// @return 바로 재생할 요청이 있으면 true
+bool G_R310_HOT_CODE R310_cmdq_drain(T_R310_CmdQueue_t* p_queue, bool p_isBusy, T_R310_AniCmd_t* p_start) {
+    bool v_hasStart = false;
+
+    for (uint8_t v_src = 0; v_src < CMDQ_SRC_COUNT; v_src++) {
+        T_R310_CmdRing_t* v_ring = &p_queue->rings[v_src];
+        uint8_t           v_tail = v_ring->tail;
+        uint8_t           v_head = __atomic_load_n(&v_ring->head, __ATOMIC_ACQUIRE);
+
+        for (; v_tail != v_head; v_tail++) {
+            const T_R310_AniCmd_t* v_cmd = &v_ring->slots[v_tail & (G_R310_CMDQ_RING_SIZE - 1)];
+            switch (v_cmd->mode) {
+                case CMDQ_REPLACE:
+                    p_queue->coalesced += p_queue->listCount + (v_hasStart ? 1 : 0);
+                    p_queue->listCount  = 0;
+                    *p_start            = *v_cmd;
+                    v_hasStart          = true;
+                    break;
+                case CMDQ_DROP_IF_BUSY:
+                    if (p_isBusy || v_hasStart || p_queue->listCount > 0) {
+                        p_queue->dropsBusy++;
+                        break;
+                    }
+                    R310_cmdq_listPush(p_queue, v_cmd);
+                    break;
+                default: // CMDQ_APPEND
+                    R310_cmdq_listPush(p_queue, v_cmd);
+                    break;
+            }
+        }
+        __atomic_store_n(&v_ring->tail, v_tail, __ATOMIC_RELEASE); // 슬롯을 다 읽은 뒤 생산자에게 반환
+    }
+    return v_hasStart;
+}
+
+// 재생 대기열 맨 앞 요청을 꺼냅니다. (소비자 전용, 현재 시퀀스가 끝났을 때)
+bool R310_cmdq_pop(T_R310_CmdQueue_t* p_queue, T_R310_AniCmd_t* p_cmd) {
+    if (p_queue->listCount == 0) return false;
+    *p_cmd            = p_queue->list[p_queue->listHead];
+    p_queue->listHead = (p_queue->listHead + 1) % G_R310_CMDQ_LIST_SIZE;
+    p_queue->listCount--;
+    return true;
+}
+
+// 요청의 재생 시작을 기록합니다. (넣은 뒤 시작까지 대기 지연)
+void R310_cmdq_noteStart(T_R310_CmdQueue_t* p_queue, const T_R310_AniCmd_t* p_cmd) {
+    uint32_t v_waitUs = micros() - p_cmd->postUs;
+    p_queue->started++;
+    p_queue->waitUsSum += v_waitUs;
+    if (v_waitUs > p_queue->waitUsMax) p_queue->waitUsMax = v_waitUs;
+}
+
+// 요청 큐 통계 출력
+void R310_cmdq_printStats(const T_R310_CmdQueue_t* p_queue) {
+    uint32_t v_posted = 0, v_dropsFull = 0, v_postUsMax = 0;
+    for (uint8_t v_src = 0; v_src < CMDQ_SRC_COUNT; v_src++) {
+        v_posted    += p_queue->rings[v_src].posted;
+        v_dropsFull += p_queue->rings[v_src].dropsFull;
+        if (p_queue->rings[v_src].postUsMax > v_postUsMax) v_postUsMax = p_queue->rings[v_src].postUsMax;
+    }
+    Serial.printf("R310 cmdq: posted %lu (post max %lu us), started %lu (wait avg %lu us / max %lu us), coalesced %lu, "
+                  "drops full %lu / busy %lu / list %lu, pending %u\n",
+                  (unsigned long)v_posted, (unsigned long)v_postUsMax, (unsigned long)p_queue->started,
+                  (unsigned long)(p_queue->started ? p_queue->waitUsSum / p_queue->started : 0), (unsigned long)p_queue->waitUsMax,
+                  (unsigned long)p_queue->coalesced, (unsigned long)v_dropsFull, (unsigned long)p_queue->dropsBusy,
+                  (unsigned long)p_queue->dropsList, (unsigned)p_queue->listCount);
+}
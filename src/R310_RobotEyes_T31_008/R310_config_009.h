@@ -13,11 +13,18 @@
 #define G_R310_ONBOARD_WS2812_PIN   21
 
 
+// --- 눈 패널 크기 (8: 8x8 매트릭스 2개, 16: 16x16 매트릭스 2개) ---
+// 폰트, 프레임버퍼, 픽셀 매핑, 크로스페이드/전원/텍스트 버퍼 크기가 모두 이 값에서 정해집니다.
+// (platformio.ini 의 build_flags 에서 -DG_R310_PANEL_SIZE=16 으로도 지정 가능)
+#ifndef G_R310_PANEL_SIZE
+    #define G_R310_PANEL_SIZE		 8
+#endif
+
 // --- WS2812b (FastLED) 하드웨어 설정 (전역 상수: G_R310_ 로 시작) ---
 // WS2812b LED 데이터 핀 번호
 #define G_R310_NEOPIXEL_PIN			 13
-// WS2812b LED 총 개수 (8x8 매트릭스 2개)
-#define G_R310_NEOPIXEL_NUM_LEDS	 128
+// WS2812b LED 총 개수 (눈 패널 2개)
+#define G_R310_NEOPIXEL_NUM_LEDS	 (2 * G_R310_PANEL_SIZE * G_R310_PANEL_SIZE)
 // LED 칩셋 타입
 #define G_R310_LED_TYPE				 WS2812B
 // LED 색상 순서 (일반적으로 GRB)
@@ -25,15 +32,25 @@
 // 눈 색상
 #define G_R310_EYE_COLOR			 CRGB::White
 
-// --- 디스플레이 레이아웃 설정 (8x8 매트릭스 2개 기준, 전역 상수: G_R310_ 로 시작) ---
+// --- 전원 예산 설정 (R310_power_001.h) ---
+// LED 전류 예산 (밀리암페어, 차량 USB 전원 브라운아웃 방지)
+#define G_R310_POWER_BUDGET_MA		 1000
+// 사용자 기본 밝기 (0-255, 전류 예산을 넘으면 자동으로 낮춤)
+#define G_R310_BRIGHTNESS			 20
+
+// --- 디스플레이 레이아웃 설정 (눈 패널 2개 기준, 전역 상수: G_R310_ 로 시작) ---
 // 전체 디스플레이 너비 (픽셀)
 // #define G_R310_DISPLAY_WIDTH 16
 
 
-#define G_R310_DISPLAY_HEIGHT		 8          // 전체 디스플레이 높이 (픽셀)
+#define G_R310_DISPLAY_HEIGHT		 G_R310_PANEL_SIZE  // 전체 디스플레이 높이 (픽셀)
 
-#define G_R310_RIGHT_EYE_START_PIXEL 0          // 오른쪽 눈 시작 픽셀 인덱스 (하드웨어 배선에 맞게 수정 필요)
-#define G_R310_LEFT_EYE_START_PIXEL	 64         // 왼쪽 눈 시작 픽셀 인덱스 (하드웨어 배선에 맞게 수정 필요)
+#define G_R310_RIGHT_EYE_START_PIXEL 0                                      // 오른쪽 눈 시작 픽셀 인덱스 (하드웨어 배선에 맞게 수정 필요)
+#define G_R310_LEFT_EYE_START_PIXEL	 (G_R310_PANEL_SIZE * G_R310_PANEL_SIZE)  // 왼쪽 눈 시작 픽셀 인덱스 (하드웨어 배선에 맞게 수정 필요)
+
+// 패널 배선 순서 및 장착 회전 (R310_pixelMap_001.h 의 T_R310_PanelOrder_t / T_R310_PanelRotation_t 값)
+#define G_R310_PANEL_ORDER			 R310_PANEL_ORDER_SERPENTINE
+#define G_R310_PANEL_ROTATION		 R310_PANEL_ROT_0
 
 // 눈 하나당 픽셀 개수 (8x8)
 // #define G_R310_EYE_MATRIX_SIZE 64
@@ -41,14 +58,40 @@
 // --- 기타 정의 (전역 상수: G_R310_ 로 시작) ---
 // 배열 요소 개수 계산 매크로
 #define G_R310_ARRAY_SIZE(a)		 (sizeof(a) / sizeof(a[0]))
-// 눈 폰트 데이터 열 개수 (8x8 비트맵)
-#define G_R310_EYE_COL_SIZE			 8
+// 눈 패널 열 개수 (패널 너비)
+#define G_R310_EYE_COL_SIZE			 G_R310_PANEL_SIZE
+
+// --- 눈 인스턴스 수 (눈 한 쌍 = 패널 2개, 모든 인스턴스는 같은 데이터 핀에 체인 배선) ---
+// 인스턴스 i 는 체인의 i * G_R310_NEOPIXEL_NUM_LEDS 픽셀부터 사용합니다. (예: 2 = 앞/뒤 눈 한 쌍씩)
+#ifndef G_R310_EYES_COUNT
+    #define G_R310_EYES_COUNT		 1
+#endif
+// 체인 전체 LED 개수 (출력 단계 프런트 버퍼 크기)
+#define G_R310_LEDOUT_NUM_LEDS		 (G_R310_EYES_COUNT * G_R310_NEOPIXEL_NUM_LEDS)
+
+static_assert(G_R310_PANEL_SIZE == 8 || G_R310_PANEL_SIZE == 16, "G_R310_PANEL_SIZE 는 8 또는 16 이어야 합니다");
+
+// --- 렌더링 경로 메모리 배치 (R310_hotTables_001.h) ---
+// ESP32 에서는 프레임마다 닿는 LUT 를 DRAM, 프레임 렌더러를 IRAM 에 두어 플래시 캐시 미스(LittleFS 쓰기 직후 등)를 피합니다.
+#if defined(ARDUINO_ARCH_ESP32)
+    #define G_R310_HOT_DATA			 DRAM_ATTR
+    #define G_R310_HOT_CODE			 IRAM_ATTR
+#else
+    #define G_R310_HOT_DATA
+    #define G_R310_HOT_CODE
+#endif
 
 // 애니메이션 프레임 기본 표시 시간 (밀리초)
 #define G_R310_FRAME_TIME			 100
 
+// 크로스페이드 시퀀스의 화면 갱신 주기 (밀리초, 10 = 100fps)
+#define G_R310_CROSSFADE_REFRESH_MS	 10
+
 // 표시할 텍스트 최대 길이 (고정 버퍼 크기)
 #define G_R310_MAX_TEXT_LENGTH		 31	 // 최대 31자 + 널 종료 문자
 
+// 텍스트 마퀴 스크롤 속도 (초당 픽셀)
+#define G_R310_TEXT_SCROLL_PPS		 20
+
 // 로봇 상태 관리를 위한 비활성 시간 기준 선언
 //extern const unsigned long G_R310_TIME_TO_SLEEP;
@@ -0,0 +1,62 @@
+#pragma once
+
+// R310_crossfade_001.h - 애니메이션 프레임 간 크로스페이드 (시간축 블렌딩)
+// 이전 프레임(from)과 다음 프레임(to)의 CRGB 버퍼를 두고, 프레임 표시 시간(timeFrame) 동안
+// 고정소수점 lerp8by8 로 섞어 인스턴스의 백 버퍼 구간(output.leds)에 기록합니다. 폰트 프레임을 늘리지 않고도 부드러운 전환을 얻습니다.
+// 블렌딩은 패널 한 행(8x8 기준 8픽셀, 24바이트) 단위로 처리하며, from/to 가 같은 행은 복사만 합니다.
+
+#include "R310_config_009.h"
+
+#define G_R310_XF_ROW_PIXELS    G_R310_EYE_COL_SIZE                     // 블렌딩 행 단위 (픽셀)
+#define G_R310_XF_ROW_BYTES     (G_R310_XF_ROW_PIXELS * sizeof(CRGB))   // 블렌딩 행 단위 (바이트)
+
+static_assert(G_R310_NEOPIXEL_NUM_LEDS % G_R310_XF_ROW_PIXELS == 0, "LED 수는 블렌딩 행 단위의 배수여야 합니다");
+
+// 크로스페이드 상태 구조체
+typedef struct {
+    CRGB        from[G_R310_NEOPIXEL_NUM_LEDS];     // 전환 시작 시점의 화면 (직전 출력)
+    CRGB        to[G_R310_NEOPIXEL_NUM_LEDS];       // 전환 목표 프레임 (프레임버퍼 확장 결과)
+    bool        isActive;                           // 크로스페이드 진행 중 여부
+    uint32_t    startTime;                          // 전환 시작 시간 (밀리초)
+    uint32_t    lastStepTime;                       // 마지막 갱신 시간 (밀리초)
+    uint16_t    duration;                           // 전환 시간 (밀리초, 프레임의 timeFrame)
+} T_R310_Crossfade_t;
+
+
+// 패널 한 행의 채널 값 합 (R+G+B)
+uint16_t G_R310_HOT_CODE R310_xf_rowSum(const uint8_t* p_row) {
+    uint16_t v_sum = 0;
+    for (uint8_t v_i = 0; v_i < G_R310_XF_ROW_BYTES; v_i++) v_sum += p_row[v_i];
+    return v_sum;
+}
+
+// from -> to 를 p_amount(0~255) 비율로 섞어 p_out 에 기록합니다. (패널 행 단위)
+// 전원 제한기용으로 행마다 출력 채널 합을 함께 계산할 수 있습니다. (블렌딩 루프에서 누적하므로 추가 순회 없음)
+// @param p_count 픽셀 수 (G_R310_XF_ROW_PIXELS 의 배수)
+// @param p_rowSums 행별 채널 합 출력 (p_count / G_R310_XF_ROW_PIXELS 개, nullptr 이면 계산 생략)
+void G_R310_HOT_CODE R310_xf_blendRows(const CRGB* p_from, const CRGB* p_to, CRGB* p_out, uint16_t p_count, fract8 p_amount, uint16_t* p_rowSums = nullptr) {
+    const uint8_t* v_from = (const uint8_t*)p_from;
+    const uint8_t* v_to   = (const uint8_t*)p_to;
+    uint8_t*       v_out  = (uint8_t*)p_out;
+
+    for (uint16_t v_pos = 0; v_pos < p_count * sizeof(CRGB); v_pos += G_R310_XF_ROW_BYTES) {
+        if (memcmp(&v_from[v_pos], &v_to[v_pos], G_R310_XF_ROW_BYTES) == 0) {
+            memcpy(&v_out[v_pos], &v_to[v_pos], G_R310_XF_ROW_BYTES); // 변화 없는 행 (꺼진 영역 등)
+            if (p_rowSums != nullptr) p_rowSums[v_pos / G_R310_XF_ROW_BYTES] = R310_xf_rowSum(&v_to[v_pos]);
+            continue;
+        }
+        uint16_t v_sum = 0;
+        for (uint8_t v_i = 0; v_i < G_R310_XF_ROW_BYTES; v_i++) {
+            v_out[v_pos + v_i] = lerp8by8(v_from[v_pos + v_i], v_to[v_pos + v_i], p_amount);
+            v_sum += v_out[v_pos + v_i];
+        }
+        if (p_rowSums != nullptr) p_rowSums[v_pos / G_R310_XF_ROW_BYTES] = v_sum;
+    }
+}
+
+// 경과 시간에 해당하는 블렌딩 비율 (0~255, 전환 완료 시 255)
+fract8 G_R310_HOT_CODE R310_xf_amount(const T_R310_Crossfade_t* p_xf, uint32_t p_now) {
+    uint32_t v_elapsed = p_now - p_xf->startTime;
+    if (p_xf->duration == 0 || v_elapsed >= p_xf->duration) return 255;
+    return (fract8)((v_elapsed * 255) / p_xf->duration);
+}
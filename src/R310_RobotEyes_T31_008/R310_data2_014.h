@@ -7,6 +7,7 @@
 // 기본 타입 및 설정 헤더 파일 포함
 // 이 헤더 파일은 T_R310_로 시작하는 구조체 및 열거형과 G_R310_로 시작하는 상수를 정의합니다.
 #include "R310_config_009.h" // G_R310_FRAME_TIME 및 G_R310_ARRAY_SIZE 정의를 포함해야 합니다.
+#include "R310_glyph_001.h"  // 글리프 크기 템플릿 (T_R310_Glyph_t)
 
 
 // --- 전역 상수 정의 (G_R310_ 로 시작) ---
@@ -48,12 +49,15 @@ typedef enum {
     EMTP_FORCE_PLY_ON,
 } EMTP_Ply_Force_t;
 
+typedef enum {
+    EMTP_BLEND_OFF,         // 프레임 전환 시 즉시 교체
+    EMTP_BLEND_CROSSFADE,   // 이전 프레임 -> 다음 프레임을 timeFrame 동안 크로스페이드
+} EMTP_Ply_Blend_t;
 
-// --- 폰트 문자 하나를 나타내는 구조체 정의 8x8 픽셀 이미지를 저장하는 데 사용
-typedef struct {
-    uint8_t width;      // 문자의 너비 (여기서는 모든 이미지가 8픽셀이므로 8)
-    uint8_t data[8];    // 문자의 픽셀 데이터 (각 바이트가 한 행을 나타냅니다)
-} T_R310_FontChar_t;
+
+// --- 폰트 문자 하나를 나타내는 구조체 정의 8x8 픽셀 이미지를 저장하는 데 사용 (width = 8, data = 행당 1바이트)
+// 16x16 글리프와 같은 T_R310_Glyph_t 템플릿입니다. (폰트 테이블은 R310_fontGen_001.h)
+typedef T_R310_Glyph_t<8, 8> T_R310_FontChar_t;
 
 
 // Eye의 왼쪽,오른쪽 관리를 위한 열거형
@@ -64,22 +68,22 @@ typedef enum {
 
 
 // --- 로봇 눈 모양 폰트 인덱스를 위한 열거형 정의 --- 각 폰트 인덱스는 특정 눈 모양에 대한 의미 있는 이름을 가집니다.
+// 폰트 테이블에는 서로 변환(G_R310_TF_*)으로 얻을 수 없는 글리프만 저장합니다. 파생 모양은 각 그룹 주석의 "글리프 + 변환" 으로 그립니다.
 typedef enum {
-    // 기본 눈 모양 (인덱스 0-4)
+    // 기본 눈 모양 (인덱스 0-1)
     EYE_NEUTRAL = 0,           // 중립/행복한 눈
-
     EYE_LOOK_DOWN_2,           // 아래쪽 먼 곳을 보는 눈
-    EYE_LOOK_DOWN_1,           // 아래쪽 중앙을 보는 눈
-    EYE_LOOK_UP_1,             // 위쪽 중앙을 보는 눈
-    EYE_LOOK_UP_2,             // 위쪽 먼 곳을 보는 눈
+    //   아래쪽 중앙(LOOK_DOWN_1) = EYE_LOOK_DOWN_2 + G_R310_TF_SHIFT(0, -1)
+    //   위쪽 중앙(LOOK_UP_1)     = EYE_LOOK_DOWN_2 + G_R310_TF_MIRROR_V | G_R310_TF_SHIFT(0, 1)
+    //   위쪽 먼 곳(LOOK_UP_2)    = EYE_LOOK_DOWN_2 + G_R310_TF_MIRROR_V
 
-    // 좌우 시선 이동 눈 모양 (인덱스 5-8)
+    // 좌우 시선 이동 눈 모양 (인덱스 2)
     EYE_LOOK_LEFT_2,           // 왼쪽을 보는 눈 (작은 눈동자)
-    EYE_LOOK_LEFT_1,           // 오른쪽을 보는 눈 (작은 눈동자)
-    EYE_LOOK_RIGHT_1,          // 왼쪽을 보는 눈 (비대칭)
-    EYE_LOOK_RIGHT_2,          // 오른쪽을 보는 눈 (비대칭)
+    //   LOOK_LEFT_1  = EYE_LOOK_LEFT_2 + G_R310_TF_SHIFT(1, 0)
+    //   LOOK_RIGHT_1 = EYE_LOOK_LEFT_2 + G_R310_TF_MIRROR_H | G_R310_TF_SHIFT(-1, 0)
+    //   LOOK_RIGHT_2 = EYE_LOOK_LEFT_2 + G_R310_TF_MIRROR_H
 
-    // 감기거나 찡그린 눈 모양 (인덱스 9-13)
+    // 감기거나 찡그린 눈 모양 (인덱스 3-7)
     EYE_CLOSE_1,               // 눈꺼풀이 절반 감긴 눈
     EYE_CLOSE_2,               // 눈꺼풀이 더 감긴 눈
     EYE_CLOSE_3,               // 눈꺼풀이 거의 감긴 눈
@@ -88,58 +92,75 @@ typedef enum {
 
     EYE_ALL_OFF,               // 모든 픽셀이 꺼진 눈
 
-    // 슬픈 눈 모양 (인덱스 15-20)
+    // 슬픈 눈 모양 (인덱스 9-11)
     EYE_SAD_RIGHT_1,           // 슬픈 오른쪽 눈 1 (눈꼬리 처짐 시작)
     EYE_SAD_LEFT_1,            // 슬픈 왼쪽 눈 1 (눈꼬리 처짐 시작)
     EYE_SAD_RIGHT_2,           // 슬픈 오른쪽 눈 2 (눈꼬리 더 처짐)
-    EYE_SAD_LEFT_2,            // 슬픈 왼쪽 눈 2 (눈꼬리 더 처짐)
-    EYE_SAD_RIGHT_3,           // 슬픈 오른쪽 눈 3 (가장 슬픈 눈)
-    EYE_SAD_LEFT_3,            // 슬픈 왼쪽 눈 3 (가장 슬픈 눈)
+    //   SAD_LEFT_2             = EYE_SAD_RIGHT_1 + G_R310_TF_MIRROR_H
+    //   SAD_RIGHT_3, SAD_LEFT_3 = EYE_SAD_LEFT_1 + G_R310_TF_MIRROR_V
 
-    // 대각선 시선 이동 눈 모양 (인덱스 21-30)
-    EYS_DIAGONAL_RIGHT_1,
+    // 대각선 시선 이동 눈 모양 (인덱스 12-17)
     EYS_DIAGONAL_RIGHT_2,
     EYS_DIAGONAL_RIGHT_3,
     EYS_DIAGONAL_RIGHT_4,
     EYS_DIAGONAL_RIGHT_5,
     EYS_DIAGONAL_LEFT_1,
     EYS_DIAGONAL_LEFT_2,
-    EYS_DIAGONAL_LEFT_3,
-    EYS_DIAGONAL_LEFT_4,
-    EYS_DIAGONAL_LEFT_5,
+    //   DIAGONAL_RIGHT_1   = EYE_SAD_LEFT_1 (같은 글리프)
+    //   DIAGONAL_LEFT_3~5  = EYS_DIAGONAL_RIGHT_3~5 + G_R310_TF_MIRROR_V
 
-    // X자 눈 모양 (인덱스 31-32)
+    // X자 눈 모양 (인덱스 18-19)
     EYE_X_SHAPE_1,             // X자 눈 모양 1
     EYE_X_SHAPE_2,             // X자 눈 모양 2
 
-    // 화난 눈 모양 (인덱스 33-38)
+    // 화난 눈 모양 (인덱스 20-23)
     EYE_ANGRY_RIGHT_1,         // 화난 오른쪽 눈 1 (눈썹 찡그림 시작)
     EYE_ANGRY_LEFT_1,          // 화난 왼쪽 눈 1 (눈썹 찡그림 시작)
     EYE_ANGRY_RIGHT_2,         // 화난 오른쪽 눈 2 (눈썹 더 찡그림)
     EYE_ANGRY_LEFT_2,          // 화난 왼쪽 눈 2 (눈썹 더 찡그림)
-    EYE_ANGRY_RIGHT_3,         // 화난 오른쪽 눈 3 (가장 화난 눈)
-    EYE_ANGRY_LEFT_3,          // 화난 왼쪽 눈 3 (가장 화난 눈)
-
-    // 사악한 눈 모양 (인덱스 39-42)
-    EYE_EVIL_RIGHT_1,          // 사악한 오른쪽 눈 1 (눈썹 치켜올림 시작)
-    EYE_EVIL_LEFT_1,           // 사악한 왼쪽 눈 1 (눈썹 치켜올림 시작)
-    EYE_EVIL_RIGHT_2,          // 사악한 오른쪽 눈 2 (가장 사악한 눈)
-    EYE_EVIL_LEFT_2,           // 사악한 왼쪽 눈 2 (가장 사악한 눈)
+    //   ANGRY_RIGHT_3, ANGRY_LEFT_3 = EYE_ANGRY_RIGHT_2 + G_R310_TF_INVERT
+    //   EVIL_RIGHT_1, EVIL_LEFT_1   = EYE_ANGRY_LEFT_2 (같은 글리프)
+    //   EVIL_RIGHT_2, EVIL_LEFT_2   = EYE_ANGRY_RIGHT_2 + G_R310_TF_INVERT
 
-    // 스캔 및 복합 눈 모양 (인덱스 43-48)
-    EYE_SCAN_LR_1,             // 좌우 스캔 눈동자 1 (왼쪽 끝)
+    // 스캔 눈 모양 (인덱스 24-25)
     EYE_SCAN_LR_2,             // 좌우 스캔 눈동자 2 (중간)
     EYE_SCAN_LR_3,             // 좌우 스캔 눈동자 3 (오른쪽 끝)
-    EYE_SCAN_UD_1,             // 상하 스캔 눈동자 1 (위쪽 중간)
-    EYE_SCAN_UD_2,             // 상하 스캔 눈동자 2 (중간)
-    EYE_SCAN_UD_3,             // 상하 스캔 눈동자 3 (아래쪽 끝)
-
-    // 기타 눈 모양 (인덱스 49-55)
-    EYE_SQUINTED,              // 찡그린 눈 (최대로 찡그린)
+    //   SCAN_LR_1 = EYE_X_SHAPE_1 + G_R310_TF_SHIFT(0, 1)
+    //   SCAN_UD_1 = EYE_X_SHAPE_2 + G_R310_TF_MIRROR_H | G_R310_TF_SHIFT(0, 1)
+    //   SCAN_UD_2 = EYE_SCAN_LR_2 + G_R310_TF_ROT180
+    //   SCAN_UD_3 = EYE_SCAN_LR_3 + G_R310_TF_MIRROR_V
+    //   SQUINTED  = EYE_SCAN_LR_2 + G_R310_TF_MIRROR_H (찡그린 눈)
 
 } T_R310_EyeFontIndex_t;
 
 
+// 폰트 인덱스 최상위 비트가 1이면 2bpp 팔레트 글리프(g_R310_RobotEyes_Font2bpp_arr)를 가리킵니다.
+#define G_R310_FONT_2BPP_FLAG       0x80
+
+
+// --- 눈별 글리프 변환 플래그 (T_R310_ani_Frame_t::eyeTransform, 1bpp 글리프 전용)
+// 적용 순서: 좌우/상하 반전 -> 이동(dx, dy) -> 반전(invert). 이동량은 8x8 글리프 픽셀 단위이며 16x16 패널에서는 2배로 적용됩니다.
+// 좌우 대칭 눈, 눈동자 1픽셀 이동 등은 저장된 글리프 하나에 변환을 붙여 표현하므로 폰트 테이블에 따로 두지 않습니다.
+#define G_R310_TF_NONE              0x00
+#define G_R310_TF_MIRROR_H          0x01    // 좌우 반전 (열 n <-> 열 W-1-n)
+#define G_R310_TF_MIRROR_V          0x02    // 상하 반전 (행 n <-> 행 H-1-n)
+#define G_R310_TF_INVERT            0x04    // 픽셀 반전 (이동으로 비워진 영역 포함)
+#define G_R310_TF_ROT180            (G_R310_TF_MIRROR_H | G_R310_TF_MIRROR_V)
+
+// 이동량 dx(+: 오른쪽 열), dy(+: 아래 행), 각각 2비트 부호 있는 값 (-2 ~ +1)
+#define G_R310_TF_SHIFT(dx, dy)     ((uint8_t)((((dx) & 0x03) << 3) | (((dy) & 0x03) << 5)))
+#define G_R310_TF_DX(tf)            ((int8_t)((uint8_t)((tf) << 3)) >> 6)
+#define G_R310_TF_DY(tf)            ((int8_t)((uint8_t)((tf) << 1)) >> 6)
+
+// --- 2bpp(4색) 팔레트 글리프 인덱스 (R310_palette_001.h 의 g_R310_RobotEyes_Font2bpp_arr 순서)
+typedef enum {
+    EYE2_NEUTRAL = G_R310_FONT_2BPP_FLAG,   // 외곽선 + 눈동자 + 하이라이트
+    EYE2_ANGRY_RIGHT,                       // 화난 오른쪽 눈 (눈꺼풀 기울어짐)
+    EYE2_ANGRY_LEFT,                        // 화난 왼쪽 눈 (눈꺼풀 기울어짐)
+    EYE2_SLEEPY,                            // 졸린 눈 (반쯤 감김)
+} T_R310_EyeFont2bppIndex_t;
+
+
 // 로봇 눈 감정 애니메이션 종류
 typedef enum {
 
@@ -161,130 +182,147 @@ typedef enum {
     EMT_SLEEP,         // 잠자는 눈
     EMT_SLEEP_BLINK,
 
+    EMT_ANGRY_COLOR,   // 화남 (2bpp 컬러 글리프)
+
+    EMT_PROC_LOOK,     // 둘러보기 (절차적 눈, R310_procEye_001.h)
+    EMT_PROC_ANGRY,    // 화남 (절차적 눈, R310_procEye_001.h)
+
+    EMT_COUNT          // 감정 개수 (감정별 조회 테이블 크기, 항상 마지막)
 } T_R310_emotion_idx_t;
 
 // 애니메이션 시퀀스 단일 프레임
 typedef struct {
-    uint8_t         eyeData[2];     // [0] = 오른쪽 눈 폰트 인덱스, [1] = 왼쪽 눈 폰트 인덱스
-    uint16_t        timeFrame;      // 프레임 표시 시간 (밀리초)
+    uint8_t         eyeData[2];         // [0] = 오른쪽 눈 폰트 인덱스, [1] = 왼쪽 눈 폰트 인덱스
+    uint16_t        timeFrame;          // 프레임 표시 시간 (밀리초)
+    uint8_t         eyeTransform[2];    // [0] = 오른쪽 눈, [1] = 왼쪽 눈 글리프 변환 (G_R310_TF_*, G_R310_TF_NONE: 변환 없음)
 } T_R310_ani_Frame_t;
 
 
 
+// 로봇 눈 폰트 테이블: shared/R310_sprites 스프라이트 시트에서 생성 (위 T_R310_EyeFontIndex_t 순서 검사 포함)
+#include "R310_fontGen_001.h"
+
+
 // --- 정적 데이터 테이블 정의 (PROGMEM에 저장, g_R310_ 로 시작) ---
-// 각 배열은 특정 감정 애니메이션의 프레임 시퀀스를 나타냅니다.
+// 각 배열은 특정 감정 애니메이션의 프레임 시퀀스를 나타냅니다. (constexpr: 글리프 인덱스를 빌드 시점에 검사)
 // 각 요소는 T_R310_animFrame_t 구조체이며,
-// { {오른쪽 눈 폰트 인덱스, 왼쪽 눈 폰트 인덱스}, 해당 프레임 표시 시간(ms) } 형식입니다.
+// { {오른쪽 눈 폰트 인덱스, 왼쪽 눈 폰트 인덱스}, 해당 프레임 표시 시간(ms) [, {오른쪽 눈 변환, 왼쪽 눈 변환}] } 형식입니다.
 
 // 깜빡임 애니메이션 시퀀스 데이터
-const T_R310_ani_Frame_t g_R310_frameSeq_Blink[] PROGMEM = {
-    {{ EYE_NEUTRAL	, EYE_NEUTRAL	}, G_R310_FRAME_TIME / 2}, // 프레임 0: 기본 눈 모양
-    {{ EYE_CLOSE_1	, EYE_CLOSE_1   }, G_R310_FRAME_TIME / 2}, // 프레임 1: 살짝 감김
-    {{ EYE_CLOSE_2	, EYE_CLOSE_2   }, G_R310_FRAME_TIME / 2}, // 프레임 2: 더 감김
-    {{ EYE_CLOSE_3	, EYE_CLOSE_3	}, G_R310_FRAME_TIME / 2}, // 프레임 3: 거의 감김
-    {{ EYE_CLOSE_4	, EYE_CLOSE_4   }, G_R310_FRAME_TIME / 2}, // 프레임 4: 거의 완전히 감김
-    {{ EYE_CLOSE_5	, EYE_CLOSE_5   }, G_R310_FRAME_TIME / 2}, // 프레임 4: 거의 완전히 감김
-    {{ EYE_ALL_OFF	, EYE_ALL_OFF   }, G_R310_FRAME_TIME},     // 프레임 5: 완전히 감김 (최대 시간 유지)
+constexpr T_R310_ani_Frame_t g_R310_frameSeq_Blink[] PROGMEM = {
+    {{ EYE_NEUTRAL	, EYE_NEUTRAL	}, G_R310_FRAME_TIME / 2, { G_R310_TF_NONE, G_R310_TF_NONE }}, // 프레임 0: 기본 눈 모양
+    {{ EYE_CLOSE_1	, EYE_CLOSE_1   }, G_R310_FRAME_TIME / 2, { G_R310_TF_NONE, G_R310_TF_NONE }}, // 프레임 1: 살짝 감김
+    {{ EYE_CLOSE_2	, EYE_CLOSE_2   }, G_R310_FRAME_TIME / 2, { G_R310_TF_NONE, G_R310_TF_NONE }}, // 프레임 2: 더 감김
+    {{ EYE_CLOSE_3	, EYE_CLOSE_3	}, G_R310_FRAME_TIME / 2, { G_R310_TF_NONE, G_R310_TF_NONE }}, // 프레임 3: 거의 감김
+    {{ EYE_CLOSE_4	, EYE_CLOSE_4   }, G_R310_FRAME_TIME / 2, { G_R310_TF_NONE, G_R310_TF_NONE }}, // 프레임 4: 거의 완전히 감김
+    {{ EYE_CLOSE_5	, EYE_CLOSE_5   }, G_R310_FRAME_TIME / 2, { G_R310_TF_NONE, G_R310_TF_NONE }}, // 프레임 4: 거의 완전히 감김
+    {{ EYE_ALL_OFF	, EYE_ALL_OFF   }, G_R310_FRAME_TIME, { G_R310_TF_NONE, G_R310_TF_NONE }},     // 프레임 5: 완전히 감김 (최대 시간 유지)
      
 };
 
 // 윙크 애니메이션 시퀀스 데이터 (오른쪽 눈 윙크 기준)
-const T_R310_ani_Frame_t g_R310_frameSeq_Wink[] PROGMEM = {
-    {{ EYE_NEUTRAL	, EYE_NEUTRAL	}, G_R310_FRAME_TIME / 2}, // 프레임 0: 기본 눈 모양
-    {{ EYE_CLOSE_1	, EYE_NEUTRAL	}, G_R310_FRAME_TIME / 2}, // 프레임 1: 오른쪽 눈 살짝 감김
-    {{ EYE_CLOSE_2	, EYE_NEUTRAL	}, G_R310_FRAME_TIME / 2}, // 프레임 2: 오른쪽 눈 더 감김
-    {{ EYE_CLOSE_3	, EYE_NEUTRAL	}, G_R310_FRAME_TIME / 2}, // 프레임 3: 오른쪽 눈 거의 감김
-    {{ EYE_CLOSE_4	, EYE_NEUTRAL	}, G_R310_FRAME_TIME / 2}, // 프레임 4: 오른쪽 눈 거의 완전히 감김
-    {{ EYE_CLOSE_5	, EYE_NEUTRAL	}, G_R310_FRAME_TIME / 2}, // 프레임 4: 오른쪽 눈 거의 완전히 감김
-    {{ EYE_ALL_OFF	, EYE_NEUTRAL	}, G_R310_FRAME_TIME * 2}, // 프레임 5: 오른쪽 눈 완전히 감김 (최대 시간 유지)
+constexpr T_R310_ani_Frame_t g_R310_frameSeq_Wink[] PROGMEM = {
+    {{ EYE_NEUTRAL	, EYE_NEUTRAL	}, G_R310_FRAME_TIME / 2, { G_R310_TF_NONE, G_R310_TF_NONE }}, // 프레임 0: 기본 눈 모양
+    {{ EYE_CLOSE_1	, EYE_NEUTRAL	}, G_R310_FRAME_TIME / 2, { G_R310_TF_NONE, G_R310_TF_NONE }}, // 프레임 1: 오른쪽 눈 살짝 감김
+    {{ EYE_CLOSE_2	, EYE_NEUTRAL	}, G_R310_FRAME_TIME / 2, { G_R310_TF_NONE, G_R310_TF_NONE }}, // 프레임 2: 오른쪽 눈 더 감김
+    {{ EYE_CLOSE_3	, EYE_NEUTRAL	}, G_R310_FRAME_TIME / 2, { G_R310_TF_NONE, G_R310_TF_NONE }}, // 프레임 3: 오른쪽 눈 거의 감김
+    {{ EYE_CLOSE_4	, EYE_NEUTRAL	}, G_R310_FRAME_TIME / 2, { G_R310_TF_NONE, G_R310_TF_NONE }}, // 프레임 4: 오른쪽 눈 거의 완전히 감김
+    {{ EYE_CLOSE_5	, EYE_NEUTRAL	}, G_R310_FRAME_TIME / 2, { G_R310_TF_NONE, G_R310_TF_NONE }}, // 프레임 4: 오른쪽 눈 거의 완전히 감김
+    {{ EYE_ALL_OFF	, EYE_NEUTRAL	}, G_R310_FRAME_TIME * 2, { G_R310_TF_NONE, G_R310_TF_NONE }}, // 프레임 5: 오른쪽 눈 완전히 감김 (최대 시간 유지)
 };
 
-// 오른쪽 보기 애니메이션 시퀀스 데이터
-const T_R310_ani_Frame_t g_R310_frameSeq_Right[] PROGMEM = {
-    {{ EYE_NEUTRAL		, EYE_NEUTRAL       }, G_R310_FRAME_TIME    }, // 프레임 0: 기본 눈 모양
-    {{ EYE_LOOK_RIGHT_1	, EYE_LOOK_RIGHT_1 	}, G_R310_FRAME_TIME    }, // 프레임 1: 눈동자 오른쪽 이동 시작
-    {{ EYE_LOOK_RIGHT_2	, EYE_LOOK_RIGHT_1	}, G_R310_FRAME_TIME * 5}, // 프레임 2: 눈동자 오른쪽 끝 (최대 시간 유지)
+// 오른쪽 보기 애니메이션 시퀀스 데이터 (왼쪽 보기 글리프를 좌우 반전)
+constexpr T_R310_ani_Frame_t g_R310_frameSeq_Right[] PROGMEM = {
+    {{ EYE_NEUTRAL      , EYE_NEUTRAL       }, G_R310_FRAME_TIME    , { G_R310_TF_NONE, G_R310_TF_NONE }},                                                                                      // 프레임 0: 기본 눈 모양
+    {{ EYE_LOOK_LEFT_2  , EYE_LOOK_LEFT_2   }, G_R310_FRAME_TIME    , { G_R310_TF_MIRROR_H | G_R310_TF_SHIFT(-1, 0), G_R310_TF_MIRROR_H | G_R310_TF_SHIFT(-1, 0) }}, // 프레임 1: 눈동자 오른쪽 이동 시작
+    {{ EYE_LOOK_LEFT_2  , EYE_LOOK_LEFT_2   }, G_R310_FRAME_TIME * 5, { G_R310_TF_MIRROR_H                         , G_R310_TF_MIRROR_H | G_R310_TF_SHIFT(-1, 0) }}, // 프레임 2: 눈동자 오른쪽 끝 (최대 시간 유지)
 };
 
 // 왼쪽 보기 애니메이션 시퀀스 데이터
-const T_R310_ani_Frame_t g_R310_frameSeq_Left[] PROGMEM = {
-    {{ EYE_NEUTRAL      , EYE_NEUTRAL       }, G_R310_FRAME_TIME    }, // 프레임 0: 기본 눈 모양
-    {{ EYE_LOOK_LEFT_1  , EYE_LOOK_LEFT_1   }, G_R310_FRAME_TIME    }, // 프레임 1: 눈동자 왼쪽 이동 시작
-    {{ EYE_LOOK_LEFT_2  , EYE_LOOK_LEFT_2   }, G_R310_FRAME_TIME * 5}, // 프레임 2: 눈동자 왼쪽 끝 (최대 시간 유지)
+constexpr T_R310_ani_Frame_t g_R310_frameSeq_Left[] PROGMEM = {
+    {{ EYE_NEUTRAL      , EYE_NEUTRAL       }, G_R310_FRAME_TIME    , { G_R310_TF_NONE, G_R310_TF_NONE }},                                                  // 프레임 0: 기본 눈 모양
+    {{ EYE_LOOK_LEFT_2  , EYE_LOOK_LEFT_2   }, G_R310_FRAME_TIME    , { G_R310_TF_SHIFT(1, 0), G_R310_TF_SHIFT(1, 0) }}, // 프레임 1: 눈동자 왼쪽 이동 시작
+    {{ EYE_LOOK_LEFT_2  , EYE_LOOK_LEFT_2   }, G_R310_FRAME_TIME * 5, { G_R310_TF_NONE, G_R310_TF_NONE }},                                                  // 프레임 2: 눈동자 왼쪽 끝 (최대 시간 유지)
 };
 
-// 위 보기 애니메이션 시퀀스 데이터
-const T_R310_ani_Frame_t g_R310_frameSeq_Up[] PROGMEM = {
-    {{ EYE_NEUTRAL      , EYE_NEUTRAL   }, G_R310_FRAME_TIME    }, // 프레임 0: 기본 눈 모양
-    {{ EYE_LOOK_UP_1    , EYE_LOOK_UP_1 }, G_R310_FRAME_TIME    }, // 프레임 1: 눈동자 위 이동 시작
-    {{ EYE_LOOK_UP_2    , EYE_LOOK_UP_2 }, G_R310_FRAME_TIME * 5}, // 프레임 2: 눈동자 더 위로
+// 위 보기 애니메이션 시퀀스 데이터 (아래 보기 글리프를 상하 반전)
+constexpr T_R310_ani_Frame_t g_R310_frameSeq_Up[] PROGMEM = {
+    {{ EYE_NEUTRAL      , EYE_NEUTRAL       }, G_R310_FRAME_TIME    , { G_R310_TF_NONE, G_R310_TF_NONE }},                                                                                      // 프레임 0: 기본 눈 모양
+    {{ EYE_LOOK_DOWN_2  , EYE_LOOK_DOWN_2   }, G_R310_FRAME_TIME    , { G_R310_TF_MIRROR_V | G_R310_TF_SHIFT(0, 1), G_R310_TF_MIRROR_V | G_R310_TF_SHIFT(0, 1) }},   // 프레임 1: 눈동자 위 이동 시작
+    {{ EYE_LOOK_DOWN_2  , EYE_LOOK_DOWN_2   }, G_R310_FRAME_TIME * 5, { G_R310_TF_MIRROR_V                        , G_R310_TF_MIRROR_V                         }},   // 프레임 2: 눈동자 더 위로
 };
 
 // 아래 보기 애니메이션 시퀀스 데이터
-const T_R310_ani_Frame_t g_R310_frameSeq_Down[] PROGMEM = {
-    {{ EYE_NEUTRAL      , EYE_NEUTRAL       }, G_R310_FRAME_TIME    }, // 프레임 0: 기본 눈 모양
-    {{ EYE_LOOK_DOWN_1  , EYE_LOOK_DOWN_1   }, G_R310_FRAME_TIME    }, // 프레임 1: 눈동자 아래 이동 시작
-    {{ EYE_LOOK_DOWN_2  , EYE_LOOK_DOWN_2   }, G_R310_FRAME_TIME * 5}, // 프레임 2: 눈동자 더 아래로
+constexpr T_R310_ani_Frame_t g_R310_frameSeq_Down[] PROGMEM = {
+    {{ EYE_NEUTRAL      , EYE_NEUTRAL       }, G_R310_FRAME_TIME    , { G_R310_TF_NONE, G_R310_TF_NONE }},                                                    // 프레임 0: 기본 눈 모양
+    {{ EYE_LOOK_DOWN_2  , EYE_LOOK_DOWN_2   }, G_R310_FRAME_TIME    , { G_R310_TF_SHIFT(0, -1), G_R310_TF_SHIFT(0, -1) }}, // 프레임 1: 눈동자 아래 이동 시작
+    {{ EYE_LOOK_DOWN_2  , EYE_LOOK_DOWN_2   }, G_R310_FRAME_TIME * 5, { G_R310_TF_NONE, G_R310_TF_NONE }},                                                    // 프레임 2: 눈동자 더 아래로
 };
 
 // 좌우 스캔 애니메이션 시퀀스 데이터 (좌우 눈 동일 모양)
-const T_R310_ani_Frame_t g_R310_frameSeq_ScanLeftRight[] PROGMEM = {
-    {{ EYE_LOOK_LEFT_1  , EYE_LOOK_LEFT_1   }, G_R310_FRAME_TIME},   // 프레임 1: 눈동자 이동
-    {{ EYE_LOOK_LEFT_2  , EYE_LOOK_LEFT_2   }, G_R310_FRAME_TIME * 2},// 프레임 0: 눈동자 왼쪽 끝 (200ms 유지)
-    {{ EYE_LOOK_LEFT_1  , EYE_LOOK_LEFT_1   }, G_R310_FRAME_TIME},   // 프레임 1: 눈동자 이동
-    {{ EYE_NEUTRAL      , EYE_NEUTRAL       }, G_R310_FRAME_TIME},   // 프레임 1: 눈동자 이동
-    {{ EYE_LOOK_RIGHT_1 , EYE_LOOK_RIGHT_1  }, G_R310_FRAME_TIME},   // 프레임 2: 눈동자 이동
-    {{ EYE_LOOK_RIGHT_1 , EYE_LOOK_RIGHT_1  }, G_R310_FRAME_TIME},   // 프레임 2: 눈동자 이동
-    {{ EYE_LOOK_RIGHT_2 , EYE_LOOK_RIGHT_2  }, G_R310_FRAME_TIME * 2},   // 프레임 3: 눈동자 오른쪽 끝 (원래 폰트 인덱스로 변경)
-    {{ EYE_LOOK_RIGHT_1 , EYE_LOOK_RIGHT_1  }, G_R310_FRAME_TIME},   // 프레임 2: 눈동자 이동
+constexpr T_R310_ani_Frame_t g_R310_frameSeq_ScanLeftRight[] PROGMEM = {
+    {{ EYE_LOOK_LEFT_2  , EYE_LOOK_LEFT_2   }, G_R310_FRAME_TIME    , { G_R310_TF_SHIFT(1, 0)                        , G_R310_TF_SHIFT(1, 0)                         }},   // 프레임 1: 눈동자 이동
+    {{ EYE_LOOK_LEFT_2  , EYE_LOOK_LEFT_2   }, G_R310_FRAME_TIME * 2, { G_R310_TF_NONE, G_R310_TF_NONE }},                                                                                                  // 프레임 0: 눈동자 왼쪽 끝 (200ms 유지)
+    {{ EYE_LOOK_LEFT_2  , EYE_LOOK_LEFT_2   }, G_R310_FRAME_TIME    , { G_R310_TF_SHIFT(1, 0)                        , G_R310_TF_SHIFT(1, 0)                         }},   // 프레임 1: 눈동자 이동
+    {{ EYE_NEUTRAL      , EYE_NEUTRAL       }, G_R310_FRAME_TIME    , { G_R310_TF_NONE, G_R310_TF_NONE }},                                                                                                  // 프레임 1: 눈동자 이동
+    {{ EYE_LOOK_LEFT_2  , EYE_LOOK_LEFT_2   }, G_R310_FRAME_TIME    , { G_R310_TF_MIRROR_H | G_R310_TF_SHIFT(-1, 0), G_R310_TF_MIRROR_H | G_R310_TF_SHIFT(-1, 0) }},   // 프레임 2: 눈동자 이동
+    {{ EYE_LOOK_LEFT_2  , EYE_LOOK_LEFT_2   }, G_R310_FRAME_TIME    , { G_R310_TF_MIRROR_H | G_R310_TF_SHIFT(-1, 0), G_R310_TF_MIRROR_H | G_R310_TF_SHIFT(-1, 0) }},   // 프레임 2: 눈동자 이동
+    {{ EYE_LOOK_LEFT_2  , EYE_LOOK_LEFT_2   }, G_R310_FRAME_TIME * 2, { G_R310_TF_MIRROR_H                         , G_R310_TF_MIRROR_H                          }},   // 프레임 3: 눈동자 오른쪽 끝 (원래 폰트 인덱스로 변경)
+    {{ EYE_LOOK_LEFT_2  , EYE_LOOK_LEFT_2   }, G_R310_FRAME_TIME    , { G_R310_TF_MIRROR_H | G_R310_TF_SHIFT(-1, 0), G_R310_TF_MIRROR_H | G_R310_TF_SHIFT(-1, 0) }},   // 프레임 2: 눈동자 이동
 };
 
 // 상하 스캔 애니메이션 시퀀스 데이터 (좌우 눈 동일 모양)
-const T_R310_ani_Frame_t g_R310_frameSeq_ScanUpDown[] PROGMEM = {
-    {{ EYE_LOOK_UP_1    , EYE_LOOK_UP_1     }, G_R310_FRAME_TIME},// 프레임 0: 눈동자 위쪽 중간 (200ms 유지)
-    {{ EYE_LOOK_UP_2    , EYE_LOOK_UP_2     }, G_R310_FRAME_TIME * 2},   // 프레임 1: 눈동자 이동
-    {{ EYE_LOOK_UP_1    , EYE_LOOK_UP_1     }, G_R310_FRAME_TIME},   // 프레임 2: 눈동자 이동
-    {{ EYE_NEUTRAL      , EYE_NEUTRAL       }, G_R310_FRAME_TIME},   // 프레임 3: 눈동자 아래 끝 (원래 폰트 인덱스로 변경)
-    {{ EYE_LOOK_DOWN_1  , EYE_LOOK_DOWN_1   }, G_R310_FRAME_TIME}, // 프레임 4: 눈동자 위쪽 끝
-    {{ EYE_LOOK_DOWN_2  , EYE_LOOK_DOWN_2   }, G_R310_FRAME_TIME * 2}, // 프레임 5: 눈동자 위쪽 중간 (원래 폰트 인덱스로 변경)
-    {{ EYE_LOOK_DOWN_1  , EYE_LOOK_DOWN_1   }, G_R310_FRAME_TIME},
+constexpr T_R310_ani_Frame_t g_R310_frameSeq_ScanUpDown[] PROGMEM = {
+    {{ EYE_LOOK_DOWN_2  , EYE_LOOK_DOWN_2   }, G_R310_FRAME_TIME    , { G_R310_TF_MIRROR_V | G_R310_TF_SHIFT(0, 1), G_R310_TF_MIRROR_V | G_R310_TF_SHIFT(0, 1) }},   // 프레임 0: 눈동자 위쪽 중간 (200ms 유지)
+    {{ EYE_LOOK_DOWN_2  , EYE_LOOK_DOWN_2   }, G_R310_FRAME_TIME * 2, { G_R310_TF_MIRROR_V                        , G_R310_TF_MIRROR_V                         }},   // 프레임 1: 눈동자 이동
+    {{ EYE_LOOK_DOWN_2  , EYE_LOOK_DOWN_2   }, G_R310_FRAME_TIME    , { G_R310_TF_MIRROR_V | G_R310_TF_SHIFT(0, 1), G_R310_TF_MIRROR_V | G_R310_TF_SHIFT(0, 1) }},   // 프레임 2: 눈동자 이동
+    {{ EYE_NEUTRAL      , EYE_NEUTRAL       }, G_R310_FRAME_TIME    , { G_R310_TF_NONE, G_R310_TF_NONE }},                                                                                                // 프레임 3: 눈동자 아래 끝 (원래 폰트 인덱스로 변경)
+    {{ EYE_LOOK_DOWN_2  , EYE_LOOK_DOWN_2   }, G_R310_FRAME_TIME    , { G_R310_TF_SHIFT(0, -1)                      , G_R310_TF_SHIFT(0, -1)                       }},   // 프레임 4: 눈동자 위쪽 끝
+    {{ EYE_LOOK_DOWN_2  , EYE_LOOK_DOWN_2   }, G_R310_FRAME_TIME * 2, { G_R310_TF_NONE, G_R310_TF_NONE }},                                                                                                // 프레임 5: 눈동자 위쪽 중간 (원래 폰트 인덱스로 변경)
+    {{ EYE_LOOK_DOWN_2  , EYE_LOOK_DOWN_2   }, G_R310_FRAME_TIME    , { G_R310_TF_SHIFT(0, -1)                      , G_R310_TF_SHIFT(0, -1)                       }},
 };
 
-// 화남 2
-const T_R310_ani_Frame_t g_R310_frameSeq_Angry2[] PROGMEM = {
-    {{ EYE_NEUTRAL           , EYE_NEUTRAL              }, G_R310_FRAME_TIME    }, // 프레임 0: 기본 눈 모양
-    {{ EYS_DIAGONAL_RIGHT_1  , EYS_DIAGONAL_LEFT_1      }, G_R310_FRAME_TIME    }, // 프레임 1: 눈동자 아래 이동 시작
-    {{ EYS_DIAGONAL_RIGHT_2  , EYS_DIAGONAL_LEFT_2      }, G_R310_FRAME_TIME    }, // 프레임 2: 눈동자 더 아래로
-    {{ EYS_DIAGONAL_RIGHT_3  , EYS_DIAGONAL_LEFT_3      }, G_R310_FRAME_TIME    }, 
-    {{ EYS_DIAGONAL_RIGHT_4  , EYS_DIAGONAL_LEFT_4      }, G_R310_FRAME_TIME    }, 
-    {{ EYS_DIAGONAL_RIGHT_5  , EYS_DIAGONAL_LEFT_5 * 5  }, G_R310_FRAME_TIME    }, 
+// 화남 2 (왼쪽 눈 = 오른쪽 대각선 글리프 상하 반전)
+constexpr T_R310_ani_Frame_t g_R310_frameSeq_Angry2[] PROGMEM = {
+    {{ EYE_NEUTRAL           , EYE_NEUTRAL              }, G_R310_FRAME_TIME    , { G_R310_TF_NONE, G_R310_TF_NONE }},                                          // 프레임 0: 기본 눈 모양
+    {{ EYE_SAD_LEFT_1        , EYS_DIAGONAL_LEFT_1      }, G_R310_FRAME_TIME    , { G_R310_TF_NONE, G_R310_TF_NONE }},                                          // 프레임 1: 눈동자 아래 이동 시작 (EYE_SAD_LEFT_1 = 오른쪽 대각선 1)
+    {{ EYS_DIAGONAL_RIGHT_2  , EYS_DIAGONAL_LEFT_2      }, G_R310_FRAME_TIME    , { G_R310_TF_NONE, G_R310_TF_NONE }},                                          // 프레임 2: 눈동자 더 아래로
+    {{ EYS_DIAGONAL_RIGHT_3  , EYS_DIAGONAL_RIGHT_3     }, G_R310_FRAME_TIME    , { G_R310_TF_NONE, G_R310_TF_MIRROR_V }}, 
+    {{ EYS_DIAGONAL_RIGHT_4  , EYS_DIAGONAL_RIGHT_4     }, G_R310_FRAME_TIME    , { G_R310_TF_NONE, G_R310_TF_MIRROR_V }}, 
+    {{ EYS_DIAGONAL_RIGHT_5  , EYS_DIAGONAL_RIGHT_5     }, G_R310_FRAME_TIME    , { G_R310_TF_NONE, G_R310_TF_MIRROR_V }}, 
 };
 
-// smale
-const T_R310_ani_Frame_t g_R310_frameSeq_Smile[] PROGMEM = {
-    {{ EYE_NEUTRAL          , EYE_NEUTRAL               }, G_R310_FRAME_TIME    }, // 프레임 0: 기본 눈 모양
-    {{ EYS_DIAGONAL_LEFT_1  , EYS_DIAGONAL_RIGHT_1      }, G_R310_FRAME_TIME    }, // 프레임 1: 눈동자 아래 이동 시작
-    {{ EYS_DIAGONAL_LEFT_2  , EYS_DIAGONAL_RIGHT_2      }, G_R310_FRAME_TIME    }, // 프레임 2: 눈동자 더 아래로
-    {{ EYS_DIAGONAL_LEFT_3  , EYS_DIAGONAL_RIGHT_3      }, G_R310_FRAME_TIME    }, 
-    {{ EYS_DIAGONAL_LEFT_4  , EYS_DIAGONAL_RIGHT_4      }, G_R310_FRAME_TIME    }, 
-    {{ EYS_DIAGONAL_LEFT_5  , EYS_DIAGONAL_RIGHT_5 * 5  }, G_R310_FRAME_TIME    }, 
+// smale (오른쪽 눈 = 오른쪽 대각선 글리프 상하 반전)
+constexpr T_R310_ani_Frame_t g_R310_frameSeq_Smile[] PROGMEM = {
+    {{ EYE_NEUTRAL          , EYE_NEUTRAL               }, G_R310_FRAME_TIME    , { G_R310_TF_NONE, G_R310_TF_NONE }},                                          // 프레임 0: 기본 눈 모양
+    {{ EYS_DIAGONAL_LEFT_1  , EYE_SAD_LEFT_1            }, G_R310_FRAME_TIME    , { G_R310_TF_NONE, G_R310_TF_NONE }},                                          // 프레임 1: 눈동자 아래 이동 시작 (EYE_SAD_LEFT_1 = 오른쪽 대각선 1)
+    {{ EYS_DIAGONAL_LEFT_2  , EYS_DIAGONAL_RIGHT_2      }, G_R310_FRAME_TIME    , { G_R310_TF_NONE, G_R310_TF_NONE }},                                          // 프레임 2: 눈동자 더 아래로
+    {{ EYS_DIAGONAL_RIGHT_3 , EYS_DIAGONAL_RIGHT_3      }, G_R310_FRAME_TIME    , { G_R310_TF_MIRROR_V, G_R310_TF_NONE }}, 
+    {{ EYS_DIAGONAL_RIGHT_4 , EYS_DIAGONAL_RIGHT_4      }, G_R310_FRAME_TIME    , { G_R310_TF_MIRROR_V, G_R310_TF_NONE }}, 
+    {{ EYS_DIAGONAL_RIGHT_5 , EYS_DIAGONAL_RIGHT_5      }, G_R310_FRAME_TIME    , { G_R310_TF_MIRROR_V, G_R310_TF_NONE }}, 
 };
 
 // 잠자는 눈 애니메이션 시퀀스 데이터 (좌우 눈 동일 모양)
-const T_R310_ani_Frame_t g_R310_frameSeq_Sleep[] PROGMEM = {
-    {{ EYE_NEUTRAL, EYE_NEUTRAL }, G_R310_FRAME_TIME},     // 프레임 0: 기본 눈 모양
-    {{ EYE_CLOSE_1, EYE_CLOSE_1 }, G_R310_FRAME_TIME},   // 프레임 1: 감기기 시작
-    {{ EYE_CLOSE_2, EYE_CLOSE_2 }, G_R310_FRAME_TIME},   // 프레임 2: 더 감김
-    {{ EYE_CLOSE_3, EYE_CLOSE_3 }, G_R310_FRAME_TIME},   // 프레임 3: 더 감김
-    {{ EYE_CLOSE_4, EYE_CLOSE_4 }, G_R310_FRAME_TIME},   // 프레임 4: 더 감김
-    {{ EYE_CLOSE_5, EYE_CLOSE_5 }, G_R310_FRAME_TIME},   // 프레임 5: 더 감김
-    {{ EYE_ALL_OFF, EYE_ALL_OFF }, G_R310_FRAME_TIME * 2},   // 프레임 6: 완전히 감긴 모양 또는 패턴 등
+constexpr T_R310_ani_Frame_t g_R310_frameSeq_Sleep[] PROGMEM = {
+    {{ EYE_NEUTRAL, EYE_NEUTRAL }, G_R310_FRAME_TIME, { G_R310_TF_NONE, G_R310_TF_NONE }},     // 프레임 0: 기본 눈 모양
+    {{ EYE_CLOSE_1, EYE_CLOSE_1 }, G_R310_FRAME_TIME, { G_R310_TF_NONE, G_R310_TF_NONE }},   // 프레임 1: 감기기 시작
+    {{ EYE_CLOSE_2, EYE_CLOSE_2 }, G_R310_FRAME_TIME, { G_R310_TF_NONE, G_R310_TF_NONE }},   // 프레임 2: 더 감김
+    {{ EYE_CLOSE_3, EYE_CLOSE_3 }, G_R310_FRAME_TIME, { G_R310_TF_NONE, G_R310_TF_NONE }},   // 프레임 3: 더 감김
+    {{ EYE_CLOSE_4, EYE_CLOSE_4 }, G_R310_FRAME_TIME, { G_R310_TF_NONE, G_R310_TF_NONE }},   // 프레임 4: 더 감김
+    {{ EYE_CLOSE_5, EYE_CLOSE_5 }, G_R310_FRAME_TIME, { G_R310_TF_NONE, G_R310_TF_NONE }},   // 프레임 5: 더 감김
+    {{ EYE_ALL_OFF, EYE_ALL_OFF }, G_R310_FRAME_TIME * 2, { G_R310_TF_NONE, G_R310_TF_NONE }},   // 프레임 6: 완전히 감긴 모양 또는 패턴 등
 };
 
-const T_R310_ani_Frame_t g_R310_frameSeq_SleepBlink[] PROGMEM = {
-    {{ EYE_CLOSE_4         	, EYE_CLOSE_4      }, G_R310_FRAME_TIME},   // 프레임 0: 최대로 찡그린 모양
-    {{ EYE_CLOSE_5         	, EYE_CLOSE_5      }, G_R310_FRAME_TIME},   // 프레임 0: 최대로 찡그린 모양
-    {{ EYE_ALL_OFF          , EYE_ALL_OFF      }, G_R310_FRAME_TIME},   // 프레임 1: 완전히 감긴 모양
+constexpr T_R310_ani_Frame_t g_R310_frameSeq_SleepBlink[] PROGMEM = {
+    {{ EYE_CLOSE_4         	, EYE_CLOSE_4      }, G_R310_FRAME_TIME, { G_R310_TF_NONE, G_R310_TF_NONE }},   // 프레임 0: 최대로 찡그린 모양
+    {{ EYE_CLOSE_5         	, EYE_CLOSE_5      }, G_R310_FRAME_TIME, { G_R310_TF_NONE, G_R310_TF_NONE }},   // 프레임 0: 최대로 찡그린 모양
+    {{ EYE_ALL_OFF          , EYE_ALL_OFF      }, G_R310_FRAME_TIME, { G_R310_TF_NONE, G_R310_TF_NONE }},   // 프레임 1: 완전히 감긴 모양
+};
+
+// 화남 (2bpp 컬러 글리프, 색상은 EMT_ANGRY_COLOR 팔레트)
+constexpr T_R310_ani_Frame_t g_R310_frameSeq_AngryColor[] PROGMEM = {
+    {{ EYE2_NEUTRAL         , EYE2_NEUTRAL      }, G_R310_FRAME_TIME    , { G_R310_TF_NONE, G_R310_TF_NONE }},   // 프레임 0: 기본 눈 모양
+    {{ EYE2_ANGRY_RIGHT     , EYE2_ANGRY_LEFT   }, G_R310_FRAME_TIME * 5, { G_R310_TF_NONE, G_R310_TF_NONE }},   // 프레임 1: 화난 눈 (유지)
 };
 
 
@@ -293,742 +331,95 @@ typedef struct {
     T_R310_emotion_idx_t        emotionIdx;        // 감정 종류
     const T_R310_ani_Frame_t*   seq;                // 시퀀스 데이터 PROGMEM 주소
     uint8_t                     seqSize;               // 시퀀스 총 프레임 개수
+    EMTP_Ply_Blend_t            blendMode;          // 프레임 전환 방식 (크로스페이드 여부)
 } T_R310_ani_Table_t;
 
 
-// 감정 애니메이션 조회 테이블
-const T_R310_ani_Table_t g_R310_ani_Tables_arr[] PROGMEM = {
-    {EMT_NEUTRAL      , g_R310_frameSeq_Blink        , 1                                  }, // 중립: Blink 시퀀스의 첫 프레임만 사용 (정적)
+// 감정 애니메이션 시퀀스 목록 (작성 순서 자유, 아래 감정별 조회 테이블 g_R310_ani_Lookup 의 원본)
+// 빌드 시점에만 읽으므로 PROGMEM 에 두지 않습니다.
+constexpr T_R310_ani_Table_t g_R310_ani_Tables_arr[] = {
+    {EMT_NEUTRAL      , g_R310_frameSeq_Blink        , 1, EMTP_BLEND_OFF}, // 중립: Blink 시퀀스의 첫 프레임만 사용 (정적)
     
-	{EMT_BLINK        , g_R310_frameSeq_Blink        , G_R310_ARRAY_SIZE(g_R310_frameSeq_Blink) }, // 깜빡임
-    {EMT_WINK         , g_R310_frameSeq_Wink         , G_R310_ARRAY_SIZE(g_R310_frameSeq_Wink)  }, // 윙크
+	{EMT_BLINK        , g_R310_frameSeq_Blink        , G_R310_ARRAY_SIZE(g_R310_frameSeq_Blink), EMTP_BLEND_OFF}, // 깜빡임
+    {EMT_WINK         , g_R310_frameSeq_Wink         , G_R310_ARRAY_SIZE(g_R310_frameSeq_Wink), EMTP_BLEND_OFF}, // 윙크
     
-	{EMT_LOOK_L       , g_R310_frameSeq_Left         , G_R310_ARRAY_SIZE(g_R310_frameSeq_Left)  }, // 왼쪽 보기
-    {EMT_LOOK_R       , g_R310_frameSeq_Right        , G_R310_ARRAY_SIZE(g_R310_frameSeq_Right) }, // 오른쪽 보기
+	{EMT_LOOK_L       , g_R310_frameSeq_Left         , G_R310_ARRAY_SIZE(g_R310_frameSeq_Left), EMTP_BLEND_CROSSFADE}, // 왼쪽 보기
+    {EMT_LOOK_R       , g_R310_frameSeq_Right        , G_R310_ARRAY_SIZE(g_R310_frameSeq_Right), EMTP_BLEND_CROSSFADE}, // 오른쪽 보기
  
-	{EMT_LOOK_U       , g_R310_frameSeq_Up           , G_R310_ARRAY_SIZE(g_R310_frameSeq_Up)    }, // 위 보기
-    {EMT_LOOK_D       , g_R310_frameSeq_Down         , G_R310_ARRAY_SIZE(g_R310_frameSeq_Down)  }, // 아래 보기
+	{EMT_LOOK_U       , g_R310_frameSeq_Up           , G_R310_ARRAY_SIZE(g_R310_frameSeq_Up), EMTP_BLEND_CROSSFADE}, // 위 보기
+    {EMT_LOOK_D       , g_R310_frameSeq_Down         , G_R310_ARRAY_SIZE(g_R310_frameSeq_Down), EMTP_BLEND_CROSSFADE}, // 아래 보기
 
-	{EMT_SCAN_LR      , g_R310_frameSeq_ScanLeftRight, G_R310_ARRAY_SIZE(g_R310_frameSeq_ScanLeftRight)}, // 좌우 스캔
-    {EMT_SCAN_UD      , g_R310_frameSeq_ScanUpDown   , G_R310_ARRAY_SIZE(g_R310_frameSeq_ScanUpDown)}, // 상하 스캔
+	{EMT_SCAN_LR      , g_R310_frameSeq_ScanLeftRight, G_R310_ARRAY_SIZE(g_R310_frameSeq_ScanLeftRight), EMTP_BLEND_CROSSFADE}, // 좌우 스캔
+    {EMT_SCAN_UD      , g_R310_frameSeq_ScanUpDown   , G_R310_ARRAY_SIZE(g_R310_frameSeq_ScanUpDown), EMTP_BLEND_CROSSFADE}, // 상하 스캔
 
-    {EMT_ANGRY2       , g_R310_frameSeq_Angry2       , G_R310_ARRAY_SIZE(g_R310_frameSeq_Angry2)}, // 좌우 스캔
-    {EMT_SMILE        , g_R310_frameSeq_Smile        , G_R310_ARRAY_SIZE(g_R310_frameSeq_Smile)}, // 상하 스캔
+    {EMT_ANGRY2       , g_R310_frameSeq_Angry2       , G_R310_ARRAY_SIZE(g_R310_frameSeq_Angry2), EMTP_BLEND_OFF}, // 좌우 스캔
+    {EMT_SMILE        , g_R310_frameSeq_Smile        , G_R310_ARRAY_SIZE(g_R310_frameSeq_Smile), EMTP_BLEND_OFF}, // 상하 스캔
 
-    {EMT_SLEEP        , g_R310_frameSeq_Sleep        , G_R310_ARRAY_SIZE(g_R310_frameSeq_Sleep)}, // 잠자는 눈
-    {EMT_SLEEP_BLINK  , g_R310_frameSeq_SleepBlink   , G_R310_ARRAY_SIZE(g_R310_frameSeq_SleepBlink)}, // 잠자는 눈
+    {EMT_SLEEP        , g_R310_frameSeq_Sleep        , G_R310_ARRAY_SIZE(g_R310_frameSeq_Sleep), EMTP_BLEND_OFF}, // 잠자는 눈
+    {EMT_SLEEP_BLINK  , g_R310_frameSeq_SleepBlink   , G_R310_ARRAY_SIZE(g_R310_frameSeq_SleepBlink), EMTP_BLEND_OFF}, // 잠자는 눈
 
-};
+    {EMT_ANGRY_COLOR  , g_R310_frameSeq_AngryColor   , G_R310_ARRAY_SIZE(g_R310_frameSeq_AngryColor), EMTP_BLEND_OFF}, // 화남 (컬러)
 
-
-// 로봇 눈 모양 폰트 데이터 배열
-// PROGMEM 키워드는 데이터를 AVR 마이크로컨트롤러의 플래시 메모리에 저장하여
-// SRAM 사용량을 절약하는 데 사용됩니다.
-const T_R310_FontChar_t g_R310_RobotEyes_Font_arr[] PROGMEM = {
-    // 인덱스 0: EYE_NEUTRAL (중립/행복한 눈)
-    {8, {
-        0b00000000, // . . . . . . . .
-        0b00111100, // . . # # # # . .
-        0b01111110, // . # # # # # # .
-        0b01100110, // . # # . . # # .
-        0b01100110, // . # # . . # # .
-        0b01111110, // . # # # # # # .
-        0b00111100, // . . # # # # . .
-        0b00000000  // . . . . . . . .
-    }},
-
-    // 인덱스 1: EYE_LOOK_DOWN_2 (아래쪽 먼 곳을 보는 눈)
-    {8, {
-        0b00000000, // . . . . . . . .
-        0b00000000, // . . . . . . . .
-        0b00111100, // . . # # # # . .
-        0b01111110, // . # # # # # # .
-        0b01111110, // . # # # # # # .
-        0b01100110, // . # # . . # # .
-        0b01100110, // . # # . . # # .
-        0b00111100  // . . # # # # . .
-    }},
-
-    // 인덱스 2: EYE_LOOK_DOWN_1 (아래쪽 중앙을 보는 눈)
-    {8, {
-        0b00000000, // . . . . . . . .
-        0b00111100, // . . # # # # . .
-        0b01111110, // . # # # # # # .
-        0b01111110, // . # # # # # # .
-        0b01100110, // . # # . . # # .
-        0b01100110, // . # # . . # # .
-        0b00111100, // . . # # # # . .
-        0b00000000  // . . . . . . . .
-    }},
-
-    // 인덱스 3: EYE_LOOK_UP_1 (위쪽 중앙을 보는 눈)
-    {8, {
-        0b00000000, // . . . . . . . .
-        0b00111100, // . . # # # # . .
-        0b01100110, // . # # . . # # .
-        0b01100110, // . # # . . # # .
-        0b01111110, // . # # # # # # .
-        0b01111110, // . # # # # # # .
-        0b00111100, // . . # # # # . .
-        0b00000000  // . . . . . . . .
-    }},
-
-    // 인덱스 4: EYE_LOOK_UP_2 (위쪽 먼 곳을 보는 눈)
-    {8, {
-        0b00111100, // . . # # # # . .
-        0b01100110, // . # # . . # # .
-        0b01100110, // . # # . . # # .
-        0b01111110, // . # # # # # # .
-        0b01111110, // . # # # # # # .
-        0b00111100, // . . # # # # . .
-        0b00000000, // . . . . . . . .
-        0b00000000  // . . . . . . . .
-    }},
-
-    // 인덱스 5: EYE_LOOK_LEFT_2 (왼쪽을 보는 눈, 작은 눈동자)
-    {8, {
-        0b00000000, // . . . . . . . .
-        0b01111000, // . # # # # . . .
-        0b11111100, // # # # # # # . .
-        0b10011100, // # . . # # # . .
-        0b10011100, // # . . # # # . .
-        0b11111100, // # # # # # # . .
-        0b01111000, // . # # # # . . .
-        0b00000000  // . . . . . . . .
-    }},
-
-    // 인덱스 6: EYE_LOOK_LEFT_1 (오른쪽을 보는 눈, 작은 눈동자)
-    {8, {
-        0b00000000, // . . . . . . . .
-        0b00111100, // . . # # # # . .
-        0b01111110, // . # # # # # # .
-        0b01001110, // . # . . # # # .
-        0b01001110, // . # . . # # # .
-        0b01111110, // . # # # # # # .
-        0b00111100, // . . # # # # . .
-        0b00000000  // . . . . . . . .
-    }},
-
-    // 인덱스 7: EYE_LOOK_RIGHT_1 (왼쪽을 보는 눈, 비대칭)
-    {8, {
-        0b00000000, // . . . . . . . .
-        0b00111100, // . . # # # # . .
-        0b01111110, // . # # # # # # .
-        0b01110010, // . # # # . . # .
-        0b01110010, // . # # # . . # .
-        0b01111110, // . # # # # # # .
-        0b00111100, // . . # # # # . .
-        0b00000000  // . . . . . . . .
-    }},
-
-    // 인덱스 8: EYE_LOOK_RIGHT_2 (오른쪽을 보는 눈, 비대칭)
-    {8, {
-        0b00000000, // . . . . . . . .
-        0b00011110, // . . . # # # # .
-        0b00111111, // . . # # # # # #
-        0b00111001, // . . # # # . . #
-        0b00111001, // . . # # # . . #
-        0b00111111, // . . # # # # # #
-        0b00011110, // . . . # # # # .
-        0b00000000  // . . . . . . . .
-    }},
-
-    // 인덱스 9: EYE_CLOSE_1 (눈꺼풀이 절반 감긴 눈)
-    {8, {
-        0b00000000, // . . . . . . . .
-        0b00000000, // . . . . . . . .
-        0b01111110, // . # # # # # # .
-        0b01100110, // . # # . . # # .
-        0b01100110, // . # # . . # # .
-        0b01111110, // . # # # # # # .
-        0b00111100, // . . # # # # . .
-        0b00000000  // . . . . . . . .
-    }},
-
-    // 인덱스 10: EYE_CLOSE_2 (눈꺼풀이 더 감긴 눈)
-    {8, {
-        0b00000000, // . . . . . . . .
-        0b00000000, // . . . . . . . .
-        0b00000000, // . . . . . . . .
-        0b01100110, // . # # . . # # .
-        0b01100110, // . # # . . # # .
-        0b01111110, // . # # # # # # .
-        0b00111100, // . . # # # # . .
-        0b00000000  // . . . . . . . .
-    }},
-
-    // 인덱스 11: EYE_CLOSE_3 (눈꺼풀이 거의 감긴 눈)
-    {8, {
-        0b00000000, // . . . . . . . .
-        0b00000000, // . . . . . . . .
-        0b00000000, // . . . . . . . .
-        0b00000000, // . . . . . . . .
-        0b01100110, // . # # . . # # .
-        0b01111110, // . # # # # # # .
-        0b00111100, // . . # # # # . .
-        0b00000000  // . . . . . . . .
-    }},
-
-    // 인덱스 12: EYE_CLOSE_4 (눈동자만 보이는 눈)
-    {8, {
-        0b00000000, // . . . . . . . .
-        0b00000000, // . . . . . . . .
-        0b00000000, // . . . . . . . .
-        0b00000000, // . . . . . . . .
-        0b00000000, // . . . . . . . .
-        0b01111110, // . # # # # # # .
-        0b00111100, // . . # # # # . .
-        0b00000000  // . . . . . . . .
-    }},
-
-    // 인덱스 13: EYE_CLOSE_5 (매우 작은 눈동자만 보이는 눈)
-    {8, {
-        0b00000000, // . . . . . . . .
-        0b00000000, // . . . . . . . .
-        0b00000000, // . . . . . . . .
-        0b00000000, // . . . . . . . .
-        0b00000000, // . . . . . . . .
-        0b00000000, // . . . . . . . .
-        0b00111100, // . . # # # # . .
-        0b00000000  // . . . . . . . .
-    }},
-
-    // 인덱스 14: EYE_ALL_OFF (모든 픽셀이 꺼진 눈)
-    {8, {
-        0b00000000, // . . . . . . . .
-        0b00000000, // . . . . . . . .
-        0b00000000, // . . . . . . . .
-        0b00000000, // . . . . . . . .
-        0b00000000, // . . . . . . . .
-        0b00000000, // . . . . . . . .
-        0b00000000, // . . . . . . . .
-        0b00000000  // . . . . . . . .
-    }},
-
-    // 인덱스 15: EYE_SAD_RIGHT_1 (슬픈 오른쪽 눈 1 - 눈꼬리 처짐 시작)
-    {8, {
-        0b00000000, // . . . . . . . .
-        0b00111000, // . . # # # . . .
-        0b01001100, // . # . . # # . .
-        0b01001110, // . # . . # # # .
-        0b01111110, // . # # # # # # .
-        0b00111110, // . . # # # # # .
-        0b00011100, // . . . # # # . .
-        0b00000000  // . . . . . . . .
-    }},
-
-    // 인덱스 16: EYE_SAD_LEFT_1 (슬픈 왼쪽 눈 1 - 눈꼬리 처짐 시작)
-    {8, {
-        0b00000000, // . . . . . . . .
-        0b00111000, // . . # # # . . .
-        0b01111100, // . # # # # # . .
-        0b01100110, // . # # . . # # .
-        0b01100110, // . # # . . # # .
-        0b00111110, // . . # # # # # .
-        0b00011100, // . . . # # # . .
-        0b00000000  // . . . . . . . .
-    }},
-
-    // 인덱스 17: EYE_SAD_RIGHT_2 (슬픈 오른쪽 눈 2 - 눈꼬리 더 처짐)
-    {8, {
-        0b00000000, // . . . . . . . .
-        0b00111000, // . . # # # . . .
-        0b01111100, // . # # # # # . .
-        0b01110010, // . # # # . . # .
-        0b01110010, // . # # # . . # .
-        0b00111110, // . . # # # # # .
-        0b00011100, // . . . # # # . .
-        0b00000000  // . . . . . . . .
-    }},
-
-    // 인덱스 18: EYE_SAD_LEFT_2 (슬픈 왼쪽 눈 2 - 눈꼬리 더 처짐)
-    {8, {
-        0b00000000, // . . . . . . . .
-        0b00011100, // . . . # # # . .
-        0b00110010, // . . # # . . # .
-        0b01110010, // . # # # . . # .
-        0b01111110, // . # # # # # # .
-        0b01111100, // . # # # # # . .
-        0b00111000, // . . # # # . . .
-        0b00000000  // . . . . . . . .
-    }},
-
-    // 인덱스 19: EYE_SAD_RIGHT_3 (슬픈 오른쪽 눈 3 - 가장 슬픈 눈)
-    {8, {
-        0b00000000, // . . . . . . . .
-        0b00011100, // . . . # # # . .
-        0b00111110, // . . # # # # # .
-        0b01100110, // . # # . . # # .
-        0b01100110, // . # # . . # # .
-        0b01111100, // . # # # # # . .
-        0b00111000, // . . # # # . . .
-        0b00000000  // . . . . . . . .
-    }},
-
-    // 인덱스 20: EYE_SAD_LEFT_3 (슬픈 왼쪽 눈 3 - 가장 슬픈 눈)
-    {8, {
-        0b00000000, // . . . . . . . .
-        0b00011100, // . . . # # # . .
-        0b00111110, // . . # # # # # .
-        0b01100110, // . # # . . # # .
-        0b01100110, // . # # . . # # .
-        0b01111100, // . # # # # # . .
-        0b00111000, // . . # # # . . .
-        0b00000000  // . . . . . . . .
-    }},
-
-    //////////////////////////////////////////////////////////////
-    // 인덱스 21: EYS_DIAGONAL_RIGHT_1
-    {8, {
-        0b00000000, // . . . . . . . .
-        0b00111000, // . . # # # . . .
-        0b01111100, // . # # # # # . .
-        0b01100110, // . # # . . # # .
-        0b01100110, // . # # . . # # .
-        0b00111110, // . . # # # # # .
-        0b00011100, // . . . # # # . .
-        0b00000000  // . . . . . . . .
-    }},
-
-    // 인덱스 22: EYS_DIAGONAL_RIGHT_2
-    {8, {
-        0b00000000, // . . . . . . . .
-        0b00111000, // . . # # # . . .
-        0b01111100, // . # # # # # . .
-        0b01101110, // . # # . # # # .
-        0b01110110, // . # # # . # # .
-        0b00111110, // . . # # # # # .
-        0b00011100, // . . . # # # . .
-        0b00000000  // . . . . . . . .
-    }},
-
-    // 인덱스 23: EYS_DIAGONAL_RIGHT_3
-    {8, {
-        0b00000000, // . . . . . . . .
-        0b00110000, // . . # # . . . .
-        0b01111000, // . # # # # . . .
-        0b01101100, // . # # . # # . .
-        0b00110110, // . . # # . # # .
-        0b00011110, // . . . # # # # .
-        0b00001100, // . . . . # # . .
-        0b00000000  // . . . . . . . .
-    }},
-
-    // 인덱스 24: EYS_DIAGONAL_RIGHT_4
-    {8, {
-        0b00000000, // . . . . . . . .
-        0b01100000, // . # # . . . . .
-        0b01110000, // . # # # . . . .
-        0b00101000, // . . # . # . . .
-        0b00010100, // . . . # . # . .
-        0b00001110, // . . . . # # # .
-        0b00000110, // . . . . . # # .
-        0b00000000  // . . . . . . . .
-    }},
-
-    // 인덱스 25: EYS_DIAGONAL_RIGHT_5
-    {8, {
-        0b00000000, // . . . . . . . .
-        0b01000000, // . # . . . . . .
-        0b00100000, // . . # . . . . .
-        0b00010000, // . . . # . . . .
-        0b00001000, // . . . . # . . .
-        0b00000100, // . . . . . # . .
-        0b00000010, // . . . . . . # .
-        0b00000000  // . . . . . . . .
-    }},
-
-    // 인덱스 26: EYS_DIAGONAL_LEFT_1
-    {8, {
-        0b00000000, // . . . . . . . .
-        0b00011100, // . . . # # # . .
-        0b00111110, // . . # # # # # .
-        0b01100110, // . # # . . # # .
-        0b01100110, // . # # . . # # .
-        0b01111100, // . # # # # # . .
-        0b00011100, // . . . # # # . .
-        0b00000000  // . . . . . . . .
-    }},
-
-    // 인덱스 27: EYS_DIAGONAL_LEFT_2
-    {8, {
-        0b00000000, // . . . . . . . .
-        0b00011100, // . . . # # # . .
-        0b00111110, // . . # # # # # .
-        0b01110110, // . # # # . # # .
-        0b01101110, // . # # . # # # .
-        0b01111100, // . # # # # # . .
-        0b00011100, // . . . # # # . .
-        0b00000000  // . . . . . . . .
-    }},
-
-    // 인덱스 28: EYS_DIAGONAL_LEFT_3
-    {8, {
-        0b00000000, // . . . . . . . .
-        0b00001100, // . . . . # # . .
-        0b00011110, // . . . # # # # .
-        0b00110110, // . . # # . # # .
-        0b01101100, // . # # . # # . .
-        0b01111000, // . # # # # . . .
-        0b00110000, // . . # # . . . .
-        0b00000000  // . . . . . . . .
-    }},
-
-    // 인덱스 29: EYS_DIAGONAL_LEFT_4
-    {8, {
-        0b00000000, // . . . . . . . .
-        0b00000110, // . . . . . # # .
-        0b00001110, // . . . . # # # .
-        0b00010100, // . . . # . # . .
-        0b00101000, // . . # . # . . .
-        0b01110000, // . # # # . . . .
-        0b01100000, // . # # . . . . .
-        0b00000000  // . . . . . . . .
-    }},
-
-    // 인덱스 30: EYS_DIAGONAL_LEFT_5
-    {8, {
-        0b00000000, // . . . . . . . .
-        0b00000010, // . . . . . . # .
-        0b00000100, // . . . . . # . .
-        0b00001000, // . . . . # . . .
-        0b00010000, // . . . # . . . .
-        0b00100000, // . . # . . . . .
-        0b01000000, // . # . . . . . .
-        0b00000000  // . . . . . . . .
-    }},
-
-    ///////////////////////////////////////////////////
-    // 인덱스 31: EYE_X_SHAPE_1 (X자 눈 모양 1)
-    {8, {
-        0b00111100, // . . # # # # . .
-        0b01000010, // . # . . . . # .
-        0b01011010, // . # . # # . # .
-        0b01011010, // . # . # # . # .
-        0b01000010, // . # . . . . # .
-        0b00111100, // . . # # # # . .
-        0b00000000, // . . . . . . . .
-        0b00000000  // . . . . . . . .
-    }},
-
-    // 인덱스 32: EYE_X_SHAPE_2 (X자 눈 모양 2)
-    {8, {
-        0b00111100, // . . # # # # . .
-        0b01000010, // . # . . . . # .
-        0b01110010, // . # # # . . # .
-        0b01110010, // . # # # . . # .
-        0b01000010, // . # . . . . # .
-        0b00111100, // . . # # # # . .
-        0b00000000, // . . . . . . . .
-        0b00000000  // . . . . . . . .
-    }},
-
-    // 인덱스 33: EYE_ANGRY_RIGHT_1 (화난 오른쪽 눈 1 - 눈썹 찡그림 시작)
-    {8, {
-        0b00100100, // . . # . . # . .
-        0b01011010, // . # . # # . # .
-        0b10011001, // # . . # # . . #
-        0b10000001, // # . . . . . . #
-        0b10000001, // # . . . . . . #
-        0b01000010, // . # . . . . # .
-        0b00100100, // . . # . . # . .
-        0b00011000  // . . . # # . . .
-    }},
-
-    // 인덱스 34: EYE_ANGRY_LEFT_1 (화난 왼쪽 눈 1 - 눈썹 찡그림 시작)
-    {8, {
-        0b00000000, // . . . . . . . .
-        0b00100100, // . . # . . # . .
-        0b01011010, // . # . # # . # .
-        0b01011010, // . # . # # . # .
-        0b01000010, // . # . . . . # .
-        0b00100100, // . . # . . # . .
-        0b00011000, // . . . # # . . .
-        0b00000000  // . . . . . . . .
-    }},
-
-    // 인덱스 35: EYE_ANGRY_RIGHT_2 (화난 오른쪽 눈 2 - 눈썹 더 찡그림)
-    {8, {
-        0b00000000, // . . . . . . . .
-        0b00100100, // . . # . . # . .
-        0b01111110, // . # # # # # # .
-        0b01111110, // . # # # # # # .
-        0b01111110, // . # # # # # # .
-        0b00111100, // . . # # # # . .
-        0b00011000, // . . . # # . . .
-        0b00000000  // . . . . . . . .
-    }},
-
-    // 인덱스 36: EYE_ANGRY_LEFT_2 (화난 왼쪽 눈 2 - 눈썹 더 찡그림)
-    {8, {
-        0b00000000, // . . . . . . . .
-        0b00000000, // . . . . . . . .
-        0b00100100, // . . # . . # . .
-        0b01111110, // . # # # # # # .
-        0b01111110, // . # # # # # # .
-        0b00111100, // . . # # # # . .
-        0b00011000, // . . . # # . . .
-        0b00000000  // . . . . . . . .
-    }},
-
-    // 인덱스 37: EYE_ANGRY_RIGHT_3 (화난 오른쪽 눈 3 - 가장 화난 눈)
-    {8, {
-        0b11111111, // # # # # # # # #
-        0b11011011, // # # . # # . # #
-        0b10000001, // # . . . . . . #
-        0b10000001, // # . . . . . . #
-        0b10000001, // # . . . . . . #
-        0b11000011, // # # . . . . # #
-        0b11100111, // # # # . . # # #
-        0b11111111  // # # # # # # # #
-    }},
-
-    // 인덱스 38: EYE_ANGRY_LEFT_3 (화난 왼쪽 눈 3 - 가장 화난 눈)
-    {8, {
-        0b11111111, // # # # # # # # #
-        0b11011011, // # # . # # . # #
-        0b10000001, // # . . . . . . #
-        0b10000001, // # . . . . . . #
-        0b10000001, // # . . . . . . #
-        0b11000011, // # # . . . . # #
-        0b11100111, // # # # . . # # #
-        0b11111111  // # # # # # # # #
-    }},
-
-    // 인덱스 39: EYE_EVIL_RIGHT_1 (사악한 오른쪽 눈 1 - 눈썹 치켜올림 시작)
-    {8, {
-        0b00000000, // . . . . . . . .
-        0b00000000, // . . . . . . . .
-        0b00100100, // . . # . . # . .
-        0b01111110, // . # # # # # # .
-        0b01111110, // . # # # # # # .
-        0b00111100, // . . # # # # . .
-        0b00011000, // . . . # # . . .
-        0b00000000  // . . . . . . . .
-    }},
-
-    // 인덱스 40: EYE_EVIL_LEFT_1 (사악한 왼쪽 눈 1 - 눈썹 치켜올림 시작)
-    {8, {
-        0b00000000, // . . . . . . . .
-        0b00000000, // . . . . . . . .
-        0b00100100, // . . # . . # . .
-        0b01111110, // . # # # # # # .
-        0b01111110, // . # # # # # # .
-        0b00111100, // . . # # # # . .
-        0b00011000, // . . . # # . . .
-        0b00000000  // . . . . . . . .
-    }},
-
-    // 인덱스 41: EYE_EVIL_RIGHT_2 (사악한 오른쪽 눈 2 - 가장 사악한 눈)
-    {8, {
-        0b11111111, // # # # # # # # #
-        0b11011011, // # # . # # . # #
-        0b10000001, // # . . . . . . #
-        0b10000001, // # . . . . . . #
-        0b10000001, // # . . . . . . #
-        0b11000011, // # # . . . . # #
-        0b11100111, // # # # . . # # #
-        0b11111111  // # # # # # # # #
-    }},
-
-    // 인덱스 42: EYE_EVIL_LEFT_2 (사악한 왼쪽 눈 2 - 가장 사악한 눈)
-    {8, {
-        0b11111111, // # # # # # # # #
-        0b11011011, // # # . # # . # #
-        0b10000001, // # . . . . . . #
-        0b10000001, // # . . . . . . #
-        0b10000001, // # . . . . . . #
-        0b11000011, // # # . . . . # #
-        0b11100111, // # # # . . # # #
-        0b11111111  // # # # # # # # #
-    }},
-
-    // 인덱스 43: EYE_SCAN_LR_1 (좌우 스캔 눈동자 1 - 왼쪽 끝)
-    {8, {
-        0b00000000, // . . . . . . . .
-        0b00111100, // . . # # # # . .
-        0b01000010, // . # . . . . # .
-        0b01011010, // . # . # # . # .
-        0b01011010, // . # . # # . # .
-        0b01000010, // . # . . . . # .
-        0b00111100, // . . # # # # . .
-        0b00000000  // . . . . . . . .
-    }},
-
-    // 인덱스 44: EYE_SCAN_LR_2 (좌우 스캔 눈동자 2 - 중간)
-    {8, {
-        0b00000000, // . . . . . . . .
-        0b00111100, // . . # # # # . .
-        0b01000010, // . # . . . . # .
-        0b01000010, // . # . . . . # .
-        0b01110010, // . # # # . . # .
-        0b01110010, // . # # # . . # .
-        0b00111100, // . . # # # # . .
-        0b00000000  // . . . . . . . .
-    }},
-
-    // 인덱스 45: EYE_SCAN_LR_3 (좌우 스캔 눈동자 3 - 오른쪽 끝)
-    {8, {
-        0b00000000, // . . . . . . . .
-        0b00111100, // . . # # # # . .
-        0b01000010, // . # . . . . # .
-        0b01000010, // . # . . . . # .
-        0b01011010, // . # . # # . # .
-        0b01011010, // . # . # # . # .
-        0b00111100, // . . # # # # . .
-        0b00000000  // . . . . . . . .
-    }},
-
-    // 인덱스 46: EYE_SCAN_UD_1 (상하 스캔 눈동자 1 - 위쪽 중간)
-    {8, {
-        0b00000000, // . . . . . . . .
-        0b00111100, // . . # # # # . .
-        0b01000010, // . # . . . . # .
-        0b01001110, // . # . . # # # .
-        0b01001110, // . # . . # # # .
-        0b01000010, // . # . . . . # .
-        0b00111100, // . . # # # # . .
-        0b00000000  // . . . . . . . .
-    }},
-
-    // 인덱스 47: EYE_SCAN_UD_2 (상하 스캔 눈동자 2 - 중간)
-    {8, {
-        0b00000000, // . . . . . . . .
-        0b00111100, // . . # # # # . .
-        0b01001110, // . # . . # # # .
-        0b01001110, // . # . . # # # .
-        0b01000010, // . # . . . . # .
-        0b01000010, // . # . . . . # .
-        0b00111100, // . . # # # # . .
-        0b00000000  // . . . . . . . .
-    }},
-
-    // 인덱스 48: EYE_SCAN_UD_3 (상하 스캔 눈동자 3 - 아래쪽 끝)
-    {8, {
-        0b00000000, // . . . . . . . .
-        0b00111100, // . . # # # # . .
-        0b01011010, // . # . # # . # .
-        0b01011010, // . # . # # . # .
-        0b01000010, // . # . . . . # .
-        0b01000010, // . # . . . . # .
-        0b00111100, // . . # # # # . .
-        0b00000000  // . . . . . . . .
-    }},
-
-    // 인덱스 49: EYE_SQUINTED (찡그린 눈 - 최대로 찡그린)
-    {8, {
-        0b00000000, // . . . . . . . .
-        0b00111100, // . . # # # # . .
-        0b01000010, // . # . . . . # .
-        0b01000010, // . # . . . . # .
-        0b01001110, // . # . . # # # .
-        0b01001110, // . # . . # # # .
-        0b00111100, // . . # # # # . .
-        0b00000000  // . . . . . . . .
-    }},
-
-
-/*
-    // 인덱스 50: EYE_HEART_STAGE1 (하트 눈 모양 1)
-    {8, {
-        0b00111100, // . . # # # # . .
-        0b01111110, // . # # # # # # .
-        0b11111111, // # # # # # # # #
-        0b11100111, // # # # . . # # #
-        0b11100111, // # # # . . # # #
-        0b11111111, // # # # # # # # #
-        0b01111110, // . # # # # # # .
-        0b00111100  // . . # # # # . .
-    }},
-
-    // 인덱스 51: EYE_HEART_STAGE2 (하트 눈 모양 2)
-    {8, {
-        0b00111100, // . . # # # # . .
-        0b01111110, // . # # # # # # .
-        0b11111111, // # # # # # # # #
-        0b11100111, // # # # . . # # #
-        0b11100111, // # # # . . # # #
-        0b11111111, // # # # # # # # #
-        0b01111110, // . # # # # # # .
-        0b00111100  // . . # # # # . .
-    }},
-
-    // 인덱스 52: EYE_SLEEP_STAGE1 (잠자는 눈 모양 1)
-    {8, {
-        0b00111100, // . . # # # # . .
-        0b01111110, // . # # # # # # .
-        0b11111111, // # # # # # # # #
-        0b11100111, // # # # . . # # #
-        0b11100111, // # # # . . # # #
-        0b11111111, // # # # # # # # #
-        0b01111110, // . # # # # # # .
-        0b00111100  // . . # # # # . .
-    }},
-
-    // 인덱스 53: EYE_SLEEP_STAGE2 (잠자는 눈 모양 2)
-    {8, {
-        0b00111100, // . . # # # # . .
-        0b01111110, // . # # # # # # .
-        0b11111111, // # # # # # # # #
-        0b11100111, // # # # . . # # #
-        0b11100111, // # # # . . # # #
-        0b11111111, // # # # # # # # #
-        0b01111110, // . # # # # # # .
-        0b00111100  // . . # # # # . .
-    }},
-
-    // 인덱스 54: EYE_SLEEP_STAGE3 (잠자는 눈 모양 3)
-    {8, {
-        0b00111100, // . . # # # # . .
-        0b01111110, // . # # # # # # .
-        0b11111111, // # # # # # # # #
-        0b11100111, // # # # . . # # #
-        0b11100111, // # # # . . # # #
-        0b11111111, // # # # # # # # #
-        0b01111110, // . # # # # # # .
-        0b00111100  // . . # # # # . .
-    }},
-
-    // 인덱스 55: EYE_SLEEP_STAGE4 (잠자는 눈 모양 4)
-    {8, {
-        0b00111100, // . . # # # # . .
-        0b01111110, // . # # # # # # .
-        0b11111111, // # # # # # # # #
-        0b11100111, // # # # . . # # #
-        0b11100111, // # # # . . # # #
-        0b11111111, // # # # # # # # #
-        0b01111110, // . # # # # # # .
-        0b00111100  // . . # # # # . .
-    }},
-
-    // 인덱스 56: EYE_SLEEP_STAGE5 (잠자는 눈 모양 5)
-    {8, {
-        0b00111100, // . . # # # # . .
-        0b01111110, // . # # # # # # .
-        0b11111111, // # # # # # # # #
-        0b11100111, // # # # . . # # #
-        0b11100111, // # # # . . # # #
-        0b11111111, // # # # # # # # #
-        0b01111110, // . # # # # # # .
-        0b00111100  // . . # # # # . .
-    }},
-
-    // 인덱스 57: EYE_SLEEP_STAGE6 (잠자는 눈 모양 6 - 완전히 감김 또는 패턴)
-    {8, {
-        0b00111100, // . . # # # # . .
-        0b01111110, // . # # # # # # .
-        0b11111111, // # # # # # # # #
-        0b11100111, // # # # . . # # #
-        0b11100111, // # # # . . # # #
-        0b11111111, // # # # # # # # #
-        0b01111110, // . # # # # # # .
-        0b00111100  // . . # # # # . .
-    }},
-*/
 };
 
-// 폰트 데이터 배열의 길이 (T_R310_FontChar_t 개수)
-const int G_R310_ROBOT_EYES_FONT_LEN = sizeof(g_R310_RobotEyes_Font_arr) / sizeof(T_R310_FontChar_t);
+// 감정별 조회 테이블 (감정 인덱스로 바로 접근, 글리프 시퀀스가 없는 감정은 seq == nullptr, seqSize == 0)
+typedef struct {
+    T_R310_ani_Table_t          entry[EMT_COUNT];
+} T_R310_ani_Lookup_t;
+
+constexpr T_R310_ani_Lookup_t R310_ani_buildLookup() {
+    T_R310_ani_Lookup_t v_lookup = {};
+    for (uint8_t v_e = 0; v_e < EMT_COUNT; v_e++) {
+        v_lookup.entry[v_e] = {(T_R310_emotion_idx_t)v_e, nullptr, 0, EMTP_BLEND_OFF};
+    }
+    for (const T_R310_ani_Table_t& v_src : g_R310_ani_Tables_arr) {
+        v_lookup.entry[v_src.emotionIdx] = v_src;
+    }
+    return v_lookup;
+}
+
+// --- 시퀀스 목록 빌드 시점 검사 ---
+// 감정마다 항목은 최대 하나 (EMT_NONE / EMT_COUNT 는 등록 불가)
+constexpr bool R310_ani_isUnique() {
+    for (uint8_t v_i = 0; v_i < G_R310_ARRAY_SIZE(g_R310_ani_Tables_arr); v_i++) {
+        if (g_R310_ani_Tables_arr[v_i].emotionIdx == EMT_NONE || g_R310_ani_Tables_arr[v_i].emotionIdx >= EMT_COUNT) return false;
+        for (uint8_t v_j = v_i + 1; v_j < G_R310_ARRAY_SIZE(g_R310_ani_Tables_arr); v_j++) {
+            if (g_R310_ani_Tables_arr[v_i].emotionIdx == g_R310_ani_Tables_arr[v_j].emotionIdx) return false;
+        }
+    }
+    return true;
+}
+
+// 시퀀스 길이는 1 이상, 프레임 인덱스(int8_t aniFrameIndex) 범위 이내
+constexpr bool R310_ani_isSeqSizeValid() {
+    for (const T_R310_ani_Table_t& v_src : g_R310_ani_Tables_arr) {
+        if (v_src.seq == nullptr || v_src.seqSize == 0 || v_src.seqSize > INT8_MAX) return false;
+    }
+    return true;
+}
+
+// 모든 프레임의 글리프 인덱스가 폰트 범위 안에 있는지 검사합니다. (2bpp 글리프 개수를 알게 되는 R310_palette_001.h 에서 static_assert)
+// seqSize 가 실제 배열보다 크면 배열 밖을 읽게 되어 상수 식이 아니므로 역시 빌드가 실패합니다.
+constexpr bool R310_ani_isGlyphValid(int p_fontLen, int p_font2bppLen) {
+    for (const T_R310_ani_Table_t& v_src : g_R310_ani_Tables_arr) {
+        for (uint8_t v_f = 0; v_f < v_src.seqSize; v_f++) {
+            for (uint8_t v_eye = 0; v_eye < 2; v_eye++) {
+                uint8_t v_idx = v_src.seq[v_f].eyeData[v_eye];
+                if (v_idx & G_R310_FONT_2BPP_FLAG) {
+                    if ((v_idx & ~G_R310_FONT_2BPP_FLAG) >= p_font2bppLen) return false;
+                } else if (v_idx >= p_fontLen) {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+static_assert(R310_ani_isUnique(), "g_R310_ani_Tables_arr: 감정마다 시퀀스는 하나만 등록할 수 있습니다 (EMT_NONE 제외)");
+static_assert(R310_ani_isSeqSizeValid(), "g_R310_ani_Tables_arr: 시퀀스 길이는 1 ~ 127 프레임이어야 합니다");
+
+constexpr T_R310_ani_Lookup_t g_R310_ani_Lookup PROGMEM = R310_ani_buildLookup();
 
 
 ////////////////////////////////////////////////////////////////////
@@ -0,0 +1,406 @@
+#pragma once
+
+// R310_fontGen_001.h - 로봇 눈 폰트 PROGMEM 테이블 (자동 생성 파일, 직접 수정하지 마세요)
+// 원본: shared/R310_sprites/R310_eyes.json 및 스프라이트 시트 PNG
+// 생성: python shared/R310_spriteSheet.py (PlatformIO 빌드 전 단계에서 원본이 바뀌면 자동 실행)
+// 글리프 순서는 T_R310_EyeFontIndex_t (R310_data2_014.h) 와 같아야 하며, 아래 static_assert 로 확인합니다.
+
+#include "R310_fontPack_001.h"
+
+const int G_R310_ROBOT_EYES_FONT_LEN = 26; // 눈 폰트 글리프 개수 (모든 패널 크기 공통)
+
+static_assert(EYE_NEUTRAL == 0, "스프라이트 시트 글리프 순서가 T_R310_EyeFontIndex_t 와 다릅니다: EYE_NEUTRAL");
+static_assert(EYE_LOOK_DOWN_2 == 1, "스프라이트 시트 글리프 순서가 T_R310_EyeFontIndex_t 와 다릅니다: EYE_LOOK_DOWN_2");
+static_assert(EYE_LOOK_LEFT_2 == 2, "스프라이트 시트 글리프 순서가 T_R310_EyeFontIndex_t 와 다릅니다: EYE_LOOK_LEFT_2");
+static_assert(EYE_CLOSE_1 == 3, "스프라이트 시트 글리프 순서가 T_R310_EyeFontIndex_t 와 다릅니다: EYE_CLOSE_1");
+static_assert(EYE_CLOSE_2 == 4, "스프라이트 시트 글리프 순서가 T_R310_EyeFontIndex_t 와 다릅니다: EYE_CLOSE_2");
+static_assert(EYE_CLOSE_3 == 5, "스프라이트 시트 글리프 순서가 T_R310_EyeFontIndex_t 와 다릅니다: EYE_CLOSE_3");
+static_assert(EYE_CLOSE_4 == 6, "스프라이트 시트 글리프 순서가 T_R310_EyeFontIndex_t 와 다릅니다: EYE_CLOSE_4");
+static_assert(EYE_CLOSE_5 == 7, "스프라이트 시트 글리프 순서가 T_R310_EyeFontIndex_t 와 다릅니다: EYE_CLOSE_5");
+static_assert(EYE_ALL_OFF == 8, "스프라이트 시트 글리프 순서가 T_R310_EyeFontIndex_t 와 다릅니다: EYE_ALL_OFF");
+static_assert(EYE_SAD_RIGHT_1 == 9, "스프라이트 시트 글리프 순서가 T_R310_EyeFontIndex_t 와 다릅니다: EYE_SAD_RIGHT_1");
+static_assert(EYE_SAD_LEFT_1 == 10, "스프라이트 시트 글리프 순서가 T_R310_EyeFontIndex_t 와 다릅니다: EYE_SAD_LEFT_1");
+static_assert(EYE_SAD_RIGHT_2 == 11, "스프라이트 시트 글리프 순서가 T_R310_EyeFontIndex_t 와 다릅니다: EYE_SAD_RIGHT_2");
+static_assert(EYS_DIAGONAL_RIGHT_2 == 12, "스프라이트 시트 글리프 순서가 T_R310_EyeFontIndex_t 와 다릅니다: EYS_DIAGONAL_RIGHT_2");
+static_assert(EYS_DIAGONAL_RIGHT_3 == 13, "스프라이트 시트 글리프 순서가 T_R310_EyeFontIndex_t 와 다릅니다: EYS_DIAGONAL_RIGHT_3");
+static_assert(EYS_DIAGONAL_RIGHT_4 == 14, "스프라이트 시트 글리프 순서가 T_R310_EyeFontIndex_t 와 다릅니다: EYS_DIAGONAL_RIGHT_4");
+static_assert(EYS_DIAGONAL_RIGHT_5 == 15, "스프라이트 시트 글리프 순서가 T_R310_EyeFontIndex_t 와 다릅니다: EYS_DIAGONAL_RIGHT_5");
+static_assert(EYS_DIAGONAL_LEFT_1 == 16, "스프라이트 시트 글리프 순서가 T_R310_EyeFontIndex_t 와 다릅니다: EYS_DIAGONAL_LEFT_1");
+static_assert(EYS_DIAGONAL_LEFT_2 == 17, "스프라이트 시트 글리프 순서가 T_R310_EyeFontIndex_t 와 다릅니다: EYS_DIAGONAL_LEFT_2");
+static_assert(EYE_X_SHAPE_1 == 18, "스프라이트 시트 글리프 순서가 T_R310_EyeFontIndex_t 와 다릅니다: EYE_X_SHAPE_1");
+static_assert(EYE_X_SHAPE_2 == 19, "스프라이트 시트 글리프 순서가 T_R310_EyeFontIndex_t 와 다릅니다: EYE_X_SHAPE_2");
+static_assert(EYE_ANGRY_RIGHT_1 == 20, "스프라이트 시트 글리프 순서가 T_R310_EyeFontIndex_t 와 다릅니다: EYE_ANGRY_RIGHT_1");
+static_assert(EYE_ANGRY_LEFT_1 == 21, "스프라이트 시트 글리프 순서가 T_R310_EyeFontIndex_t 와 다릅니다: EYE_ANGRY_LEFT_1");
+static_assert(EYE_ANGRY_RIGHT_2 == 22, "스프라이트 시트 글리프 순서가 T_R310_EyeFontIndex_t 와 다릅니다: EYE_ANGRY_RIGHT_2");
+static_assert(EYE_ANGRY_LEFT_2 == 23, "스프라이트 시트 글리프 순서가 T_R310_EyeFontIndex_t 와 다릅니다: EYE_ANGRY_LEFT_2");
+static_assert(EYE_SCAN_LR_2 == 24, "스프라이트 시트 글리프 순서가 T_R310_EyeFontIndex_t 와 다릅니다: EYE_SCAN_LR_2");
+static_assert(EYE_SCAN_LR_3 == 25, "스프라이트 시트 글리프 순서가 T_R310_EyeFontIndex_t 와 다릅니다: EYE_SCAN_LR_3");
+
+// 8x8 눈 폰트: 26 글리프, RAW 234 바이트
+const T_R310_Glyph_t<8, 8> g_R310_RobotEyes_Font_arr[] PROGMEM = {
+    // 인덱스 0: EYE_NEUTRAL
+    {8, {
+        0b00000000, // . . . . . . . .
+        0b00111100, // . . # # # # . .
+        0b01111110, // . # # # # # # .
+        0b01100110, // . # # . . # # .
+        0b01100110, // . # # . . # # .
+        0b01111110, // . # # # # # # .
+        0b00111100, // . . # # # # . .
+        0b00000000  // . . . . . . . .
+    }},
+    // 인덱스 1: EYE_LOOK_DOWN_2
+    {8, {
+        0b00000000, // . . . . . . . .
+        0b00000000, // . . . . . . . .
+        0b00111100, // . . # # # # . .
+        0b01111110, // . # # # # # # .
+        0b01111110, // . # # # # # # .
+        0b01100110, // . # # . . # # .
+        0b01100110, // . # # . . # # .
+        0b00111100  // . . # # # # . .
+    }},
+    // 인덱스 2: EYE_LOOK_LEFT_2
+    {8, {
+        0b00000000, // . . . . . . . .
+        0b01111000, // . # # # # . . .
+        0b11111100, // # # # # # # . .
+        0b10011100, // # . . # # # . .
+        0b10011100, // # . . # # # . .
+        0b11111100, // # # # # # # . .
+        0b01111000, // . # # # # . . .
+        0b00000000  // . . . . . . . .
+    }},
+    // 인덱스 3: EYE_CLOSE_1
+    {8, {
+        0b00000000, // . . . . . . . .
+        0b00000000, // . . . . . . . .
+        0b01111110, // . # # # # # # .
+        0b01100110, // . # # . . # # .
+        0b01100110, // . # # . . # # .
+        0b01111110, // . # # # # # # .
+        0b00111100, // . . # # # # . .
+        0b00000000  // . . . . . . . .
+    }},
+    // 인덱스 4: EYE_CLOSE_2
+    {8, {
+        0b00000000, // . . . . . . . .
+        0b00000000, // . . . . . . . .
+        0b00000000, // . . . . . . . .
+        0b01100110, // . # # . . # # .
+        0b01100110, // . # # . . # # .
+        0b01111110, // . # # # # # # .
+        0b00111100, // . . # # # # . .
+        0b00000000  // . . . . . . . .
+    }},
+    // 인덱스 5: EYE_CLOSE_3
+    {8, {
+        0b00000000, // . . . . . . . .
+        0b00000000, // . . . . . . . .
+        0b00000000, // . . . . . . . .
+        0b00000000, // . . . . . . . .
+        0b01100110, // . # # . . # # .
+        0b01111110, // . # # # # # # .
+        0b00111100, // . . # # # # . .
+        0b00000000  // . . . . . . . .
+    }},
+    // 인덱스 6: EYE_CLOSE_4
+    {8, {
+        0b00000000, // . . . . . . . .
+        0b00000000, // . . . . . . . .
+        0b00000000, // . . . . . . . .
+        0b00000000, // . . . . . . . .
+        0b00000000, // . . . . . . . .
+        0b01111110, // . # # # # # # .
+        0b00111100, // . . # # # # . .
+        0b00000000  // . . . . . . . .
+    }},
+    // 인덱스 7: EYE_CLOSE_5
+    {8, {
+        0b00000000, // . . . . . . . .
+        0b00000000, // . . . . . . . .
+        0b00000000, // . . . . . . . .
+        0b00000000, // . . . . . . . .
+        0b00000000, // . . . . . . . .
+        0b00000000, // . . . . . . . .
+        0b00111100, // . . # # # # . .
+        0b00000000  // . . . . . . . .
+    }},
+    // 인덱스 8: EYE_ALL_OFF
+    {8, {
+        0b00000000, // . . . . . . . .
+        0b00000000, // . . . . . . . .
+        0b00000000, // . . . . . . . .
+        0b00000000, // . . . . . . . .
+        0b00000000, // . . . . . . . .
+        0b00000000, // . . . . . . . .
+        0b00000000, // . . . . . . . .
+        0b00000000  // . . . . . . . .
+    }},
+    // 인덱스 9: EYE_SAD_RIGHT_1
+    {8, {
+        0b00000000, // . . . . . . . .
+        0b00111000, // . . # # # . . .
+        0b01001100, // . # . . # # . .
+        0b01001110, // . # . . # # # .
+        0b01111110, // . # # # # # # .
+        0b00111110, // . . # # # # # .
+        0b00011100, // . . . # # # . .
+        0b00000000  // . . . . . . . .
+    }},
+    // 인덱스 10: EYE_SAD_LEFT_1
+    {8, {
+        0b00000000, // . . . . . . . .
+        0b00111000, // . . # # # . . .
+        0b01111100, // . # # # # # . .
+        0b01100110, // . # # . . # # .
+        0b01100110, // . # # . . # # .
+        0b00111110, // . . # # # # # .
+        0b00011100, // . . . # # # . .
+        0b00000000  // . . . . . . . .
+    }},
+    // 인덱스 11: EYE_SAD_RIGHT_2
+    {8, {
+        0b00000000, // . . . . . . . .
+        0b00111000, // . . # # # . . .
+        0b01111100, // . # # # # # . .
+        0b01110010, // . # # # . . # .
+        0b01110010, // . # # # . . # .
+        0b00111110, // . . # # # # # .
+        0b00011100, // . . . # # # . .
+        0b00000000  // . . . . . . . .
+    }},
+    // 인덱스 12: EYS_DIAGONAL_RIGHT_2
+    {8, {
+        0b00000000, // . . . . . . . .
+        0b00111000, // . . # # # . . .
+        0b01111100, // . # # # # # . .
+        0b01101110, // . # # . # # # .
+        0b01110110, // . # # # . # # .
+        0b00111110, // . . # # # # # .
+        0b00011100, // . . . # # # . .
+        0b00000000  // . . . . . . . .
+    }},
+    // 인덱스 13: EYS_DIAGONAL_RIGHT_3
+    {8, {
+        0b00000000, // . . . . . . . .
+        0b00110000, // . . # # . . . .
+        0b01111000, // . # # # # . . .
+        0b01101100, // . # # . # # . .
+        0b00110110, // . . # # . # # .
+        0b00011110, // . . . # # # # .
+        0b00001100, // . . . . # # . .
+        0b00000000  // . . . . . . . .
+    }},
+    // 인덱스 14: EYS_DIAGONAL_RIGHT_4
+    {8, {
+        0b00000000, // . . . . . . . .
+        0b01100000, // . # # . . . . .
+        0b01110000, // . # # # . . . .
+        0b00101000, // . . # . # . . .
+        0b00010100, // . . . # . # . .
+        0b00001110, // . . . . # # # .
+        0b00000110, // . . . . . # # .
+        0b00000000  // . . . . . . . .
+    }},
+    // 인덱스 15: EYS_DIAGONAL_RIGHT_5
+    {8, {
+        0b00000000, // . . . . . . . .
+        0b01000000, // . # . . . . . .
+        0b00100000, // . . # . . . . .
+        0b00010000, // . . . # . . . .
+        0b00001000, // . . . . # . . .
+        0b00000100, // . . . . . # . .
+        0b00000010, // . . . . . . # .
+        0b00000000  // . . . . . . . .
+    }},
+    // 인덱스 16: EYS_DIAGONAL_LEFT_1
+    {8, {
+        0b00000000, // . . . . . . . .
+        0b00011100, // . . . # # # . .
+        0b00111110, // . . # # # # # .
+        0b01100110, // . # # . . # # .
+        0b01100110, // . # # . . # # .
+        0b01111100, // . # # # # # . .
+        0b00011100, // . . . # # # . .
+        0b00000000  // . . . . . . . .
+    }},
+    // 인덱스 17: EYS_DIAGONAL_LEFT_2
+    {8, {
+        0b00000000, // . . . . . . . .
+        0b00011100, // . . . # # # . .
+        0b00111110, // . . # # # # # .
+        0b01110110, // . # # # . # # .
+        0b01101110, // . # # . # # # .
+        0b01111100, // . # # # # # . .
+        0b00011100, // . . . # # # . .
+        0b00000000  // . . . . . . . .
+    }},
+    // 인덱스 18: EYE_X_SHAPE_1
+    {8, {
+        0b00111100, // . . # # # # . .
+        0b01000010, // . # . . . . # .
+        0b01011010, // . # . # # . # .
+        0b01011010, // . # . # # . # .
+        0b01000010, // . # . . . . # .
+        0b00111100, // . . # # # # . .
+        0b00000000, // . . . . . . . .
+        0b00000000  // . . . . . . . .
+    }},
+    // 인덱스 19: EYE_X_SHAPE_2
+    {8, {
+        0b00111100, // . . # # # # . .
+        0b01000010, // . # . . . . # .
+        0b01110010, // . # # # . . # .
+        0b01110010, // . # # # . . # .
+        0b01000010, // . # . . . . # .
+        0b00111100, // . . # # # # . .
+        0b00000000, // . . . . . . . .
+        0b00000000  // . . . . . . . .
+    }},
+    // 인덱스 20: EYE_ANGRY_RIGHT_1
+    {8, {
+        0b00100100, // . . # . . # . .
+        0b01011010, // . # . # # . # .
+        0b10011001, // # . . # # . . #
+        0b10000001, // # . . . . . . #
+        0b10000001, // # . . . . . . #
+        0b01000010, // . # . . . . # .
+        0b00100100, // . . # . . # . .
+        0b00011000  // . . . # # . . .
+    }},
+    // 인덱스 21: EYE_ANGRY_LEFT_1
+    {8, {
+        0b00000000, // . . . . . . . .
+        0b00100100, // . . # . . # . .
+        0b01011010, // . # . # # . # .
+        0b01011010, // . # . # # . # .
+        0b01000010, // . # . . . . # .
+        0b00100100, // . . # . . # . .
+        0b00011000, // . . . # # . . .
+        0b00000000  // . . . . . . . .
+    }},
+    // 인덱스 22: EYE_ANGRY_RIGHT_2
+    {8, {
+        0b00000000, // . . . . . . . .
+        0b00100100, // . . # . . # . .
+        0b01111110, // . # # # # # # .
+        0b01111110, // . # # # # # # .
+        0b01111110, // . # # # # # # .
+        0b00111100, // . . # # # # . .
+        0b00011000, // . . . # # . . .
+        0b00000000  // . . . . . . . .
+    }},
+    // 인덱스 23: EYE_ANGRY_LEFT_2
+    {8, {
+        0b00000000, // . . . . . . . .
+        0b00000000, // . . . . . . . .
+        0b00100100, // . . # . . # . .
+        0b01111110, // . # # # # # # .
+        0b01111110, // . # # # # # # .
+        0b00111100, // . . # # # # . .
+        0b00011000, // . . . # # . . .
+        0b00000000  // . . . . . . . .
+    }},
+    // 인덱스 24: EYE_SCAN_LR_2
+    {8, {
+        0b00000000, // . . . . . . . .
+        0b00111100, // . . # # # # . .
+        0b01000010, // . # . . . . # .
+        0b01000010, // . # . . . . # .
+        0b01110010, // . # # # . . # .
+        0b01110010, // . # # # . . # .
+        0b00111100, // . . # # # # . .
+        0b00000000  // . . . . . . . .
+    }},
+    // 인덱스 25: EYE_SCAN_LR_3
+    {8, {
+        0b00000000, // . . . . . . . .
+        0b00111100, // . . # # # # . .
+        0b01000010, // . # . . . . # .
+        0b01000010, // . # . . . . # .
+        0b01011010, // . # . # # . # .
+        0b01011010, // . # . # # . # .
+        0b00111100, // . . # # # # . .
+        0b00000000  // . . . . . . . .
+    }},
+};
+
+constexpr T_R310_PackedFont_t<8, 8> g_R310_RobotEyes_Font = { FONT_CODEC_RAW, 26, g_R310_RobotEyes_Font_arr, nullptr, nullptr, nullptr };
+
+// 16x16 눈 폰트: 26 글리프, ROW_DICT 304 바이트 (RAW 858 바이트)
+// 행 사전 39개, 토큰 172개 (토큰 = (반복 - 1) << 6 | 사전 인덱스)
+const uint16_t g_R310_RobotEyes_Font16_rowDict[] PROGMEM = {
+    0x0000, //  0: . . . . . . . . . . . . . . . .
+    0x0FF0, //  1: . . . . # # # # # # # # . . . .
+    0x3FFC, //  2: . . # # # # # # # # # # # # . .
+    0x3C3C, //  3: . . # # # # . . . . # # # # . .
+    0x3FC0, //  4: . . # # # # # # # # . . . . . .
+    0xFFF0, //  5: # # # # # # # # # # # # . . . .
+    0xC3F0, //  6: # # . . . . # # # # # # . . . .
+    0x0FC0, //  7: . . . . # # # # # # . . . . . .
+    0x30F0, //  8: . . # # . . . . # # # # . . . .
+    0x30FC, //  9: . . # # . . . . # # # # # # . .
+    0x0FFC, // 10: . . . . # # # # # # # # # # . .
+    0x03F0, // 11: . . . . . . # # # # # # . . . .
+    0x3FF0, // 12: . . # # # # # # # # # # . . . .
+    0x3F0C, // 13: . . # # # # # # . . . . # # . .
+    0x3CFC, // 14: . . # # # # . . # # # # # # . .
+    0x3F3C, // 15: . . # # # # # # . . # # # # . .
+    0x0F00, // 16: . . . . # # # # . . . . . . . .
+    0x3CF0, // 17: . . # # # # . . # # # # . . . .
+    0x0F3C, // 18: . . . . # # # # . . # # # # . .
+    0x03FC, // 19: . . . . . . # # # # # # # # . .
+    0x00F0, // 20: . . . . . . . . # # # # . . . .
+    0x3C00, // 21: . . # # # # . . . . . . . . . .
+    0x3F00, // 22: . . # # # # # # . . . . . . . .
+    0x0CC0, // 23: . . . . # # . . # # . . . . . .
+    0x0330, // 24: . . . . . . # # . . # # . . . .
+    0x00FC, // 25: . . . . . . . . # # # # # # . .
+    0x003C, // 26: . . . . . . . . . . # # # # . .
+    0x3000, // 27: . . # # . . . . . . . . . . . .
+    0x0C00, // 28: . . . . # # . . . . . . . . . .
+    0x0300, // 29: . . . . . . # # . . . . . . . .
+    0x00C0, // 30: . . . . . . . . # # . . . . . .
+    0x0030, // 31: . . . . . . . . . . # # . . . .
+    0x000C, // 32: . . . . . . . . . . . . # # . .
+    0x300C, // 33: . . # # . . . . . . . . # # . .
+    0x33CC, // 34: . . # # . . # # # # . . # # . .
+    0x0C30, // 35: . . . . # # . . . . # # . . . .
+    0xC3C3, // 36: # # . . . . # # # # . . . . # #
+    0xC003, // 37: # # . . . . . . . . . . . . # #
+    0x03C0, // 38: . . . . . . # # # # . . . . . .
+};
+
+const uint8_t g_R310_RobotEyes_Font16_stream[] PROGMEM = {
+    0x40, 0x41, 0x42, 0xC3, 0x42, 0x41, 0x40, // 0: EYE_NEUTRAL
+    0xC0, 0x41, 0xC2, 0xC3, 0x41, // 1: EYE_LOOK_DOWN_2
+    0x40, 0x44, 0x45, 0xC6, 0x45, 0x44, 0x40, // 2: EYE_LOOK_LEFT_2
+    0xC0, 0x42, 0xC3, 0x42, 0x41, 0x40, // 3: EYE_CLOSE_1
+    0xC0, 0x40, 0xC3, 0x42, 0x41, 0x40, // 4: EYE_CLOSE_2
+    0xC0, 0xC0, 0x43, 0x42, 0x41, 0x40, // 5: EYE_CLOSE_3
+    0xC0, 0xC0, 0x40, 0x42, 0x41, 0x40, // 6: EYE_CLOSE_4
+    0xC0, 0xC0, 0xC0, 0x41, 0x40, // 7: EYE_CLOSE_5
+    0xC0, 0xC0, 0xC0, 0xC0, // 8: EYE_ALL_OFF
+    0x40, 0x47, 0x48, 0x49, 0x42, 0x4A, 0x4B, 0x40, // 9: EYE_SAD_RIGHT_1
+    0x40, 0x47, 0x4C, 0xC3, 0x4A, 0x4B, 0x40, // 10: EYE_SAD_LEFT_1
+    0x40, 0x47, 0x4C, 0xCD, 0x4A, 0x4B, 0x40, // 11: EYE_SAD_RIGHT_2
+    0x40, 0x47, 0x4C, 0x4E, 0x4F, 0x4A, 0x4B, 0x40, // 12: EYS_DIAGONAL_RIGHT_2
+    0x40, 0x50, 0x44, 0x51, 0x52, 0x53, 0x54, 0x40, // 13: EYS_DIAGONAL_RIGHT_3
+    0x40, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x40, // 14: EYS_DIAGONAL_RIGHT_4
+    0x40, 0x5B, 0x5C, 0x5D, 0x5E, 0x5F, 0x60, 0x40, // 15: EYS_DIAGONAL_RIGHT_5
+    0x40, 0x4B, 0x4A, 0xC3, 0x4C, 0x4B, 0x40, // 16: EYS_DIAGONAL_LEFT_1
+    0x40, 0x4B, 0x4A, 0x4F, 0x4E, 0x4C, 0x4B, 0x40, // 17: EYS_DIAGONAL_LEFT_2
+    0x41, 0x61, 0xE2, 0x61, 0x41, 0xC0, // 18: EYE_X_SHAPE_1
+    0x41, 0x61, 0xCD, 0x61, 0x41, 0xC0, // 19: EYE_X_SHAPE_2
+    0x63, 0x62, 0x64, 0xE5, 0x61, 0x63, 0x66, // 20: EYE_ANGRY_RIGHT_1
+    0x40, 0x63, 0xE2, 0x61, 0x63, 0x66, 0x40, // 21: EYE_ANGRY_LEFT_1
+    0x40, 0x63, 0xC2, 0x42, 0x41, 0x66, 0x40, // 22: EYE_ANGRY_RIGHT_2
+    0xC0, 0x63, 0xC2, 0x41, 0x66, 0x40, // 23: EYE_ANGRY_LEFT_2
+    0x40, 0x41, 0xE1, 0xCD, 0x41, 0x40, // 24: EYE_SCAN_LR_2
+    0x40, 0x41, 0xE1, 0xE2, 0x41, 0x40, // 25: EYE_SCAN_LR_3
+};
+
+const uint16_t g_R310_RobotEyes_Font16_offset[] PROGMEM = { 0, 7, 12, 19, 25, 31, 37, 43, 48, 52, 60, 67, 74, 82, 90, 98, 106, 113, 121, 127, 133, 140, 147, 154, 160, 166, 172 };
+
+constexpr T_R310_PackedFont_t<16, 16> g_R310_RobotEyes_Font16 = { FONT_CODEC_ROW_DICT, 26, nullptr, g_R310_RobotEyes_Font16_rowDict, g_R310_RobotEyes_Font16_stream, g_R310_RobotEyes_Font16_offset };
@@ -0,0 +1,57 @@
+#pragma once
+
+// R310_fontPack_001.h - 압축 눈 폰트 형식 및 디코더
+// 폰트 테이블은 shared/R310_spriteSheet.py 가 스프라이트 시트 PNG 에서 생성합니다. (R310_fontGen_001.h)
+// 코덱은 패널 크기별로 더 작은 쪽이 선택됩니다.
+//   RAW      : T_R310_Glyph_t 배열 그대로
+//   ROW_DICT : 고유 행 사전 + 글리프별 토큰 스트림 (토큰 = (반복 - 1) << 6 | 사전 인덱스)
+// 그리기 커널은 글리프 하나를 행 배열로 한 번에 풀어 쓰며, 디코딩은 토큰 수(16x16 기준 글리프당 약 7개)만큼의 PROGMEM 읽기입니다.
+
+#include "R310_config_009.h"
+#include "R310_glyph_001.h"
+
+// 폰트 코덱
+typedef enum {
+    FONT_CODEC_RAW,             // 글리프 원본 (T_R310_Glyph_t 배열)
+    FONT_CODEC_ROW_DICT,        // 행 사전 + 반복 길이 토큰
+} T_R310_FontCodec_t;
+
+#define G_R310_FONT_TOKEN_IDX_MASK  0x3F    // 토큰 하위 6비트: 행 사전 인덱스
+#define G_R310_FONT_TOKEN_RUN_SHIFT 6       // 토큰 상위 2비트: 반복 횟수 - 1
+
+// 압축 폰트 기술자 (테이블 포인터는 모두 PROGMEM)
+template <uint8_t W, uint8_t H>
+struct T_R310_PackedFont_t {
+    typedef typename T_R310_RowBits_t<W>::type row_t;
+
+    T_R310_FontCodec_t              codec;      // 코덱
+    uint8_t                         count;      // 글리프 개수
+    const T_R310_Glyph_t<W, H>*     raw;        // FONT_CODEC_RAW: 글리프 배열
+    const row_t*                    rowDict;    // FONT_CODEC_ROW_DICT: 고유 행 사전
+    const uint8_t*                  stream;     // FONT_CODEC_ROW_DICT: 토큰 스트림
+    const uint16_t*                 offset;     // FONT_CODEC_ROW_DICT: 글리프별 스트림 시작 위치 (count + 1개)
+};
+
+
+// 글리프 하나를 행 배열로 풉니다.
+// @param p_rows 출력 행 배열 (H개, MSB = 열 0)
+template <uint8_t W, uint8_t H>
+void R310_font_unpack(const T_R310_PackedFont_t<W, H>* p_font, uint8_t p_glyphIdx, typename T_R310_RowBits_t<W>::type* p_rows) {
+    typedef typename T_R310_RowBits_t<W>::type row_t;
+
+    if (p_font->codec == FONT_CODEC_RAW) {
+        for (uint8_t v_row = 0; v_row < H; v_row++) p_rows[v_row] = R310_glyph_readRow(&p_font->raw[p_glyphIdx], v_row);
+        return;
+    }
+
+    uint16_t v_pos = pgm_read_word(&p_font->offset[p_glyphIdx]);
+    uint8_t  v_row = 0;
+    while (v_row < H) {
+        uint8_t v_token = pgm_read_byte(&p_font->stream[v_pos++]);
+        row_t   v_bits;
+        memcpy_P(&v_bits, &p_font->rowDict[v_token & G_R310_FONT_TOKEN_IDX_MASK], sizeof(row_t));
+        for (uint8_t v_run = (uint8_t)((v_token >> G_R310_FONT_TOKEN_RUN_SHIFT) + 1); v_run > 0 && v_row < H; v_run--) {
+            p_rows[v_row++] = v_bits;
+        }
+    }
+}
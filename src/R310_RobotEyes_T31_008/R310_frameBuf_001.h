@@ -0,0 +1,190 @@
+#pragma once
+
+// R310_frameBuf_001.h - 1bpp 눈 프레임버퍼 및 CRGB 일괄 확장
+// 눈 모양은 1비트/픽셀 버퍼(행당 패널 너비 비트)에서 행 단위 비트 연산(OR, AND-NOT)으로 합성하고,
+// FastLED.show() 직전에 바이트->8픽셀 확장 테이블로 한 번에 CRGB 배열로 변환합니다.
+// 2bpp 팔레트 글리프용 두 번째 비트 평면(rowsHi)을 함께 두며, 픽셀 값 = rows 비트 | (rowsHi 비트 << 1) 팔레트 인덱스입니다.
+// 버퍼와 그리기 커널은 패널 크기(W, H)에 대한 템플릿이며, 8x8/16x16 각각 따로 인스턴스화됩니다.
+
+#include "R310_config_009.h"
+#include "R310_data2_014.h"
+#include "R310_fontPack_001.h"
+#include "R310_glyph_001.h"
+#include "R310_hotTables_001.h"
+#include "R310_pixelMap_001.h"
+#include "R310_palette_001.h"
+
+// 1bpp 눈 프레임버퍼 (패널 W x H, 행당 W비트, MSB = 열 0)
+template <uint8_t W, uint8_t H>
+struct T_R310_EyeFrameBufWH_t {
+    typedef typename T_R310_RowBits_t<W>::type row_t;
+
+    row_t rows[2][H];       // [T_R310_EyeSide_Idx_t][행] 팔레트 인덱스 bit0 평면 (1bpp 글리프)
+    row_t rowsHi[2][H];     // [T_R310_EyeSide_Idx_t][행] 팔레트 인덱스 bit1 평면 (2bpp 글리프 전용)
+};
+
+// 엔진이 사용하는 프레임버퍼 (G_R310_PANEL_SIZE 기준)
+typedef T_R310_EyeFrameBufWH_t<G_R310_EYE_COL_SIZE, G_R310_DISPLAY_HEIGHT> T_R310_EyeFrameBuf_t;
+typedef T_R310_EyeFrameBuf_t::row_t T_R310_EyeRow_t;
+
+
+// 패널 크기별 눈 폰트 (글리프 인덱스는 크기와 무관하게 T_R310_EyeFontIndex_t 공유, 글리프 단위로 행 배열에 풀어 사용)
+// 현재 패널 크기의 글리프는 DRAM 사본(R310_hotTables_001.h)에서 읽고, 사본이 없을 때만 압축 폰트를 풉니다.
+template <uint8_t W, uint8_t H> struct T_R310_EyeFont_t;
+template <> struct T_R310_EyeFont_t<8, 8> {
+    static constexpr const T_R310_PackedFont_t<8, 8>* PACKED = &g_R310_RobotEyes_Font;
+    static void G_R310_HOT_CODE load(uint8_t p_fontIdx, uint8_t* p_rows) { if (!R310_hot_loadGlyph<8, 8>(p_fontIdx, p_rows)) R310_font_unpack(PACKED, p_fontIdx, p_rows); }
+};
+template <> struct T_R310_EyeFont_t<16, 16> {
+    static constexpr const T_R310_PackedFont_t<16, 16>* PACKED = &g_R310_RobotEyes_Font16;
+    static void G_R310_HOT_CODE load(uint8_t p_fontIdx, uint16_t* p_rows) { if (!R310_hot_loadGlyph<16, 16>(p_fontIdx, p_rows)) R310_font_unpack(PACKED, p_fontIdx, p_rows); }
+};
+
+static_assert(g_R310_RobotEyes_Font16.count == g_R310_RobotEyes_Font.count, "16x16 폰트와 8x8 폰트의 글리프 수가 다릅니다");
+
+
+// 바이트 -> 8픽셀 마스크 확장 테이블 생성 (열 n의 마스크가 n번째 바이트, 켜짐 0xFF / 꺼짐 0x00)
+constexpr uint64_t R310_fb_spreadEntry(uint8_t p_rowByte) {
+    uint64_t v_spread = 0;
+    for (uint8_t v_col = 0; v_col < 8; v_col++) {
+        if (p_rowByte & (0x80 >> v_col)) v_spread |= (uint64_t)0xFF << (v_col * 8);
+    }
+    return v_spread;
+}
+
+typedef struct {
+    uint64_t mask[256];
+} T_R310_SpreadTable_t;
+
+constexpr T_R310_SpreadTable_t R310_fb_buildSpreadTable() {
+    T_R310_SpreadTable_t v_table{};
+    for (uint16_t v_i = 0; v_i < 256; v_i++) {
+        v_table.mask[v_i] = R310_fb_spreadEntry((uint8_t)v_i);
+    }
+    return v_table;
+}
+
+constexpr T_R310_SpreadTable_t G_R310_HOT_DATA g_R310_fb_spreadTable = R310_fb_buildSpreadTable();
+
+
+// 2bpp 행의 바이트(4열) -> 비트 평면 분리 테이블 (하위 니블: bit0 평면 4열, 상위 니블: bit1 평면 4열)
+typedef struct {
+    uint8_t planes[256];
+} T_R310_DeinterleaveTable_t;
+
+constexpr T_R310_DeinterleaveTable_t R310_fb_buildDeinterleaveTable() {
+    T_R310_DeinterleaveTable_t v_table{};
+    for (uint16_t v_i = 0; v_i < 256; v_i++) {
+        uint8_t v_lo = 0;
+        uint8_t v_hi = 0;
+        for (uint8_t v_col = 0; v_col < 4; v_col++) {
+            v_lo |= (uint8_t)(((v_i >> (6 - v_col * 2)) & 0x01) << (3 - v_col));
+            v_hi |= (uint8_t)(((v_i >> (7 - v_col * 2)) & 0x01) << (3 - v_col));
+        }
+        v_table.planes[v_i] = (uint8_t)((v_hi << 4) | v_lo);
+    }
+    return v_table;
+}
+
+constexpr T_R310_DeinterleaveTable_t G_R310_HOT_DATA g_R310_fb_deinterleaveTable = R310_fb_buildDeinterleaveTable();
+
+
+// 프레임버퍼 전체 지우기
+template <uint8_t W, uint8_t H>
+void G_R310_HOT_CODE R310_fb_clear(T_R310_EyeFrameBufWH_t<W, H>* p_fb) {
+    memset(p_fb, 0, sizeof(T_R310_EyeFrameBufWH_t<W, H>));
+}
+
+// 폰트 글리프를 한 눈에 OR 합성
+template <uint8_t W, uint8_t H>
+void G_R310_HOT_CODE R310_fb_orGlyph(T_R310_EyeFrameBufWH_t<W, H>* p_fb, T_R310_EyeSide_Idx_t p_eyeSideIdx, uint8_t p_eyeFontIdx) {
+    typename T_R310_EyeFrameBufWH_t<W, H>::row_t v_glyph[H];
+    T_R310_EyeFont_t<W, H>::load(p_eyeFontIdx, v_glyph);
+    for (uint8_t v_row = 0; v_row < H; v_row++) {
+        p_fb->rows[p_eyeSideIdx][v_row] |= v_glyph[v_row];
+    }
+}
+
+// 변환 플래그(G_R310_TF_*)를 적용한 폰트 글리프를 한 눈에 OR 합성
+// 변환 파라미터는 글리프당 한 번 마스크/시프트량으로 풀어 두고, 행 루프는 분기 없이 같은 연산만 수행합니다.
+// (상하 반전: 원본 행 인덱스 XOR, 세로 이동: 범위 밖 행 마스크, 좌우 반전: 마스크 선택, 가로 이동: 시프트 쌍, 반전: XOR)
+// 변환이 없는 프레임은 기존 R310_fb_orGlyph 경로를 그대로 사용합니다.
+template <uint8_t W, uint8_t H>
+void G_R310_HOT_CODE R310_fb_orGlyphTf(T_R310_EyeFrameBufWH_t<W, H>* p_fb, T_R310_EyeSide_Idx_t p_eyeSideIdx, uint8_t p_eyeFontIdx, uint8_t p_transform) {
+    typedef typename T_R310_EyeFrameBufWH_t<W, H>::row_t row_t;
+    static_assert((H & (H - 1)) == 0, "상하 반전 행 인덱스 XOR 은 2의 거듭제곱 높이만 지원합니다");
+
+    if (p_transform == G_R310_TF_NONE) {
+        R310_fb_orGlyph(p_fb, p_eyeSideIdx, p_eyeFontIdx);
+        return;
+    }
+
+    const int8_t  v_dx       = (int8_t)(G_R310_TF_DX(p_transform) * T_R310_RowScale_t<W>::FACTOR);
+    const int8_t  v_dy       = (int8_t)(G_R310_TF_DY(p_transform) * T_R310_RowScale_t<W>::FACTOR);
+    const uint8_t v_rowXor   = (p_transform & G_R310_TF_MIRROR_V) ? (uint8_t)(H - 1) : 0;
+    const row_t   v_mirror   = (p_transform & G_R310_TF_MIRROR_H) ? (row_t)~0 : 0;
+    const row_t   v_invert   = (p_transform & G_R310_TF_INVERT) ? (row_t)~0 : 0;
+    const uint8_t v_shiftR   = (v_dx > 0) ? (uint8_t)v_dx : 0;
+    const uint8_t v_shiftL   = (v_dx < 0) ? (uint8_t)-v_dx : 0;
+
+    row_t v_glyph[H];
+    T_R310_EyeFont_t<W, H>::load(p_eyeFontIdx, v_glyph);
+    for (uint8_t v_row = 0; v_row < H; v_row++) {
+        uint8_t v_srcRow = (uint8_t)(v_row - v_dy);                             // 범위 밖이면 H 이상 (uint8_t 랩어라운드)
+        row_t   v_valid  = (row_t)(0 - (row_t)(v_srcRow < H));                  // 범위 안 0xFF.., 밖 0
+        row_t   v_bits   = v_glyph[(v_srcRow & (H - 1)) ^ v_rowXor] & v_valid;
+        v_bits ^= (row_t)((v_bits ^ R310_glyph_reverseRow(v_bits)) & v_mirror);
+        v_bits  = (row_t)((row_t)(v_bits >> v_shiftR) << v_shiftL);
+        p_fb->rows[p_eyeSideIdx][v_row] |= (row_t)(v_bits ^ v_invert);
+    }
+}
+
+// 2bpp 팔레트 글리프(8x8)를 한 눈에 OR 합성 (행 단위로 두 비트 평면 분리, 큰 패널은 정수배 확대)
+// @param p_glyph2bppIdx g_R310_RobotEyes_Font2bpp_arr 인덱스 (G_R310_FONT_2BPP_FLAG 제외)
+template <uint8_t W, uint8_t H>
+void G_R310_HOT_CODE R310_fb_orGlyph2bpp(T_R310_EyeFrameBufWH_t<W, H>* p_fb, T_R310_EyeSide_Idx_t p_eyeSideIdx, uint8_t p_glyph2bppIdx) {
+    static_assert(H == 8 * T_R310_RowScale_t<W>::FACTOR, "2bpp 글리프 확대는 정사각 패널만 지원합니다");
+    const uint16_t* v_glyph = g_R310_RobotEyes_Font2bpp_arr[p_glyph2bppIdx].rows;
+    for (uint8_t v_row = 0; v_row < H; v_row++) {
+        uint16_t v_packed = pgm_read_word(&v_glyph[v_row / T_R310_RowScale_t<W>::FACTOR]);
+        uint8_t  v_left   = g_R310_fb_deinterleaveTable.planes[v_packed >> 8];      // 열 0~3
+        uint8_t  v_right  = g_R310_fb_deinterleaveTable.planes[v_packed & 0xFF];    // 열 4~7
+        p_fb->rows[p_eyeSideIdx][v_row]   |= T_R310_RowScale_t<W>::fromRow8((uint8_t)(((v_left & 0x0F) << 4) | (v_right & 0x0F)));
+        p_fb->rowsHi[p_eyeSideIdx][v_row] |= T_R310_RowScale_t<W>::fromRow8((uint8_t)((v_left & 0xF0) | (v_right >> 4)));
+    }
+}
+
+// 폰트 글리프 모양만큼 한 눈을 지움 (AND-NOT, 눈꺼풀/마스크 합성용)
+template <uint8_t W, uint8_t H>
+void G_R310_HOT_CODE R310_fb_andNotGlyph(T_R310_EyeFrameBufWH_t<W, H>* p_fb, T_R310_EyeSide_Idx_t p_eyeSideIdx, uint8_t p_eyeFontIdx) {
+    typedef typename T_R310_EyeFrameBufWH_t<W, H>::row_t row_t;
+    row_t v_glyph[H];
+    T_R310_EyeFont_t<W, H>::load(p_eyeFontIdx, v_glyph);
+    for (uint8_t v_row = 0; v_row < H; v_row++) {
+        row_t v_mask = (row_t)~v_glyph[v_row];
+        p_fb->rows[p_eyeSideIdx][v_row]   &= v_mask;
+        p_fb->rowsHi[p_eyeSideIdx][v_row] &= v_mask;
+    }
+}
+
+// 프레임버퍼를 CRGB 배열로 일괄 확장 (꺼진 픽셀은 팔레트 0번 색으로 기록되므로 FastLED.clear()가 필요 없음)
+// 8열 묶음마다 두 평면을 확장 테이블로 펼쳐 8픽셀 팔레트 인덱스를 한 번에 만든 뒤 팔레트에서 색을 읽습니다.
+// @param p_leds 대상 CRGB 배열 (g_R310_pixelLut 인덱스 기준)
+// @param p_palette 팔레트 (1bpp 글리프는 1번 색)
+template <uint8_t W, uint8_t H>
+void G_R310_HOT_CODE R310_fb_expand(const T_R310_EyeFrameBufWH_t<W, H>* p_fb, CRGB* p_leds, const T_R310_Palette_t* p_palette) {
+    static_assert(W == G_R310_EYE_COL_SIZE && H == G_R310_DISPLAY_HEIGHT, "확장 대상 프레임버퍼는 g_R310_pixelLut 패널 크기와 같아야 합니다");
+    for (uint8_t v_eye = 0; v_eye < 2; v_eye++) {
+        for (uint8_t v_row = 0; v_row < H; v_row++) {
+            const uint16_t* v_rowLut = g_R310_pixelLut.idx[v_eye][v_row];
+            for (uint8_t v_chunk = 0; v_chunk < W / 8; v_chunk++) {
+                uint8_t  v_shift = (uint8_t)(W - 8 - v_chunk * 8);
+                uint64_t v_idx8  = (g_R310_fb_spreadTable.mask[(uint8_t)(p_fb->rows[v_eye][v_row] >> v_shift)]   & 0x0101010101010101ULL) |
+                                   (g_R310_fb_spreadTable.mask[(uint8_t)(p_fb->rowsHi[v_eye][v_row] >> v_shift)] & 0x0202020202020202ULL);
+                for (uint8_t v_col = 0; v_col < 8; v_col++) {
+                    p_leds[v_rowLut[v_chunk * 8 + v_col]] = p_palette->color[(uint8_t)(v_idx8 >> (v_col * 8)) & 0x03];
+                }
+            }
+        }
+    }
+}
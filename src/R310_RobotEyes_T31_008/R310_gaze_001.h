@@ -0,0 +1,151 @@
+#pragma once
+
+// R310_gaze_001.h - 차량 움직임 기반 실시간 시선 오버레이
+// M010 의 yaw 각속도(좌우)와 pitch 각도(상하)를 목표 시선으로 받아 임계 감쇠 스프링으로 부드럽게 따라가고,
+// 현재 글리프의 눈동자(눈 외곽 안쪽의 빈 영역)를 그 오프셋만큼 옮겨 그립니다.
+// 애니메이션 시퀀스(g_R310_eyeFb)는 건드리지 않고 출력 직전에만 합성하므로 시퀀스를 다시 시작하지 않으며,
+// 합성 비용은 눈당 행 수만큼의 비트 연산이라 100Hz 갱신에도 부담이 없습니다.
+
+#include "R310_config_009.h"
+#include "R310_data2_014.h"
+#include "R310_frameBuf_001.h"
+#include <math.h>
+
+#define G_R310_GAZE_REFRESH_MS      10                          // 시선 갱신 주기 (밀리초, 100Hz)
+#define G_R310_GAZE_OMEGA           10.0f                       // 스프링 고유 각진동수 (rad/s, 약 0.5초에 목표의 95% 도달)
+#define G_R310_GAZE_MAX_DT_S        0.1f                        // 한 번에 적분할 최대 시간 (루프 지연 시 튐 방지)
+#define G_R310_GAZE_YAW_FULL_DPS    60.0f                       // 시선이 좌우 끝까지 가는 yaw 각속도 (도/초)
+#define G_R310_GAZE_PITCH_FULL_DEG  15.0f                       // 시선이 위아래 끝까지 가는 pitch 각도 (도)
+#define G_R310_GAZE_LOOK_FULL_DEG   45.0f                       // "look" 명령에서 시선이 끝까지 가는 각도 (도)
+#define G_R310_GAZE_MAX_PX          (G_R310_EYE_COL_SIZE / 4)   // 눈동자 최대 이동량 (픽셀, 8x8: 2, 16x16: 4)
+#define G_R310_GAZE_SETTLE_EPS      0.01f                       // 정지 판정 오차 (위치/속도, 픽셀 오프셋이 더 바뀌지 않는 수준)
+
+// 시선 오버레이 상태
+typedef struct {
+    bool        isEnabled;          // 오버레이 사용 여부
+    float       targetX;            // 목표 시선 (-1: 왼쪽(열 0 쪽) ~ 1: 오른쪽)
+    float       targetY;            // 목표 시선 (-1: 위 ~ 1: 아래)
+    float       posX;               // 현재 시선 (스프링 위치)
+    float       posY;
+    float       velX;               // 현재 시선 속도 (스프링 속도, 초당)
+    float       velY;
+    uint32_t    lastStepTime;       // 마지막 적분 시간 (밀리초)
+    int8_t      offsetX;            // 현재 적용 중인 눈동자 오프셋 (픽셀, + = 열 증가 방향)
+    int8_t      offsetY;            // 현재 적용 중인 눈동자 오프셋 (픽셀, + = 아래)
+} T_R310_Gaze_t;
+
+
+// 시선 오버레이 초기화 (정면)
+void R310_gaze_init(T_R310_Gaze_t* p_gaze) {
+    memset(p_gaze, 0, sizeof(T_R310_Gaze_t));
+    p_gaze->isEnabled    = true;
+    p_gaze->lastStepTime = millis();
+}
+
+// 차량 상태로 목표 시선을 정합니다. (센서 데이터가 들어올 때마다 호출)
+// 우회전(yaw 양수)이면 오른쪽, 오르막(pitch 양수)이면 위를 봅니다.
+// @param p_yawRate_degps yaw 각속도 (도/초)
+// @param p_pitch_deg pitch 각도 (도)
+// @return 목표 시선이 바뀌었으면 true (정지해 있던 스프링을 다시 돌려야 함)
+bool R310_gaze_setTarget(T_R310_Gaze_t* p_gaze, float p_yawRate_degps, float p_pitch_deg) {
+    float v_targetX = constrain(p_yawRate_degps / G_R310_GAZE_YAW_FULL_DPS, -1.0f, 1.0f);
+    float v_targetY = constrain(-p_pitch_deg / G_R310_GAZE_PITCH_FULL_DEG, -1.0f, 1.0f);
+    if (v_targetX == p_gaze->targetX && v_targetY == p_gaze->targetY) return false;
+    p_gaze->targetX = v_targetX;
+    p_gaze->targetY = v_targetY;
+    return true;
+}
+
+// 각도로 목표 시선을 정합니다. ("look <yaw> <pitch>" 명령, 차량 상태 입력이 있으면 다음 입력이 덮어씀)
+// @param p_yaw_deg 좌우 각도 (도, + 오른쪽)
+// @param p_pitch_deg 위아래 각도 (도, + 위)
+// @return 목표 시선이 바뀌었으면 true
+bool R310_gaze_setLook(T_R310_Gaze_t* p_gaze, float p_yaw_deg, float p_pitch_deg) {
+    float v_targetX = constrain(p_yaw_deg / G_R310_GAZE_LOOK_FULL_DEG, -1.0f, 1.0f);
+    float v_targetY = constrain(-p_pitch_deg / G_R310_GAZE_LOOK_FULL_DEG, -1.0f, 1.0f);
+    if (v_targetX == p_gaze->targetX && v_targetY == p_gaze->targetY) return false;
+    p_gaze->targetX = v_targetX;
+    p_gaze->targetY = v_targetY;
+    return true;
+}
+
+// 스프링이 목표에 멈춰 더 진행해도 픽셀 오프셋이 바뀌지 않는지 (꺼져 있으면 항상 true)
+bool R310_gaze_isSettled(const T_R310_Gaze_t* p_gaze) {
+    if (!p_gaze->isEnabled) return true;
+    return fabsf(p_gaze->posX - p_gaze->targetX) < G_R310_GAZE_SETTLE_EPS && fabsf(p_gaze->velX) < G_R310_GAZE_SETTLE_EPS &&
+           fabsf(p_gaze->posY - p_gaze->targetY) < G_R310_GAZE_SETTLE_EPS && fabsf(p_gaze->velY) < G_R310_GAZE_SETTLE_EPS;
+}
+
+// 임계 감쇠 스프링 한 축을 p_dt 만큼 진행합니다. (해석해 사용, 시간 간격과 무관하게 안정)
+void R310_gaze_damp(float* p_pos, float* p_vel, float p_target, float p_dt) {
+    float v_err   = *p_pos - p_target;
+    float v_tmp   = (*p_vel + G_R310_GAZE_OMEGA * v_err) * p_dt;
+    float v_decay = expf(-G_R310_GAZE_OMEGA * p_dt);
+    *p_pos = p_target + (v_err + v_tmp) * v_decay;
+    *p_vel = (*p_vel - G_R310_GAZE_OMEGA * v_tmp) * v_decay;
+}
+
+// G_R310_GAZE_REFRESH_MS 주기로 스프링을 진행하고 픽셀 오프셋을 갱신합니다.
+// @return 픽셀 오프셋이 바뀌어 다시 출력해야 하면 true
+bool R310_gaze_step(T_R310_Gaze_t* p_gaze, uint32_t p_now) {
+    uint32_t v_elapsed = p_now - p_gaze->lastStepTime;
+    if (v_elapsed < G_R310_GAZE_REFRESH_MS) return false;
+    p_gaze->lastStepTime = p_now;
+
+    float v_dt = v_elapsed / 1000.0f;
+    if (v_dt > G_R310_GAZE_MAX_DT_S) v_dt = G_R310_GAZE_MAX_DT_S;
+    R310_gaze_damp(&p_gaze->posX, &p_gaze->velX, p_gaze->targetX, v_dt);
+    R310_gaze_damp(&p_gaze->posY, &p_gaze->velY, p_gaze->targetY, v_dt);
+
+    int8_t v_offsetX = (int8_t)lroundf(p_gaze->posX * G_R310_GAZE_MAX_PX);
+    int8_t v_offsetY = (int8_t)lroundf(p_gaze->posY * G_R310_GAZE_MAX_PX);
+    if (v_offsetX == p_gaze->offsetX && v_offsetY == p_gaze->offsetY) return false;
+    p_gaze->offsetX = v_offsetX;
+    p_gaze->offsetY = v_offsetY;
+    return true;
+}
+
+
+// 행에서 가장 왼쪽 켜진 픽셀부터 가장 오른쪽 켜진 픽셀까지 채운 구간 (분기 없는 비트 연산)
+template <typename T>
+T G_R310_HOT_CODE R310_gaze_rowSpan(T p_row) {
+    T v_fill = p_row;
+    for (uint8_t v_shift = 1; v_shift < sizeof(T) * 8; v_shift <<= 1) v_fill |= (T)(v_fill >> v_shift); // 최상위 비트 아래 모두 채움
+    T v_lowest = (T)(p_row & (T)(~p_row + 1));
+    return (T)(v_fill & (T)~(T)(v_lowest - 1));
+}
+
+// 한 눈의 눈동자를 (p_dx, p_dy) 만큼 옮깁니다.
+// 눈동자 = 행 구간 안쪽의 빈 픽셀이며, 빈 자리는 채우고 옮긴 위치를 비웁니다. 2bpp 글리프 눈은 건너뜁니다.
+template <uint8_t W, uint8_t H>
+void G_R310_HOT_CODE R310_gaze_applyEye(T_R310_EyeFrameBufWH_t<W, H>* p_fb, T_R310_EyeSide_Idx_t p_eyeSideIdx, int8_t p_dx, int8_t p_dy) {
+    typedef typename T_R310_EyeFrameBufWH_t<W, H>::row_t row_t;
+    row_t v_span[H];
+    row_t v_hole[H];
+    row_t v_hiAny = 0;
+
+    for (uint8_t v_row = 0; v_row < H; v_row++) {
+        row_t v_bits   = p_fb->rows[p_eyeSideIdx][v_row];
+        v_span[v_row]  = R310_gaze_rowSpan(v_bits);
+        v_hole[v_row]  = (row_t)(v_span[v_row] & ~v_bits);
+        v_hiAny       |= p_fb->rowsHi[p_eyeSideIdx][v_row];
+    }
+    if (v_hiAny) return; // 팔레트 글리프는 눈동자가 별도 색이므로 제외
+
+    for (int8_t v_row = 0; v_row < (int8_t)H; v_row++) {
+        int8_t v_src   = (int8_t)(v_row - p_dy);
+        row_t  v_moved = 0;
+        if (v_src >= 0 && v_src < (int8_t)H) {
+            v_moved = (p_dx >= 0) ? (row_t)(v_hole[v_src] >> p_dx) : (row_t)(v_hole[v_src] << -p_dx);
+        }
+        p_fb->rows[p_eyeSideIdx][v_row] = (row_t)(v_span[v_row] & ~v_moved);
+    }
+}
+
+// 두 눈에 시선 오프셋을 적용합니다. (오프셋이 0이면 변경 없음)
+template <uint8_t W, uint8_t H>
+void G_R310_HOT_CODE R310_gaze_apply(T_R310_EyeFrameBufWH_t<W, H>* p_fb, const T_R310_Gaze_t* p_gaze) {
+    if (!p_gaze->isEnabled || (p_gaze->offsetX == 0 && p_gaze->offsetY == 0)) return;
+    R310_gaze_applyEye(p_fb, EYE_RIGHT, p_gaze->offsetX, p_gaze->offsetY);
+    R310_gaze_applyEye(p_fb, EYE_LEFT, p_gaze->offsetX, p_gaze->offsetY);
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+// R310_glyph_001.h - 글리프 크기(가로 W x 세로 H) 템플릿 타입
+// 폰트 글리프, 프레임버퍼 행 비트 형식, 8x8 -> WxW 확대를 글리프 크기에 대해 템플릿으로 정의합니다.
+// 패널 크기는 G_R310_PANEL_SIZE 하나로 정해지고, 그리기 커널은 크기마다 따로 인스턴스화되어
+// 루프 횟수가 모두 컴파일 타임 상수가 되므로 컴파일러가 완전히 전개합니다.
+
+#include "R310_config_009.h"
+
+// 한 행의 픽셀 비트 형식 (MSB = 열 0)
+template <uint8_t W> struct T_R310_RowBits_t;
+template <> struct T_R310_RowBits_t<8>  { typedef uint8_t  type; };
+template <> struct T_R310_RowBits_t<16> { typedef uint16_t type; };
+template <> struct T_R310_RowBits_t<32> { typedef uint32_t type; };
+
+// 폰트 글리프 (행 우선, 행당 W/8 바이트, 각 행의 첫 바이트 MSB = 열 0)
+template <uint8_t W, uint8_t H>
+struct T_R310_Glyph_t {
+    static_assert(W % 8 == 0, "글리프 너비는 8의 배수여야 합니다");
+    static constexpr uint8_t ROW_BYTES = W / 8;
+
+    uint8_t width;                  // 글리프 너비 (W)
+    uint8_t data[ROW_BYTES * H];    // 픽셀 데이터
+};
+
+
+// PROGMEM 글리프의 한 행을 행 비트 형식으로 읽습니다.
+template <uint8_t W, uint8_t H>
+typename T_R310_RowBits_t<W>::type R310_glyph_readRow(const T_R310_Glyph_t<W, H>* p_glyph, uint8_t p_row) {
+    typedef typename T_R310_RowBits_t<W>::type row_t;
+    const uint8_t* v_rowData = &p_glyph->data[p_row * (W / 8)];
+    row_t          v_bits    = 0;
+    for (uint8_t v_byte = 0; v_byte < W / 8; v_byte++) {
+        v_bits = (row_t)((v_bits << 8) | pgm_read_byte(&v_rowData[v_byte]));
+    }
+    return v_bits;
+}
+
+
+// 8열 행 바이트 -> 16열 행 (각 열을 2배로 늘림) 테이블
+typedef struct {
+    uint16_t bits[256];
+} T_R310_DoubleTable_t;
+
+constexpr T_R310_DoubleTable_t R310_glyph_buildDoubleTable() {
+    T_R310_DoubleTable_t v_table{};
+    for (uint16_t v_i = 0; v_i < 256; v_i++) {
+        uint16_t v_bits = 0;
+        for (uint8_t v_col = 0; v_col < 8; v_col++) {
+            if (v_i & (0x80 >> v_col)) v_bits |= (uint16_t)(0xC000 >> (v_col * 2));
+        }
+        v_table.bits[v_i] = v_bits;
+    }
+    return v_table;
+}
+
+constexpr T_R310_DoubleTable_t G_R310_HOT_DATA g_R310_glyph_doubleTable = R310_glyph_buildDoubleTable();
+
+// 행 비트 좌우 반전 테이블 (열 n <-> 열 7-n)
+typedef struct {
+    uint8_t bits[256];
+} T_R310_ReverseTable_t;
+
+constexpr T_R310_ReverseTable_t R310_glyph_buildReverseTable() {
+    T_R310_ReverseTable_t v_table{};
+    for (uint16_t v_i = 0; v_i < 256; v_i++) {
+        uint8_t v_bits = 0;
+        for (uint8_t v_col = 0; v_col < 8; v_col++) {
+            if (v_i & (0x80 >> v_col)) v_bits |= (uint8_t)(0x01 << v_col);
+        }
+        v_table.bits[v_i] = v_bits;
+    }
+    return v_table;
+}
+
+constexpr T_R310_ReverseTable_t G_R310_HOT_DATA g_R310_glyph_reverseTable = R310_glyph_buildReverseTable();
+
+// 한 행을 좌우 반전합니다. (행 비트 형식별 오버로드)
+uint8_t  G_R310_HOT_CODE R310_glyph_reverseRow(uint8_t p_row)  { return g_R310_glyph_reverseTable.bits[p_row]; }
+uint16_t G_R310_HOT_CODE R310_glyph_reverseRow(uint16_t p_row) { return (uint16_t)((g_R310_glyph_reverseTable.bits[p_row & 0xFF] << 8) | g_R310_glyph_reverseTable.bits[p_row >> 8]); }
+
+
+// 8x8 원본 행(2bpp 글리프 등)을 W 열 패널 행으로 확대합니다. (세로는 p_row * 8 / H 행을 사용)
+template <uint8_t W> struct T_R310_RowScale_t;
+template <> struct T_R310_RowScale_t<8> {
+    static constexpr uint8_t FACTOR = 1;
+    static uint8_t fromRow8(uint8_t p_row8) { return p_row8; }
+};
+template <> struct T_R310_RowScale_t<16> {
+    static constexpr uint8_t FACTOR = 2;
+    static uint16_t fromRow8(uint8_t p_row8) { return g_R310_glyph_doubleTable.bits[p_row8]; }
+};
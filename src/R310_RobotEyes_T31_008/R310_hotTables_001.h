@@ -0,0 +1,85 @@
+#pragma once
+
+// R310_hotTables_001.h - 렌더링 경로 핫 테이블의 DRAM 사본
+// ESP32 에서 PROGMEM 테이블과 일반 코드는 플래시 캐시를 거쳐 읽힙니다. LittleFS 쓰기(설정 저장) 중에는 캐시가 꺼지고,
+// 쓰기 직후에는 캐시가 비어 있어 처음 닿는 테이블/코드마다 플래시를 다시 읽으므로 깜빡임 프레임이 늦어집니다.
+// init 시점에 현재 패널 크기의 글리프(압축 해제 상태)와 감정 시퀀스 테이블/프레임을 DRAM 으로 복사해 두고,
+// 그리기 경로는 이 사본을 읽습니다. (LUT 는 G_R310_HOT_DATA, 프레임 렌더러는 G_R310_HOT_CODE 로 배치, R310_config_009.h)
+// 복사 전(isReady == false)이거나 다른 패널 크기의 글리프는 기존 PROGMEM 경로로 읽습니다.
+
+#include "R310_config_009.h"
+#include "R310_data2_014.h"
+#include "R310_fontPack_001.h"
+#include "R310_glyph_001.h"
+
+// 감정 조회 테이블 항목 수 / 전체 시퀀스 프레임 수 (DRAM 프레임 풀 크기)
+constexpr uint8_t G_R310_ANI_TABLE_LEN = EMT_COUNT;
+
+constexpr uint16_t R310_hot_countFrames() {
+    uint16_t v_total = 0;
+    for (uint8_t v_i = 0; v_i < G_R310_ANI_TABLE_LEN; v_i++) v_total += g_R310_ani_Lookup.entry[v_i].seqSize;
+    return v_total;
+}
+
+constexpr uint16_t G_R310_ANI_FRAME_TOTAL = R310_hot_countFrames();
+
+// DRAM 사본
+typedef struct {
+    T_R310_RowBits_t<G_R310_EYE_COL_SIZE>::type glyphs[G_R310_ROBOT_EYES_FONT_LEN][G_R310_DISPLAY_HEIGHT];   // 현재 패널 크기 글리프 (압축 해제)
+    T_R310_ani_Table_t      aniTables[G_R310_ANI_TABLE_LEN];    // 감정별 조회 테이블 (seq 는 frames 풀을 가리킴)
+    T_R310_ani_Frame_t      frames[G_R310_ANI_FRAME_TOTAL];     // 모든 시퀀스 프레임 (테이블 순서대로 연속 배치)
+    bool                    isReady;                            // 사본 유효 여부
+} T_R310_HotTables_t;
+
+T_R310_HotTables_t g_R310_hot;
+
+
+// 핫 테이블을 DRAM 으로 복사합니다. (R310_init 에서 1회, 약 0.7KB(8x8) / 1.3KB(16x16))
+// @param p_font 현재 패널 크기의 압축 폰트
+void R310_hot_init(const T_R310_PackedFont_t<G_R310_EYE_COL_SIZE, G_R310_DISPLAY_HEIGHT>* p_font) {
+    for (uint8_t v_i = 0; v_i < G_R310_ROBOT_EYES_FONT_LEN; v_i++) {
+        R310_font_unpack(p_font, v_i, g_R310_hot.glyphs[v_i]);
+    }
+
+    uint16_t v_pos = 0;
+    for (uint8_t v_i = 0; v_i < G_R310_ANI_TABLE_LEN; v_i++) {
+        memcpy_P(&g_R310_hot.aniTables[v_i], &g_R310_ani_Lookup.entry[v_i], sizeof(T_R310_ani_Table_t));
+        if (g_R310_hot.aniTables[v_i].seq == nullptr) continue; // 절차적 시퀀스 감정 / EMT_NONE
+        memcpy_P(&g_R310_hot.frames[v_pos], g_R310_hot.aniTables[v_i].seq, g_R310_hot.aniTables[v_i].seqSize * sizeof(T_R310_ani_Frame_t));
+        g_R310_hot.aniTables[v_i].seq = &g_R310_hot.frames[v_pos];
+        v_pos += g_R310_hot.aniTables[v_i].seqSize;
+    }
+    g_R310_hot.isReady = true;
+}
+
+// 글리프 하나를 DRAM 사본에서 행 배열로 복사합니다.
+// @return 사본에서 읽었으면 true, 사본이 없거나 다른 패널 크기이면 false (호출자가 PROGMEM 에서 풀기)
+template <uint8_t W, uint8_t H>
+bool G_R310_HOT_CODE R310_hot_loadGlyph(uint8_t p_fontIdx, typename T_R310_RowBits_t<W>::type* p_rows) {
+    if constexpr (W != G_R310_EYE_COL_SIZE || H != G_R310_DISPLAY_HEIGHT) {
+        return false;
+    } else {
+        if (!g_R310_hot.isReady) return false;
+        memcpy(p_rows, g_R310_hot.glyphs[p_fontIdx], sizeof(g_R310_hot.glyphs[0]));
+        return true;
+    }
+}
+
+// 감정의 조회 테이블 항목을 읽습니다. (사본이 있으면 DRAM, 없으면 PROGMEM)
+// @param p_emotionIdx 감정 인덱스 (EMT_COUNT 미만, 글리프 시퀀스가 없으면 seq == nullptr)
+void G_R310_HOT_CODE R310_hot_readAniTable(T_R310_emotion_idx_t p_emotionIdx, T_R310_ani_Table_t* p_table) {
+    if (g_R310_hot.isReady) {
+        *p_table = g_R310_hot.aniTables[p_emotionIdx];
+    } else {
+        memcpy_P(p_table, &g_R310_ani_Lookup.entry[p_emotionIdx], sizeof(T_R310_ani_Table_t));
+    }
+}
+
+// 시퀀스 프레임 하나를 읽습니다. 프레임이 DRAM 풀 안에 있으면 바로 복사하고, 아니면(PROGMEM 시퀀스) memcpy_P 로 읽습니다.
+void G_R310_HOT_CODE R310_hot_readAniFrame(const T_R310_ani_Frame_t* p_frame, T_R310_ani_Frame_t* p_out) {
+    if (p_frame >= &g_R310_hot.frames[0] && p_frame < &g_R310_hot.frames[G_R310_ANI_FRAME_TOTAL]) {
+        *p_out = *p_frame;
+    } else {
+        memcpy_P(p_out, p_frame, sizeof(T_R310_ani_Frame_t));
+    }
+}
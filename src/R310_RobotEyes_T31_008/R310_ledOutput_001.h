@@ -0,0 +1,244 @@
+#pragma once
+
+// R310_ledOutput_001.h - 더블 버퍼 비블로킹 LED 출력 단계
+// 렌더링은 백 버퍼(g_R310_leds)에서 하고, R310_ledOut_present()는 백 버퍼를 프런트 버퍼로 복사한 뒤
+// 전송 태스크에 알리고 바로 돌아옵니다. 전송 태스크(코어 0)가 FastLED.show()로 프런트 버퍼를 내보내는 동안
+// 메인 루프는 다음 프레임을 그릴 수 있습니다. 전송 완료는 펜스(R310_ledOut_isBusy / R310_ledOut_waitIdle)와
+// 완료 콜백으로 알 수 있습니다.
+//
+// 백엔드
+//   ESP32    : FreeRTOS 태스크 + 바이너리 세마포어 펜스 (FastLED RMT 드라이버가 실제 전송)
+//   호스트   : std::thread 가 WS2812 전송 시간을 흉내 내고 프레임/타이밍을 기록 (Linux 에서 겹침 측정용)
+//   그 외    : 동기 FastLED.show() (기존 동작)
+
+#include "R310_config_009.h"
+
+#if defined(ARDUINO_ARCH_ESP32)
+    #define G_R310_LEDOUT_BACKEND_ESP32
+    #include <freertos/FreeRTOS.h>
+    #include <freertos/task.h>
+    #include <freertos/semphr.h>
+#elif !defined(ARDUINO)
+    #define G_R310_LEDOUT_BACKEND_HOST
+    #include <thread>
+    #include <mutex>
+    #include <condition_variable>
+    #include <chrono>
+    #include <vector>
+#endif
+
+#define G_R310_LEDOUT_TASK_CORE         0       // 전송 태스크 코어 (Arduino loop 는 코어 1)
+#define G_R310_LEDOUT_TASK_PRIORITY     2       // 전송 태스크 우선순위
+#define G_R310_LEDOUT_TASK_STACK        2048    // 전송 태스크 스택 크기 (바이트)
+#define G_R310_LEDOUT_WIRE_US_PER_PIXEL 30      // WS2812 픽셀당 전송 시간 (24비트 x 1.25us, 호스트 흉내용)
+#define G_R310_LEDOUT_RESET_US          50      // WS2812 리셋(래치) 시간 (호스트 흉내용)
+
+// 전송 완료 콜백 (전송 태스크 컨텍스트에서 호출되므로 짧게 유지)
+typedef void (*T_R310_LedOutDoneCb_t)(uint32_t p_frameNo);
+
+// 출력 단계 통계
+typedef struct {
+    uint32_t    framesPresented;    // present() 호출 수
+    uint32_t    framesCompleted;    // 전송 완료 프레임 수
+    uint32_t    lastTransferUs;     // 마지막 전송 소요 시간 (마이크로초)
+    uint32_t    maxFenceWaitUs;     // present() 가 이전 전송 완료를 기다린 최대 시간
+    uint32_t    totalFenceWaitUs;   // present() 가 기다린 누적 시간
+} T_R310_LedOutStats_t;
+
+#ifdef G_R310_LEDOUT_BACKEND_HOST
+// 호스트 기록 항목 (프레임 내용 + 타이밍, 시간은 init 기준 마이크로초)
+typedef struct {
+    uint32_t    frameNo;
+    uint32_t    presentUs;          // present() 호출 시각
+    uint32_t    startUs;            // 전송 시작 시각
+    uint32_t    endUs;              // 전송 완료 시각
+    CRGB        pixels[G_R310_LEDOUT_NUM_LEDS];
+} T_R310_LedOutRecord_t;
+#endif
+
+// 출력 단계 상태
+typedef struct {
+    CRGB                    front[G_R310_LEDOUT_NUM_LEDS];      // 전송 중인 프런트 버퍼 (FastLED 컨트롤러에 등록, 체인 전체)
+    uint8_t                 brightness;                         // 프런트 버퍼 전송 밝기 (전원 예산 제한 후, show(scale) 로 전달)
+    volatile bool           isBusy;                             // 전송 진행 중 여부
+    volatile uint32_t       frameNo;                            // 마지막으로 제출한 프레임 번호
+    T_R310_LedOutDoneCb_t   onDone;                             // 전송 완료 콜백 (nullptr 가능)
+    T_R310_LedOutStats_t    stats;
+#if defined(G_R310_LEDOUT_BACKEND_ESP32)
+    TaskHandle_t            task;                               // 전송 태스크
+    SemaphoreHandle_t       doneSem;                            // 펜스: 전송 완료 시 give
+#elif defined(G_R310_LEDOUT_BACKEND_HOST)
+    std::thread*                        worker;                 // 전송 흉내 스레드
+    std::mutex*                         lock;
+    std::condition_variable*            cond;
+    bool                                pending;                // 제출되었으나 전송 시작 전
+    std::chrono::steady_clock::time_point epoch;                // 시간 기준점
+    std::vector<T_R310_LedOutRecord_t>* records;                // 기록된 프레임
+#endif
+} T_R310_LedOut_t;
+
+T_R310_LedOut_t g_R310_ledOut;
+
+
+#if defined(G_R310_LEDOUT_BACKEND_HOST)
+uint32_t R310_ledOut_nowUs() {
+    return (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - g_R310_ledOut.epoch).count();
+}
+#else
+uint32_t G_R310_HOT_CODE R310_ledOut_nowUs() {
+    return micros();
+}
+#endif
+
+// 전송 완료 처리 (전송 태스크/스레드에서 호출)
+void R310_ledOut_finish(uint32_t p_startUs) {
+    g_R310_ledOut.stats.lastTransferUs = R310_ledOut_nowUs() - p_startUs;
+    g_R310_ledOut.stats.framesCompleted++;
+    g_R310_ledOut.isBusy = false;
+    if (g_R310_ledOut.onDone != nullptr) g_R310_ledOut.onDone(g_R310_ledOut.frameNo);
+}
+
+#if defined(G_R310_LEDOUT_BACKEND_ESP32)
+// 전송 태스크: present() 알림마다 프런트 버퍼를 FastLED.show() 로 내보내고 펜스를 엽니다.
+void R310_ledOut_task(void* p_arg) {
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        uint32_t v_startUs = R310_ledOut_nowUs();
+        FastLED.show(g_R310_ledOut.brightness); // 전역 밝기를 바꾸지 않고 프레임별 밝기로 전송
+        R310_ledOut_finish(v_startUs);
+        xSemaphoreGive(g_R310_ledOut.doneSem);
+    }
+}
+#elif defined(G_R310_LEDOUT_BACKEND_HOST)
+// 호스트 전송 흉내 스레드: WS2812 전송 시간만큼 대기하며 프레임과 타이밍을 기록합니다.
+void R310_ledOut_hostWorker() {
+    std::unique_lock<std::mutex> v_guard(*g_R310_ledOut.lock);
+    for (;;) {
+        g_R310_ledOut.cond->wait(v_guard, [] { return g_R310_ledOut.pending; });
+        g_R310_ledOut.pending = false;
+
+        size_t   v_recIdx  = g_R310_ledOut.records->size() - 1; // present() 가 추가한 항목 (전송 중에는 추가되지 않음)
+        uint32_t v_startUs = R310_ledOut_nowUs();
+        (*g_R310_ledOut.records)[v_recIdx].startUs = v_startUs;
+        memcpy((*g_R310_ledOut.records)[v_recIdx].pixels, g_R310_ledOut.front, sizeof(g_R310_ledOut.front));
+
+        v_guard.unlock();
+        std::this_thread::sleep_for(std::chrono::microseconds(G_R310_LEDOUT_NUM_LEDS * G_R310_LEDOUT_WIRE_US_PER_PIXEL + G_R310_LEDOUT_RESET_US));
+        v_guard.lock();
+
+        (*g_R310_ledOut.records)[v_recIdx].endUs = R310_ledOut_nowUs();
+        R310_ledOut_finish(v_startUs);
+        g_R310_ledOut.cond->notify_all();
+    }
+}
+#endif
+
+
+// 출력 단계 초기화: 프런트 버퍼를 FastLED 에 등록하고 전송 태스크를 시작합니다.
+void R310_ledOut_init(T_R310_LedOutDoneCb_t p_onDone) {
+    memset(g_R310_ledOut.front, 0, sizeof(g_R310_ledOut.front));
+    memset(&g_R310_ledOut.stats, 0, sizeof(g_R310_ledOut.stats));
+    g_R310_ledOut.brightness = 0;
+    g_R310_ledOut.isBusy  = false;
+    g_R310_ledOut.frameNo = 0;
+    g_R310_ledOut.onDone  = p_onDone;
+
+    FastLED.addLeds<G_R310_LED_TYPE, G_R310_NEOPIXEL_PIN, G_R310_COLOR_ORDER>(g_R310_ledOut.front, G_R310_LEDOUT_NUM_LEDS).setCorrection(TypicalLEDStrip);
+
+#if defined(G_R310_LEDOUT_BACKEND_ESP32)
+    g_R310_ledOut.doneSem = xSemaphoreCreateBinary();
+    xSemaphoreGive(g_R310_ledOut.doneSem); // 처음에는 펜스 열림
+    xTaskCreatePinnedToCore(R310_ledOut_task, "R310_ledOut", G_R310_LEDOUT_TASK_STACK, nullptr, G_R310_LEDOUT_TASK_PRIORITY, &g_R310_ledOut.task, G_R310_LEDOUT_TASK_CORE);
+#elif defined(G_R310_LEDOUT_BACKEND_HOST)
+    g_R310_ledOut.epoch   = std::chrono::steady_clock::now();
+    g_R310_ledOut.pending = false;
+    g_R310_ledOut.lock    = new std::mutex();
+    g_R310_ledOut.cond    = new std::condition_variable();
+    g_R310_ledOut.records = new std::vector<T_R310_LedOutRecord_t>();
+    g_R310_ledOut.worker  = new std::thread(R310_ledOut_hostWorker);
+    g_R310_ledOut.worker->detach();
+#endif
+}
+
+// 전송 진행 중 여부 (펜스 조회, 블로킹 없음)
+bool R310_ledOut_isBusy() {
+    return g_R310_ledOut.isBusy;
+}
+
+// 진행 중인 전송이 끝날 때까지 기다립니다. (펜스 대기)
+// @return 대기한 시간 (마이크로초)
+uint32_t R310_ledOut_waitIdle() {
+    uint32_t v_startUs = R310_ledOut_nowUs();
+#if defined(G_R310_LEDOUT_BACKEND_ESP32)
+    xSemaphoreTake(g_R310_ledOut.doneSem, portMAX_DELAY);
+    xSemaphoreGive(g_R310_ledOut.doneSem);
+#elif defined(G_R310_LEDOUT_BACKEND_HOST)
+    std::unique_lock<std::mutex> v_guard(*g_R310_ledOut.lock);
+    g_R310_ledOut.cond->wait(v_guard, [] { return !g_R310_ledOut.isBusy; });
+#endif
+    return R310_ledOut_nowUs() - v_startUs;
+}
+
+// 백 버퍼를 출력 단계에 제출합니다. 이전 전송이 끝나지 않았으면 그때까지만 기다리고,
+// 프런트 버퍼로 복사한 뒤 바로 돌아옵니다. (전송은 백그라운드에서 진행)
+// @param p_back 렌더링이 끝난 백 버퍼 (체인 전체, G_R310_LEDOUT_NUM_LEDS 픽셀)
+// @param p_brightness 이 프레임의 전송 밝기 (0-255, 프런트 버퍼와 함께 보관)
+void G_R310_HOT_CODE R310_ledOut_present(const CRGB* p_back, uint8_t p_brightness) {
+    uint32_t v_waitStartUs = R310_ledOut_nowUs();
+
+#if defined(G_R310_LEDOUT_BACKEND_ESP32)
+    xSemaphoreTake(g_R310_ledOut.doneSem, portMAX_DELAY); // 펜스 대기 후 닫기 (전송 완료 시 태스크가 give)
+#elif defined(G_R310_LEDOUT_BACKEND_HOST)
+    std::unique_lock<std::mutex> v_guard(*g_R310_ledOut.lock);
+    g_R310_ledOut.cond->wait(v_guard, [] { return !g_R310_ledOut.isBusy; });
+#endif
+
+    uint32_t v_waitUs = R310_ledOut_nowUs() - v_waitStartUs;
+    g_R310_ledOut.stats.totalFenceWaitUs += v_waitUs;
+    if (v_waitUs > g_R310_ledOut.stats.maxFenceWaitUs) g_R310_ledOut.stats.maxFenceWaitUs = v_waitUs;
+    g_R310_ledOut.stats.framesPresented++;
+
+    memcpy(g_R310_ledOut.front, p_back, sizeof(g_R310_ledOut.front));
+    g_R310_ledOut.brightness = p_brightness;
+    g_R310_ledOut.frameNo++;
+    g_R310_ledOut.isBusy = true;
+
+#if defined(G_R310_LEDOUT_BACKEND_ESP32)
+    xTaskNotifyGive(g_R310_ledOut.task);
+#elif defined(G_R310_LEDOUT_BACKEND_HOST)
+    T_R310_LedOutRecord_t v_rec;
+    memset(&v_rec, 0, sizeof(v_rec));
+    v_rec.frameNo   = g_R310_ledOut.frameNo;
+    v_rec.presentUs = R310_ledOut_nowUs();
+    g_R310_ledOut.records->push_back(v_rec);
+    g_R310_ledOut.pending = true;
+    v_guard.unlock();
+    g_R310_ledOut.cond->notify_all();
+#else
+    uint32_t v_startUs = R310_ledOut_nowUs();
+    FastLED.show(p_brightness);
+    R310_ledOut_finish(v_startUs);
+#endif
+}
+
+// 출력 단계 통계 출력
+void R310_ledOut_printStats() {
+    Serial.printf("R310 ledOut: presented %lu, completed %lu, last transfer %lu us, fence wait max %lu us / total %lu us\n",
+                  (unsigned long)g_R310_ledOut.stats.framesPresented, (unsigned long)g_R310_ledOut.stats.framesCompleted,
+                  (unsigned long)g_R310_ledOut.stats.lastTransferUs, (unsigned long)g_R310_ledOut.stats.maxFenceWaitUs,
+                  (unsigned long)g_R310_ledOut.stats.totalFenceWaitUs);
+}
+
+#ifdef G_R310_LEDOUT_BACKEND_HOST
+// 호스트 기록을 CSV 로 출력합니다. (frameNo, present, start, end, 첫 픽셀 RGB)
+// present -> start 는 제출 지연, start -> end 는 전송 시간이며, 그동안 호출자가 다음 프레임을 그린 시간이 겹침입니다.
+void R310_ledOut_hostDumpCsv(FILE* p_out) {
+    R310_ledOut_waitIdle();
+    std::lock_guard<std::mutex> v_guard(*g_R310_ledOut.lock);
+    fprintf(p_out, "frame,present_us,start_us,end_us,r0,g0,b0\n");
+    for (const T_R310_LedOutRecord_t& v_rec : *g_R310_ledOut.records) {
+        fprintf(p_out, "%u,%u,%u,%u,%u,%u,%u\n", (unsigned)v_rec.frameNo, (unsigned)v_rec.presentUs, (unsigned)v_rec.startUs,
+                (unsigned)v_rec.endUs, v_rec.pixels[0].r, v_rec.pixels[0].g, v_rec.pixels[0].b);
+    }
+}
+#endif
@@ -0,0 +1,110 @@
+#pragma once
+
+// R310_link_001.h - 호스트(PC) 바이너리 프레임 메시지 (A02_serialMux_001.h 프레임 채널, 호스트 도구: shared/R310_serialLink.py)
+// 115200 보드 텍스트 명령 대신 COBS + CRC16 프레임으로 명령, 화면 프레임, 글리프, 상태 보고를 주고받습니다.
+//   G_A02_FRAME_TYPE_LINE (0x01)  호스트 -> 기기  텍스트 명령 한 줄 ("smile", "1:angry", "set ..." 등, 에코 없음)
+//   LINK_MSG_FRAME        (0x10)  호스트 -> 기기  원격 표시 프레임: [눈 한 쌍 인덱스] + [눈(0: 오른쪽, 1: 왼쪽)][행][열] 순서 RGB
+//                                                 받는 동안 애니메이션을 멈추고 그대로 출력, G_R310_REMOTE_TIMEOUT_MS 동안 없으면 복귀
+//   LINK_MSG_GLYPH        (0x11)  호스트 -> 기기  글리프 교체: [폰트 인덱스] + [행별 비트 (패널 너비 8: 1바이트, 16: 2바이트 LE)]
+//                                                 DRAM 핫 테이블(R310_hotTables_001.h)만 바꾸므로 재부팅하면 내장 글리프로 돌아감
+//   LINK_MSG_TELEMETRY    (0x12)  호스트 -> 기기  상태 요청: [눈 한 쌍 인덱스] (+ [주기 ms u16 LE], 0 이면 주기 보고 끔)
+//                                 기기 -> 호스트  상태 보고: T_R310_Link_Telemetry_t
+//
+// 원격 표시 프레임은 체인 배선과 무관한 논리 좌표 순서로 받아 픽셀 LUT(g_R310_pixelLut)로 흩뿌립니다.
+// 다중 바이트 값은 모두 리틀 엔디언입니다. (ESP32 메모리 순서 그대로)
+
+#include "R310_config_009.h"
+#include "R310_pixelMap_001.h"
+
+#define G_R310_REMOTE_TIMEOUT_MS        1000    // 원격 표시 프레임이 이 시간 동안 없으면 애니메이션으로 복귀 (밀리초)
+#define G_R310_LINK_TELEMETRY_MIN_MS    20      // 주기 상태 보고 최소 주기 (밀리초)
+
+// 호스트 메시지 type (A02_serialMux_registerFrames 범위)
+typedef enum {
+    LINK_MSG_FRAME      = 0x10,
+    LINK_MSG_GLYPH      = 0x11,
+    LINK_MSG_TELEMETRY  = 0x12,
+    LINK_MSG_FIRST      = LINK_MSG_FRAME,
+    LINK_MSG_LAST       = LINK_MSG_TELEMETRY
+} T_R310_Link_Msg_t;
+
+// 원격 표시 프레임 페이로드 길이 (눈 한 쌍 인덱스 + 픽셀)
+#define G_R310_LINK_FRAME_LEN           (1 + G_R310_NEOPIXEL_NUM_LEDS * 3)
+
+// 받는 프레임 버퍼를 원격 표시 프레임(+ type/seq/CRC 4바이트)에 맞춤 (A02_serialMux_001.h 가 먼저 포함되었으면 R310_main_015.h 의 static_assert 로 확인)
+#ifndef G_A02_SERIALMUX_FRAME_MAX
+    #define G_A02_SERIALMUX_FRAME_MAX   (G_R310_LINK_FRAME_LEN + 4)
+#endif
+
+// 상태 보고 (기기 -> 호스트, 호스트 도구의 struct 형식과 같은 순서)
+typedef struct __attribute__((packed)) {
+    uint32_t    uptimeMs;           // millis()
+    uint8_t     eyesIdx;            // 눈 한 쌍 인덱스
+    uint8_t     robotState;         // T_R310_RobotState_t
+    uint8_t     emotionIdx;         // 현재 표시 중인 감정 (T_R310_emotion_idx_t)
+    uint8_t     isRemote;           // 원격 표시 중 여부
+    uint8_t     brightness;         // 전원 제한 후 밝기
+    uint8_t     pendingCmds;        // 재생 대기열 요청 수
+    uint32_t    framesSent;         // 출력한 프레임 수
+    uint32_t    framesSkipped;      // 변경 없음으로 생략한 프레임 수
+    uint32_t    remoteFrames;       // 받은 원격 표시 프레임 수
+    uint32_t    rxBytes;            // 멀티플렉서 읽은 바이트
+    uint32_t    rxFramesOk;         // CRC 가 맞은 프레임 수
+    uint32_t    rxFramesBad;        // COBS/CRC 오류 프레임 수
+    uint32_t    rxSeqGaps;          // 빠진 프레임 수
+    uint32_t    rxDropsOverlong;    // 길이 초과로 버린 줄/프레임 수
+    uint32_t    linkErrors;         // 형식(길이/인덱스)이 맞지 않아 버린 메시지 수
+} T_R310_Link_Telemetry_t;
+
+// 원격 표시 상태 (인스턴스별)
+typedef struct {
+    bool        isActive;           // 원격 표시 중 (애니메이션 상태 머신 정지)
+    uint32_t    lastFrameTime;      // 마지막 원격 표시 프레임 시간 (millis)
+    uint32_t    frames;             // 받은 원격 표시 프레임 수
+} T_R310_Remote_t;
+
+// 링크 상태 (인스턴스 공통)
+typedef struct {
+    uint16_t    telemetryPeriodMs;  // 주기 상태 보고 주기 (0: 끔)
+    uint8_t     telemetryEyesIdx;   // 주기 상태 보고 대상 인스턴스
+    uint32_t    telemetryTime;      // 다음 주기 상태 보고 시간 (millis)
+    uint32_t    errors;             // 형식이 맞지 않아 버린 메시지 수
+} T_R310_Link_t;
+
+T_R310_Link_t g_R310_link;
+
+
+// 원격 표시 프레임 픽셀(논리 좌표 순서 RGB)을 인스턴스 LED 구간에 흩뿌리고, 전원 제한용 행 합을 구합니다.
+// @param p_rgb G_R310_NEOPIXEL_NUM_LEDS * 3 바이트
+// @param p_rowSums G_R310_POWER_ROWS 개 (LED 순서 G_R310_EYE_COL_SIZE 픽셀 단위 채널 합)
+void R310_link_scatterFrame(const uint8_t* p_rgb, CRGB* p_leds, uint16_t* p_rowSums) {
+    for (uint8_t v_eye = 0; v_eye < 2; v_eye++) {
+        for (uint8_t v_row = 0; v_row < G_R310_DISPLAY_HEIGHT; v_row++) {
+            const uint16_t* v_rowLut = g_R310_pixelLut.idx[v_eye][v_row];
+            for (uint8_t v_col = 0; v_col < G_R310_EYE_COL_SIZE; v_col++, p_rgb += 3) {
+                p_leds[v_rowLut[v_col]] = CRGB(p_rgb[0], p_rgb[1], p_rgb[2]);
+            }
+        }
+    }
+    const uint8_t* v_bytes = (const uint8_t*)p_leds;
+    for (uint16_t v_row = 0; v_row < 2 * G_R310_DISPLAY_HEIGHT; v_row++) {
+        uint16_t v_sum = 0;
+        for (uint16_t v_i = 0; v_i < G_R310_EYE_COL_SIZE * 3; v_i++) v_sum += *v_bytes++;
+        p_rowSums[v_row] = v_sum;
+    }
+}
+
+// 상태 요청을 해석합니다. (주기 보고 설정)
+// @return 올바른 요청이면 true
+bool R310_link_parseTelemetryReq(const uint8_t* p_payload, uint16_t p_len, uint8_t p_eyesCount, uint8_t* p_eyesIdx) {
+    if (p_len < 1 || p_payload[0] >= p_eyesCount) return false;
+    *p_eyesIdx = p_payload[0];
+    if (p_len >= 3) {
+        uint16_t v_period = (uint16_t)(p_payload[1] | (p_payload[2] << 8));
+        if (v_period != 0 && v_period < G_R310_LINK_TELEMETRY_MIN_MS) v_period = G_R310_LINK_TELEMETRY_MIN_MS;
+        g_R310_link.telemetryPeriodMs = v_period;
+        g_R310_link.telemetryEyesIdx  = p_payload[0];
+        g_R310_link.telemetryTime     = millis() + v_period;
+    }
+    return true;
+}
@@ -6,6 +6,7 @@
 // 이 파일은 필요한 데이터 및 타입 헤더 파일을 포함하고 main.cpp에서 사용됩니다.
 
 //#define R310_DEB
+//#define R310_BENCH        // 렌더링 벤치마크 (R310_bench_001.h) 활성화
 #define R310_PROGRESS_1
 
 
@@ -13,12 +14,40 @@
 #include "R310_config_009.h"
 // 정적 데이터 테이블 헤더 파일 포함
 #include "R310_data2_014.h"
+// 패널 지오메트리 및 컴파일 타임 픽셀 인덱스 LUT
+#include "R310_pixelMap_001.h"
+// 1bpp 눈 프레임버퍼
+#include "R310_frameBuf_001.h"
+// 애니메이션 프레임 간 크로스페이드
+#include "R310_crossfade_001.h"
+// 파라미터 기반 절차적 눈 래스터라이저
+#include "R310_procEye_001.h"
+// ASCII 텍스트 마퀴
+#include "R310_text_001.h"
+// 더블 버퍼 비블로킹 LED 출력
+#include "R310_ledOutput_001.h"
 
-// StreamUtils.h 포함 (필요시)
-#ifdef G_R310_BUFFEREDSERIAL_USE
-    #include <StreamUtils.h>
-    ReadBufferingStream g_R310_BufferedSerial{Serial, 64};
-#endif
+#include "R310_power_001.h"
+// 차량 움직임 기반 시선 오버레이
+#include "R310_gaze_001.h"
+// 다중 트랙 타임라인 (눈꺼풀/눈동자 오버레이)
+#include "R310_timeline_001.h"
+// 마감 시간 기반 루프 대기
+#include "R310_sched_001.h"
+// 외부 바이너리 클립 뱅크 (파티션/LittleFS)
+#include "R310_clip_001.h"
+// 애니메이션 요청 큐 (다른 태스크/코어에서 무잠금으로 넣기)
+#include "R310_cmdQueue_001.h"
+// 시리얼 명령 완전 해시 분기 + 인자 토큰 분리
+#include "R310_cmdDispatch_001.h"
+// 호스트 바이너리 프레임 메시지 (원격 표시, 글리프 교체, 상태 보고)
+#include "R310_link_001.h"
+// 리셋/딥슬립 후 이어서 재생하는 RTC 메모리 스냅샷
+#include "R310_snapshot_001.h"
+// 모듈 공용 비블로킹 시리얼 멀티플렉서 (M010 설정 명령과 한 포트를 나눠 씀)
+#include "../M010_CarState_001/A02_serialMux_001.h"
+
+static_assert(G_A02_SERIALMUX_FRAME_MAX >= G_R310_LINK_FRAME_LEN + G_A03_FRAME_OVERHEAD, "시리얼 멀티플렉서 프레임 버퍼가 원격 표시 프레임보다 작습니다 (R310_link_001.h 를 먼저 포함)");
 
 
 // --- 새로운 구조체 정의 (R310_config_009.h 또는 이 파일 상단에 위치) ---
@@ -32,14 +61,23 @@ typedef struct {
     EMTP_Ply_AutoReverse_t  autoReverse;        // 시퀀스 완료 후 자동 역방향 재생 여부
     T_R310_emotion_idx_t    emotionIdx_next;        // 다음에 재생할 애니메이션 감정 종류
     T_R310_emotion_idx_t    emotionIdx_current;     // 현재 화면에 표시되는 애니메이션 감정 종류
+    const T_R310_proc_Keyframe_t* procSeq;      // 절차적 키프레임 시퀀스 (글리프 시퀀스이면 nullptr)
+    int8_t                  clipSlot;           // 재생 중인 외부 클립 슬롯 (R310_clip_001.h, -1: 내장 시퀀스)
+    int8_t                  clipNext;           // 다음 R310_loadSequence 에서 재생할 클립 슬롯 ("clip <이름>", -1: 감정으로 조회)
+    uint16_t                speedQ8;            // 재생 중인 시퀀스 속도 배율 (Q8.8, 프레임 유지 시간을 나눔)
+    uint16_t                speedNext;          // 다음 R310_loadSequence 에서 적용할 속도 배율 ("smile speed 2")
+    T_R310_ani_Frame_t      thisFrame;          // 현재 표시 중인 프레임
+    uint32_t                timeOfLastFrame;    // 현재 프레임 표시 시작 시간 (밀리초)
+    T_R310_proc_Keyframe_t  procFrom;           // 절차적 시퀀스: 현재 키프레임
+    T_R310_proc_Keyframe_t  procTo;             // 절차적 시퀀스: 다음 키프레임 (보간 목표)
+    uint32_t                procLastStep;       // 절차적 시퀀스: 마지막 보간 갱신 시간
 } T_R310_AnimationControl_t;
 
-// 로봇 상태 및 타이밍 구조체
+// 로봇 상태 및 타이밍 구조체 (마지막 활동 시간은 배치의 activityTime[] 에서 관리)
 typedef struct {
     T_R310_RobotState_t robotState;             // 현재 로봇 상태
     uint32_t            lastAnimationTime;      // 마지막 애니메이션/활동 시작 시간 (자동 깜빡임 타이머 기준)
     uint16_t            blinkMinimumTime;       // 자동 깜빡임 최소 대기 시간 (밀리초)
-    unsigned long       lastActivityTime;       // 로봇 상태 관리를 위한 마지막 활동 시간 기록
 } T_R310_StatusAndTiming_t;
 
 // 텍스트 표시 구조체
@@ -49,386 +87,1203 @@ typedef struct {
 } T_R310_TextDisplay_t;
 
 
+// 화면 출력 상태 구조체 (변경 없는 프레임의 출력 생략용)
+typedef struct {
+    T_R310_EyeFrameBuf_t    lastFb;             // 마지막으로 출력한 1bpp 프레임
+    T_R310_Palette_t        lastPalette;        // 마지막 출력 팔레트
+    uint8_t                 lastBrightness;     // 마지막 출력 밝기
+    bool                    isValid;            // last* 값 유효 여부 (false면 다음 프레임은 무조건 출력)
+    uint32_t                framesSent;         // 실제로 출력 단계에 제출한 프레임 수
+    uint32_t                framesSkipped;      // 변경 없음으로 건너뛴 프레임 수
+} T_R310_ShowState_t;
+
+// 출력 바인딩 (체인 백 버퍼 g_R310_leds 에서 이 인스턴스가 쓰는 구간)
+typedef struct {
+    CRGB*                   leds;               // 구간 시작 (G_R310_NEOPIXEL_NUM_LEDS 픽셀, g_R310_pixelLut 인덱스 기준)
+    uint16_t                ledOffset;          // 체인 내 시작 픽셀
+    bool                    isDirty;            // 구간이 바뀌어 다음 배치 출력에 포함해야 함
+} T_R310_EyesOutput_t;
+
+// 로봇 눈 엔진 인스턴스 (눈 한 쌍: 시퀀스 상태 + 프레임버퍼 + 출력 바인딩)
+typedef struct {
+    T_R310_AnimationControl_t   aniControl;     // 애니메이션 제어 관련 변수
+    T_R310_StatusAndTiming_t    robotStatus;    // 로봇 상태 및 타이밍 관련 변수
+    T_R310_TextDisplay_t        textDisplay;    // 텍스트 표시 관련 변수
+    T_R310_TextScroll_t         textScroll;     // 텍스트 마퀴 스크롤 상태
+    T_R310_ShowState_t          showState;      // 화면 출력 상태 및 통계
+    T_R310_Crossfade_t          crossfade;      // 프레임 간 크로스페이드 상태
+    T_R310_EyeFrameBuf_t        eyeFb;          // 1bpp 눈 프레임버퍼 (애니메이션이 합성하는 기본 프레임)
+    T_R310_EyeFrameBuf_t        outFb;          // 출력 프레임버퍼 (eyeFb + 시선/타임라인 오버레이, show 직전에 output.leds 로 확장)
+    T_R310_Gaze_t               gaze;           // 시선 오버레이 상태 (M010 이 R310_setGazeTarget 으로 목표 시선 입력)
+    T_R310_Timeline_t           timeline;       // 오버레이 트랙 (눈꺼풀/눈동자, 기본 표정은 aniControl)
+    T_R310_CmdQueue_t           cmdQueue;       // 애니메이션 요청 큐 (R310_batch_tick 에서 비우고, IDLE 이 되면 대기열 재생)
+    T_R310_Power_t              power;          // LED 전류 예산 제한기 (행 단위 채널 합, 눈 한 쌍 기준 예산)
+    T_R310_Palette_t            palette;        // 현재 감정의 팔레트 (R310_loadSequence 에서 갱신)
+    T_R310_Remote_t             remote;         // 호스트 원격 표시 상태 (R310_link_001.h)
+    T_R310_EyesOutput_t         output;         // 출력 바인딩
+} T_R310_Eyes_t;
+
+#define G_R310_BATCH_IDLE_MS        60000       // 정지한 시선처럼 예정된 이벤트가 없는 타이머의 재확인 주기 (밀리초)
+
+// 인스턴스 배치 (틱마다 검사하는 타이머는 인스턴스별 배열로 모아 두고, 때가 된 인스턴스만 상태를 읽습니다)
+typedef struct {
+    uint8_t         count;                              // 등록된 인스턴스 수
+    T_R310_Eyes_t*  eyes[G_R310_EYES_COUNT];            // 인스턴스
+    uint32_t        wakeTime[G_R310_EYES_COUNT];        // 애니메이션 상태 머신을 다음에 돌릴 시간 (millis)
+    uint32_t        gazeTime[G_R310_EYES_COUNT];        // 다음 시선 갱신 시간 (millis)
+    uint32_t        activityTime[G_R310_EYES_COUNT];    // 마지막 활동(명령) 시간 (잠들기 판정 기준)
+} T_R310_EyesBatch_t;
+
+
 // --- 글로벌 변수 정의 (g_R310_ 로 시작) ---
 
-CRGB                        g_R310_leds[G_R310_NEOPIXEL_NUM_LEDS];          // FastLED CRGB 배열
+CRGB                        g_R310_leds[G_R310_LEDOUT_NUM_LEDS];            // 렌더링 백 버퍼 (인스턴스별 구간을 체인 순서로 이어 붙임, R310_ledOut_present 로 출력)
 CRGB*                       g_R310_ledsPtr			    = nullptr;	        // CRGB 배열 포인터
-
-T_R310_AnimationControl_t   g_R310_aniControl;      // 애니메이션 제어 관련 변수
-T_R310_StatusAndTiming_t    g_R310_robotStatus;     // 로봇 상태 및 타이밍 관련 변수
-T_R310_TextDisplay_t        g_R310_textDisplay;     // 텍스트 표시 관련 변수
+T_R310_Eyes_t               g_R310_eyes[G_R310_EYES_COUNT];                 // 눈 인스턴스 (0: 기본 눈 한 쌍)
+T_R310_EyesBatch_t          g_R310_batch;                                   // 인스턴스 배치 (틱/출력)
 
 // ====================================================================================================
 // 함수 선언 (프로토타입) - 파라미터 타입명도 변경된 열거형/구조체 명칭에 맞게 수정
 // ====================================================================================================
 
 uint16_t R310_mapEyePixel(T_R310_EyeSide_Idx_t p_eyeSideIdx, uint8_t p_row, uint8_t p_col);
-void     R310_drawEye(T_R310_EyeSide_Idx_t p_eyeSideIdx, uint8_t p_eyeFontIdx) ;
-void     R310_drawEyes(uint8_t p_eyeFontIdxRight, uint8_t p_eyeFontIdxLeft);
-uint8_t  R310_loadSequence(T_R310_emotion_idx_t p_eyeEmotionIdx);
-void     R310_loadFrame(T_R310_ani_Frame_t* p_animFrame) ;
+void     R310_drawEye(T_R310_Eyes_t* p_eyes, T_R310_EyeSide_Idx_t p_eyeSideIdx, uint8_t p_eyeFontIdx, uint8_t p_transform = G_R310_TF_NONE) ;
+void     R310_composeEyes(T_R310_Eyes_t* p_eyes, uint8_t p_eyeFontIdxRight, uint8_t p_eyeFontIdxLeft, uint8_t p_transformRight = G_R310_TF_NONE, uint8_t p_transformLeft = G_R310_TF_NONE);
+void     R310_drawEyes(T_R310_Eyes_t* p_eyes, uint8_t p_eyeFontIdxRight, uint8_t p_eyeFontIdxLeft, uint8_t p_transformRight = G_R310_TF_NONE, uint8_t p_transformLeft = G_R310_TF_NONE);
+void     R310_drawEyesProc(T_R310_Eyes_t* p_eyes, const T_R310_proc_Keyframe_t* p_from, const T_R310_proc_Keyframe_t* p_to, fract8 p_amount);
+void     R310_composeOutput(T_R310_Eyes_t* p_eyes);
+bool     R310_showFrame(T_R310_Eyes_t* p_eyes, const T_R310_Palette_t* p_palette);
+void     R310_stepGaze(T_R310_Eyes_t* p_eyes);
+void     R310_refreshOverlay(T_R310_Eyes_t* p_eyes);
+void     R310_setGazeTarget(float p_yawRate_degps, float p_pitch_deg);
+void     R310_beginCrossfade(T_R310_Eyes_t* p_eyes, uint16_t p_duration);
+bool     R310_stepCrossfade(T_R310_Eyes_t* p_eyes);
+void     R310_invalidateFrame(T_R310_Eyes_t* p_eyes);
+void     R310_printFrameStats(T_R310_Eyes_t* p_eyes);
+uint8_t  R310_loadSequence(T_R310_Eyes_t* p_eyes, T_R310_emotion_idx_t p_eyeEmotionIdx);
+void     R310_loadFrame(T_R310_Eyes_t* p_eyes, T_R310_ani_Frame_t* p_animFrame) ;
 
-void     R310_clearText();
-void     R310_showText(bool p_bInit);
+void     R310_clearText(T_R310_Eyes_t* p_eyes);
+void     R310_showText(T_R310_Eyes_t* p_eyes, bool p_bInit);
 
-void     R310_setAnimation(T_R310_emotion_idx_t p_emotionIdx, EMTP_Ply_AutoReverse_t p_autoReverse, EMTP_Ply_Direct_t p_playDirection, EMTP_Ply_Force_t p_forcePlay);
-void     R310_setRobotState(T_R310_RobotState_t p_robotState);
+void     R310_setAnimation(T_R310_Eyes_t* p_eyes, T_R310_emotion_idx_t p_emotionIdx, EMTP_Ply_AutoReverse_t p_autoReverse, EMTP_Ply_Direct_t p_playDirection, EMTP_Ply_Force_t p_forcePlay);
+void     R310_startCommand(T_R310_Eyes_t* p_eyes, const T_R310_AniCmd_t* p_cmd);
+void     R310_requestAnimation(T_R310_Eyes_t* p_eyes, T_R310_emotion_idx_t p_emotionIdx, EMTP_Ply_AutoReverse_t p_autoReverse, T_R310_CmdQ_Mode_t p_mode, const T_R310_CmdOpts_t* p_opts, int8_t p_clipSlot = -1);
+void     R310_playOverlay(T_R310_Eyes_t* p_eyes, T_R310_tl_Track_Idx_t p_track, const T_R310_tl_Key_t* p_keys, uint8_t p_keyCount, const T_R310_CmdOpts_t* p_opts);
+bool     R310_postAnimation(uint8_t p_eyesIdx, T_R310_emotion_idx_t p_emotionIdx, EMTP_Ply_AutoReverse_t p_autoReverse, T_R310_CmdQ_Mode_t p_mode = CMDQ_APPEND);
+void     R310_setRobotState(T_R310_Eyes_t* p_eyes, T_R310_RobotState_t p_robotState);
+void     R310_applyCommand(T_R310_Eyes_t* p_eyes, const char* p_command);
 void     R310_processCommand(const char* p_command);
+void     R310_handleSerialLine(const char* p_line);
+void     R310_handleLinkFrame(uint8_t p_type, const uint8_t* p_payload, uint16_t p_len);
+void     R310_sendTelemetry(uint8_t p_eyesIdx);
 
-bool     R310_runAnimation(void);
+uint16_t R310_runAnimation(T_R310_Eyes_t* p_eyes);
+void     R310_eyes_init(T_R310_Eyes_t* p_eyes, CRGB* p_leds, uint16_t p_ledOffset);
+void     R310_batch_init(T_R310_EyesBatch_t* p_batch);
+uint8_t  R310_batch_add(T_R310_EyesBatch_t* p_batch, T_R310_Eyes_t* p_eyes);
+void     R310_batch_wake(T_R310_EyesBatch_t* p_batch, uint8_t p_slot, bool p_isActivity);
+bool     R310_batch_tick(T_R310_EyesBatch_t* p_batch, uint32_t p_now);
+uint32_t R310_batch_nextDue(const T_R310_EyesBatch_t* p_batch, uint32_t p_now);
+void     R310_batch_present(T_R310_EyesBatch_t* p_batch);
+void     R310_snap_save(uint32_t p_now);
+bool     R310_snap_restore();
 void     R310_init() ;
 void     R310_run() ;
 
+#ifdef R310_BENCH
+    #include "R310_bench_001.h"
+#endif
+
 // ====================================================================================================
 // 함수 정의 (R310_ 로 시작) - 내부 로직에서 전역 변수 및 파라미터 사용 시 변경
 // ====================================================================================================
 
 
 // (눈 인덱스, 행, 열) 좌표를 FastLED CRGB 배열의 선형 픽셀 인덱스로 변환
+// 배선 순서/회전/시작 픽셀은 컴파일 타임 LUT(g_R310_pixelLut)에 반영되어 있으며, 범위 검사도 빌드 시점에 끝납니다.
 // @param p_eyeSide_idx 눈의 인덱스 (0: 오른쪽, 1: 왼쪽)
-// @param p_row 매트릭스 내 행 (0-7)
-// @param p_col 매트릭스 내 열 (0-7)
-// @return 해당 픽셀의 FastLED CRGB 배열 내 선형 인덱스. 범위 벗어날 시 0 반환.
-//T_R310_Eye_Idx
+// @param p_row 매트릭스 내 행 (0 ~ G_R310_DISPLAY_HEIGHT-1)
+// @param p_col 매트릭스 내 열 (0 ~ G_R310_EYE_COL_SIZE-1)
+// @return 해당 픽셀의 FastLED CRGB 배열 내 선형 인덱스.
 uint16_t R310_mapEyePixel(T_R310_EyeSide_Idx_t p_eyeSide_idx, uint8_t p_row, uint8_t p_col) {
-    uint16_t v_base_pixel = (p_eyeSide_idx == EYE_RIGHT) ? G_R310_RIGHT_EYE_START_PIXEL : G_R310_LEFT_EYE_START_PIXEL;
-    uint16_t v_pixel_index;
+    return g_R310_pixelLut.idx[p_eyeSide_idx][p_row][p_col];
+}
 
-    // 행 우선 지그재그(serpentine) 방식 가정
-    if (p_row % 2 == 0) {
-        v_pixel_index = v_base_pixel + (p_row * 8) + p_col;
-    } else {
-        v_pixel_index = v_base_pixel + (p_row * 8) + (7 - p_col);
+// R310_drawEye 함수 - 폰트 글리프를 1bpp 눈 프레임버퍼(p_eyes->eyeFb)에 행 단위로 합성
+// 인덱스에 G_R310_FONT_2BPP_FLAG 가 있으면 2bpp 팔레트 글리프로 그립니다. (글리프 변환은 1bpp 글리프에만 적용)
+// @param p_transform 글리프 변환 플래그 (G_R310_TF_*)
+void G_R310_HOT_CODE R310_drawEye(T_R310_Eyes_t* p_eyes, T_R310_EyeSide_Idx_t p_eyeSideIdx, uint8_t p_eyeFontIdx, uint8_t p_transform) {
+    if (p_eyeFontIdx & G_R310_FONT_2BPP_FLAG) {
+        uint8_t v_glyph2bppIdx = p_eyeFontIdx & ~G_R310_FONT_2BPP_FLAG;
+        if (v_glyph2bppIdx >= G_R310_ROBOT_EYES_FONT2BPP_LEN) {
+            Serial.print("Error: Invalid 2bpp Eye Font index: ");
+            Serial.println(v_glyph2bppIdx);
+            return;
+        }
+        R310_fb_orGlyph2bpp(&p_eyes->eyeFb, p_eyeSideIdx, v_glyph2bppIdx);
+        return;
+    }
+    if (p_eyeFontIdx >= G_R310_ROBOT_EYES_FONT_LEN) {
+        Serial.print("Error: Invalid Eye Font index: ");
+        Serial.println(p_eyeFontIdx);
+        return;
     }
+    R310_fb_orGlyphTf(&p_eyes->eyeFb, p_eyeSideIdx, p_eyeFontIdx, p_transform);
+}
+
+
+// 오른쪽 눈(R)과 왼쪽 눈(L)에 사용할 폰트 문자 인덱스를 받아 1bpp 프레임버퍼에 합성만 합니다. (출력하지 않음)
+// @param p_eye_font_idx_Right 오른쪽 눈에 사용할 폰트 문자 인덱스.
+// @param p_eye_font_idx_Left 왼쪽 눈에 사용할 폰트 문자 인덱스.
+// @param p_transformRight, p_transformLeft 눈별 글리프 변환 플래그 (G_R310_TF_*)
+void G_R310_HOT_CODE R310_composeEyes(T_R310_Eyes_t* p_eyes, uint8_t p_eye_font_idx_Right, uint8_t p_eye_font_idx_Left, uint8_t p_transformRight, uint8_t p_transformLeft) {
+    R310_fb_clear(&p_eyes->eyeFb); // 1bpp 프레임버퍼 초기화
+
+    R310_drawEye(p_eyes, EYE_RIGHT, p_eye_font_idx_Right, p_transformRight); // 오른쪽 눈 그리기
+    R310_drawEye(p_eyes, EYE_LEFT, p_eye_font_idx_Left, p_transformLeft);    // 왼쪽 눈 그리기
+}
 
-    // 픽셀 인덱스 범위 확인
-    if (v_pixel_index >= G_R310_NEOPIXEL_NUM_LEDS) {
-        Serial.print("Error: Mapped pixel index out of bounds: ");
-        Serial.println(v_pixel_index);
-        return 0;
+// 두 눈을 프레임버퍼에 합성한 뒤 CRGB 버퍼로 확장하여 LED에 표시합니다.
+// @param p_eye_font_idx_Right 오른쪽 눈에 사용할 폰트 문자 인덱스.
+// @param p_eye_font_idx_Left 왼쪽 눈에 사용할 폰트 문자 인덱스.
+// @param p_transformRight, p_transformLeft 눈별 글리프 변환 플래그 (G_R310_TF_*)
+void G_R310_HOT_CODE R310_drawEyes(T_R310_Eyes_t* p_eyes, uint8_t p_eye_font_idx_Right, uint8_t p_eye_font_idx_Left, uint8_t p_transformRight, uint8_t p_transformLeft) {
+    R310_composeEyes(p_eyes, p_eye_font_idx_Right, p_eye_font_idx_Left, p_transformRight, p_transformLeft);
+
+    R310_showFrame(p_eyes, &p_eyes->palette); // 직전 프레임과 다를 때만 LED에 표시
+}
+
+// 두 키프레임 사이를 p_amount 비율로 보간한 파라미터로 두 눈을 그려 표시합니다.
+// @param p_from 현재 키프레임
+// @param p_to 다음 키프레임
+// @param p_amount 보간 비율 (0: p_from ~ 255: p_to)
+void R310_drawEyesProc(T_R310_Eyes_t* p_eyes, const T_R310_proc_Keyframe_t* p_from, const T_R310_proc_Keyframe_t* p_to, fract8 p_amount) {
+    R310_fb_clear(&p_eyes->eyeFb);
+
+    for (uint8_t v_eye = EYE_RIGHT; v_eye <= EYE_LEFT; v_eye++) {
+        T_R310_EyeParam_t v_param;
+        R310_proc_lerpParam(&p_from->eye[v_eye], &p_to->eye[v_eye], p_amount, &v_param);
+        R310_proc_drawEye(&p_eyes->eyeFb, (T_R310_EyeSide_Idx_t)v_eye, &v_param);
     }
 
-    return v_pixel_index;
+    R310_showFrame(p_eyes, &p_eyes->palette); // 보간 결과가 직전과 같은 픽셀이면 출력 생략
 }
 
-// R310_drawEye 함수
-void R310_drawEye(T_R310_EyeSide_Idx_t p_eyeSideIdx, uint8_t p_eyeFontIdx) {
-    if (p_eyeFontIdx >= G_R310_ARRAY_SIZE(g_R310_RobotEyes_Font_arr)) { // 변경된 배열명
-        Serial.print("Error: Invalid Eye Font index: ");
-        Serial.println(p_eyeFontIdx);
+// 기본 프레임(p_eyes->eyeFb)에 오버레이를 합성하여 출력 프레임(p_eyes->outFb)을 만듭니다.
+// 시선과 타임라인 트랙(눈동자/눈꺼풀)은 R310_tl_compose 한 번에 합성하며, 텍스트 표시 중에는 적용하지 않습니다.
+void G_R310_HOT_CODE R310_composeOutput(T_R310_Eyes_t* p_eyes) {
+    p_eyes->outFb = p_eyes->eyeFb;
+    if (p_eyes->aniControl.anyPly_State != ANI_PLY_STATE_TEXT) R310_tl_compose(&p_eyes->outFb, &p_eyes->timeline, &p_eyes->gaze);
+}
+
+// 눈 프레임버퍼를 인스턴스의 백 버퍼 구간(p_eyes->output.leds)으로 확장하고 다음 배치 출력에 포함되도록 표시합니다.
+// 프레임 내용, 팔레트, 밝기가 직전 출력과 모두 같으면 확장을 생략합니다.
+// 전송 밝기는 바뀐 행만 반영한 채널 합으로 전원 예산 안에서 정합니다. (R310_power_001.h, R310_batch_present 에서 적용)
+// @param p_palette 출력 팔레트
+// @return 실제로 출력했으면 true, 변경 없음으로 생략했으면 false
+bool G_R310_HOT_CODE R310_showFrame(T_R310_Eyes_t* p_eyes, const T_R310_Palette_t* p_palette) {
+    uint8_t v_brightness = p_eyes->power.userBrightness; // 제한 후 밝기는 내용과 사용자 밝기로 정해지므로 비교는 사용자 밝기로 충분
+
+    p_eyes->crossfade.isActive = false; // 즉시 출력이 진행 중인 크로스페이드보다 우선
+
+    R310_composeOutput(p_eyes);
+    if (p_eyes->showState.isValid &&
+        p_eyes->showState.lastBrightness == v_brightness &&
+        memcmp(&p_eyes->showState.lastPalette, p_palette, sizeof(T_R310_Palette_t)) == 0 &&
+        memcmp(&p_eyes->showState.lastFb, &p_eyes->outFb, sizeof(T_R310_EyeFrameBuf_t)) == 0) {
+        p_eyes->showState.framesSkipped++;
+        return false;
+    }
+
+    R310_fb_expand(&p_eyes->outFb, p_eyes->output.leds, p_palette); // 꺼진 픽셀까지 모두 기록하므로 FastLED.clear() 불필요
+    R310_pwr_updateFromFb(&p_eyes->power, &p_eyes->outFb, p_palette); // 바뀐 행만 채널 합 갱신
+    p_eyes->output.isDirty = true; // 틱 끝에서 R310_batch_present 가 한 번에 전송
+
+    p_eyes->showState.lastFb         = p_eyes->outFb;
+    p_eyes->showState.lastPalette    = *p_palette;
+    p_eyes->showState.lastBrightness = v_brightness;
+    p_eyes->showState.isValid        = true;
+    p_eyes->showState.framesSent++;
+    return true;
+}
+
+// 현재 화면(p_eyes->output.leds)에서 프레임버퍼(p_eyes->eyeFb) 내용으로 p_duration 동안 크로스페이드를 시작합니다.
+// 이후 R310_stepCrossfade()를 주기적으로 호출해야 하며, 전환할 내용이 없으면 즉시 출력 경로로 넘깁니다.
+// @param p_duration 전환 시간 (밀리초, 보통 프레임의 timeFrame)
+void R310_beginCrossfade(T_R310_Eyes_t* p_eyes, uint16_t p_duration) {
+    memcpy(p_eyes->crossfade.from, p_eyes->output.leds, sizeof(p_eyes->crossfade.from)); // 중간 프레임이어도 실제 화면 기준
+    R310_composeOutput(p_eyes);
+    R310_fb_expand(&p_eyes->outFb, p_eyes->crossfade.to, &p_eyes->palette);
+
+    if (p_duration == 0 || memcmp(p_eyes->crossfade.from, p_eyes->crossfade.to, sizeof(p_eyes->crossfade.from)) == 0) {
+        R310_showFrame(p_eyes, &p_eyes->palette);
         return;
     }
-    T_R310_FontChar_t v_fontChar; // 변경된 구조체명
-    memcpy_P(&v_fontChar, &g_R310_RobotEyes_Font_arr[p_eyeFontIdx], sizeof(T_R310_FontChar_t)); // 변경된 배열명, 구조체명
 
-    for (uint8_t v_row = 0; v_row < G_R310_DISPLAY_HEIGHT; v_row++) {
-        uint8_t v_rowByte = pgm_read_byte(&v_fontChar.data[v_row]);
-        for (uint8_t v_col = 0; v_col < G_R310_EYE_COL_SIZE; v_col++) {
-            if ((v_rowByte >> (7 - v_col)) & 0x01) {
-                uint16_t v_pixelIdx = R310_mapEyePixel(p_eyeSideIdx, v_row, v_col);
-                g_R310_leds[v_pixelIdx] = G_R310_EYE_COLOR;
-            }
-        }
+    p_eyes->crossfade.isActive     = true;
+    p_eyes->crossfade.startTime    = millis();
+    p_eyes->crossfade.lastStepTime = p_eyes->crossfade.startTime;
+    p_eyes->crossfade.duration     = p_duration;
+    p_eyes->showState.isValid      = false; // 전환 중에는 p_eyes->output.leds 가 중간 프레임
+}
+
+// 크로스페이드를 G_R310_CROSSFADE_REFRESH_MS 주기로 한 단계 진행합니다.
+// 전환 시간이 끝나면 목표 프레임을 정확히 출력하고 출력 상태(p_eyes->showState)를 갱신합니다.
+// @return 크로스페이드가 없거나 완료되었으면 true
+bool G_R310_HOT_CODE R310_stepCrossfade(T_R310_Eyes_t* p_eyes) {
+    if (!p_eyes->crossfade.isActive) return true;
+
+    uint32_t v_now    = millis();
+    fract8   v_amount = R310_xf_amount(&p_eyes->crossfade, v_now);
+
+    if (v_amount == 255) {
+        R310_showFrame(p_eyes, &p_eyes->palette); // isActive 해제 및 목표 프레임 출력
+        return true;
     }
+    if ((v_now - p_eyes->crossfade.lastStepTime) < G_R310_CROSSFADE_REFRESH_MS) return false;
+    p_eyes->crossfade.lastStepTime = v_now;
+
+    uint16_t v_rowSums[G_R310_POWER_ROWS];
+    R310_xf_blendRows(p_eyes->crossfade.from, p_eyes->crossfade.to, p_eyes->output.leds, G_R310_NEOPIXEL_NUM_LEDS, v_amount, v_rowSums);
+    R310_pwr_updateFromRows(&p_eyes->power, v_rowSums);
+    p_eyes->output.isDirty = true;
+    p_eyes->showState.framesSent++;
+    return false;
 }
 
+// 시선 스프링을 진행하고, 눈동자 픽셀 위치가 바뀌었으면 현재 프레임을 다시 출력합니다. (시퀀스 진행과 무관)
+// 크로스페이드 중에는 목표 프레임에 이미 시선이 반영되어 있으므로 전환이 끝난 뒤 반영합니다.
+void R310_stepGaze(T_R310_Eyes_t* p_eyes) {
+    if (!R310_gaze_step(&p_eyes->gaze, millis())) return;
+    if (p_eyes->crossfade.isActive || p_eyes->aniControl.anyPly_State == ANI_PLY_STATE_TEXT) return;
+    R310_showFrame(p_eyes, &p_eyes->palette);
+}
 
-// 오른쪽 눈(R)과 왼쪽 눈(L)에 사용할 폰트 문자 인덱스를 받아, 해당 눈 모양을 CRGB 버퍼에 그리고 FastLED.show()로 표시합니다.
-// @param p_eye_font_idx_Right 오른쪽 눈에 사용할 폰트 문자 인덱스.
-// @param p_eye_font_idx_Left 왼쪽 눈에 사용할 폰트 문자 인덱스.
-void R310_drawEyes(uint8_t p_eye_font_idx_Right, uint8_t p_eye_font_idx_Left) {
-    FastLED.clear(); // 전체 LED 픽셀 버퍼를 검은색으로 초기화합니다.
+// 오버레이 트랙 값이 바뀐 뒤 기본 프레임은 그대로 두고 출력만 다시 합성합니다.
+// 크로스페이드 중에는 전환을 끊지 않고 목표 프레임에만 반영합니다.
+void R310_refreshOverlay(T_R310_Eyes_t* p_eyes) {
+    if (p_eyes->aniControl.anyPly_State == ANI_PLY_STATE_TEXT) return;
+    if (p_eyes->crossfade.isActive) {
+        R310_composeOutput(p_eyes);
+        R310_fb_expand(&p_eyes->outFb, p_eyes->crossfade.to, &p_eyes->palette);
+        return;
+    }
+    R310_showFrame(p_eyes, &p_eyes->palette);
+}
 
-    R310_drawEye(EYE_RIGHT, p_eye_font_idx_Right); // 오른쪽 눈 그리기
-    R310_drawEye(EYE_LEFT, p_eye_font_idx_Left);  // 왼쪽 눈 그리기
+// p_eyes->output.leds 를 프레임버퍼 외의 경로로 수정한 경우 호출하여 다음 프레임을 강제로 출력합니다.
+void R310_invalidateFrame(T_R310_Eyes_t* p_eyes) {
+    p_eyes->showState.isValid = false;
+}
 
-    FastLED.show(); // LED에 표시
+// 출력/생략 프레임 수 통계 출력
+void R310_printFrameStats(T_R310_Eyes_t* p_eyes) {
+    uint32_t v_total = p_eyes->showState.framesSent + p_eyes->showState.framesSkipped;
+    Serial.printf("R310 frames: sent %lu, skipped %lu (%.1f%% skipped)\n",
+                  (unsigned long)p_eyes->showState.framesSent, (unsigned long)p_eyes->showState.framesSkipped,
+                  v_total ? (100.0f * p_eyes->showState.framesSkipped / v_total) : 0.0f);
 }
 
 // R310_loadSequence 함수
-uint8_t R310_loadSequence(T_R310_emotion_idx_t p_eyeEmotionIdx) { // 변경된 열거형명
-    bool v_found = false;
-
-    for (uint8_t v_i = 0; v_i < G_R310_ARRAY_SIZE(g_R310_ani_Tables_arr); v_i++) { // 변경된 배열명
-        T_R310_ani_Table_t v_ani_Table; 
-        memcpy_P(&v_ani_Table, &g_R310_ani_Tables_arr[v_i], sizeof(T_R310_ani_Table_t)); // 변경된 배열명, 구조체명
-        if (v_ani_Table.emotionIdx == p_eyeEmotionIdx) { // 변경된 멤버명
-            g_R310_aniControl.currentAniTable = v_ani_Table; // 구조체 멤버 사용
+uint8_t R310_loadSequence(T_R310_Eyes_t* p_eyes, T_R310_emotion_idx_t p_eyeEmotionIdx) { // 변경된 열거형명
+    bool                v_found = false;
+    T_R310_proc_Table_t v_procTable;
+
+    p_eyes->aniControl.procSeq  = nullptr;
+    p_eyes->aniControl.clipSlot = (p_eyes->aniControl.clipNext >= 0) ? p_eyes->aniControl.clipNext : R310_clip_findByEmotion(p_eyeEmotionIdx);
+    p_eyes->aniControl.clipNext = -1;
+    p_eyes->aniControl.speedQ8   = p_eyes->aniControl.speedNext;
+    p_eyes->aniControl.speedNext = G_R310_TL_SPEED_1X;
+    if (p_eyes->aniControl.clipSlot >= 0) { // 외부 클립이 내장 시퀀스보다 우선 (프레임은 R310_loadFrame 에서 하나씩 읽음)
+        const T_R310_ClipIndex_t* v_clip = &g_R310_clipBank.index[p_eyes->aniControl.clipSlot];
+        p_eyes->aniControl.currentAniTable = {p_eyeEmotionIdx, nullptr, v_clip->frameCount,
+                                              (v_clip->flags & G_R310_CLIP_FLAG_CROSSFADE) ? EMTP_BLEND_CROSSFADE : EMTP_BLEND_OFF};
+        v_found = true;
+    }
+    if (!v_found && R310_proc_findSequence(p_eyeEmotionIdx, &v_procTable)) { // 절차적 키프레임 시퀀스 우선
+        p_eyes->aniControl.procSeq         = v_procTable.seq;
+        p_eyes->aniControl.currentAniTable = {v_procTable.emotionIdx, nullptr, v_procTable.seqSize, EMTP_BLEND_OFF};
+        v_found = true;
+    }
+
+    if (!v_found && p_eyeEmotionIdx < EMT_COUNT) {
+        T_R310_ani_Table_t v_ani_Table;
+        R310_hot_readAniTable(p_eyeEmotionIdx, &v_ani_Table); // 감정 인덱스로 바로 조회 (DRAM 사본, R310_hotTables_001.h)
+        if (v_ani_Table.seq != nullptr) {
+            p_eyes->aniControl.currentAniTable = v_ani_Table; // 구조체 멤버 사용
             v_found = true;
-            break;
         }
     }
     if (!v_found) {
         Serial.print("Warning: Animation sequence not found for emotion: ");
         Serial.println(p_eyeEmotionIdx);
-        g_R310_aniControl.currentAniTable = {EMT_NEUTRAL, g_R310_frameSeq_Blink, 1}; // 구조체 멤버 사용
+        p_eyes->aniControl.currentAniTable = {EMT_NEUTRAL, g_R310_frameSeq_Blink, 1, EMTP_BLEND_OFF}; // 구조체 멤버 사용
     }
 
-    if (g_R310_aniControl.playDirection == EMTP_PLY_DIR_LAST) // 구조체 멤버 사용
-        g_R310_aniControl.aniFrameIndex = g_R310_aniControl.currentAniTable.seqSize - 1; // 구조체 멤버 사용
+    R310_pal_loadEmotionPalette(p_eyes->aniControl.currentAniTable.emotionIdx, &p_eyes->palette); // 감정별 팔레트 적용
+
+    if (p_eyes->aniControl.playDirection == EMTP_PLY_DIR_LAST) // 구조체 멤버 사용
+        p_eyes->aniControl.aniFrameIndex = p_eyes->aniControl.currentAniTable.seqSize - 1; // 구조체 멤버 사용
     else
-        g_R310_aniControl.aniFrameIndex = 0; // 구조체 멤버 사용
+        p_eyes->aniControl.aniFrameIndex = 0; // 구조체 멤버 사용
 
-    return (g_R310_aniControl.currentAniTable.seqSize); // 구조체 멤버 사용
+    return (p_eyes->aniControl.currentAniTable.seqSize); // 구조체 멤버 사용
 }
 
 // R310_loadFrame 함수
-void R310_loadFrame(T_R310_ani_Frame_t* p_ani_Frame) { // 변경된 구조체명
-    if (g_R310_aniControl.aniFrameIndex >= 0 && g_R310_aniControl.aniFrameIndex < g_R310_aniControl.currentAniTable.seqSize) { // 구조체 멤버 사용
-        memcpy_P(p_ani_Frame, &g_R310_aniControl.currentAniTable.seq[g_R310_aniControl.aniFrameIndex], sizeof(T_R310_ani_Frame_t)); // 구조체 멤버 사용, 구조체명 변경
+void G_R310_HOT_CODE R310_loadFrame(T_R310_Eyes_t* p_eyes, T_R310_ani_Frame_t* p_ani_Frame) { // 변경된 구조체명
+    if (p_eyes->aniControl.aniFrameIndex >= 0 && p_eyes->aniControl.aniFrameIndex < p_eyes->aniControl.currentAniTable.seqSize) { // 구조체 멤버 사용
+        if (p_eyes->aniControl.clipSlot >= 0) {
+            R310_clip_readFrame(p_eyes->aniControl.clipSlot, p_eyes->aniControl.aniFrameIndex, p_ani_Frame); // 매핑 주소 또는 파일 레코드
+        } else {
+            R310_hot_readAniFrame(&p_eyes->aniControl.currentAniTable.seq[p_eyes->aniControl.aniFrameIndex], p_ani_Frame); // DRAM 사본 또는 PROGMEM
+        }
     } else {
         Serial.print("Error: Invalid animation index: ");
-        Serial.println(g_R310_aniControl.aniFrameIndex); // 구조체 멤버 사용
+        Serial.println(p_eyes->aniControl.aniFrameIndex); // 구조체 멤버 사용
         p_ani_Frame->eyeData[0] = 0;
         p_ani_Frame->eyeData[1] = 0;
+        p_ani_Frame->eyeTransform[0] = G_R310_TF_NONE;
+        p_ani_Frame->eyeTransform[1] = G_R310_TF_NONE;
         p_ani_Frame->timeFrame = G_R310_FRAME_TIME;
     }
 }
 
 // R310_setAnimation 함수
-void R310_setAnimation(T_R310_emotion_idx_t p_emotionIdx, EMTP_Ply_AutoReverse_t p_autoReverse, EMTP_Ply_Direct_t p_playDirection, EMTP_Ply_Force_t p_forcePlay) { // 변경된 열거형명
-    if (g_R310_textDisplay.pointer_buf != nullptr && g_R310_textDisplay.buffer[0] != '\0' && p_forcePlay == EMTP_FORCE_PLY_OFF) return; // 구조체 멤버 사용
+void R310_setAnimation(T_R310_Eyes_t* p_eyes, T_R310_emotion_idx_t p_emotionIdx, EMTP_Ply_AutoReverse_t p_autoReverse, EMTP_Ply_Direct_t p_playDirection, EMTP_Ply_Force_t p_forcePlay) { // 변경된 열거형명
+    if (p_eyes->textDisplay.pointer_buf != nullptr && p_eyes->textDisplay.buffer[0] != '\0' && p_forcePlay == EMTP_FORCE_PLY_OFF) return; // 구조체 멤버 사용
 
-    if (p_emotionIdx != g_R310_aniControl.emotionIdx_current || p_forcePlay == EMTP_FORCE_PLY_ON) { // 구조체 멤버 사용
-        g_R310_aniControl.emotionIdx_next          = p_emotionIdx;     // 구조체 멤버 사용
-        g_R310_aniControl.autoReverse          = p_autoReverse;    // 구조체 멤버 사용
-        g_R310_aniControl.playDirection        = p_playDirection;  // 구조체 멤버 사용
+    if (p_emotionIdx != p_eyes->aniControl.emotionIdx_current || p_forcePlay == EMTP_FORCE_PLY_ON) { // 구조체 멤버 사용
+        p_eyes->aniControl.emotionIdx_next          = p_emotionIdx;     // 구조체 멤버 사용
+        p_eyes->aniControl.autoReverse          = p_autoReverse;    // 구조체 멤버 사용
+        p_eyes->aniControl.playDirection        = p_playDirection;  // 구조체 멤버 사용
 
-        if (p_forcePlay == EMTP_FORCE_PLY_ON || g_R310_aniControl.anyPly_State == ANI_PLY_STATE_IDLE) { // 구조체 멤버 사용
-            g_R310_aniControl.anyPly_State = ANI_PLY_STATE_RESTART; // 구조체 멤버 사용
+        if (p_forcePlay == EMTP_FORCE_PLY_ON || p_eyes->aniControl.anyPly_State == ANI_PLY_STATE_IDLE) { // 구조체 멤버 사용
+            p_eyes->aniControl.anyPly_State = ANI_PLY_STATE_RESTART; // 구조체 멤버 사용
         }
     }
 }
 
+// 큐에서 꺼낸 요청을 재생합니다. (기본 트랙을 강제로 다시 시작)
+void R310_startCommand(T_R310_Eyes_t* p_eyes, const T_R310_AniCmd_t* p_cmd) {
+    p_eyes->aniControl.clipNext  = p_cmd->clipSlot;
+    p_eyes->aniControl.speedNext = p_cmd->speedQ8;
+    R310_setAnimation(p_eyes, (T_R310_emotion_idx_t)p_cmd->emotionIdx, (EMTP_Ply_AutoReverse_t)p_cmd->autoReverse, (EMTP_Ply_Direct_t)p_cmd->playDirection, EMTP_FORCE_PLY_ON);
+    R310_cmdq_noteStart(&p_eyes->cmdQueue, p_cmd);
+}
+
+// 시리얼 명령의 애니메이션 요청을 루프 태스크 링에 넣습니다. (다음 R310_batch_tick 에서 병합 방식에 따라 재생)
+// "x<N>" 반복은 첫 요청 뒤에 같은 요청을 대기열(APPEND)로 이어 붙입니다.
+// @param p_opts 반복 횟수/속도 배율 ("smile x2 speed 1.5")
+// @param p_clipSlot 이름으로 재생할 외부 클립 슬롯 (-1: 감정으로 조회)
+void R310_requestAnimation(T_R310_Eyes_t* p_eyes, T_R310_emotion_idx_t p_emotionIdx, EMTP_Ply_AutoReverse_t p_autoReverse, T_R310_CmdQ_Mode_t p_mode, const T_R310_CmdOpts_t* p_opts, int8_t p_clipSlot) {
+    if (p_mode == CMDQ_REPLACE) R310_clearText(p_eyes); // 바로 바꾸는 요청만 표시 중인 텍스트를 끊음 (대기 요청은 마퀴가 끝난 뒤)
+
+    T_R310_AniCmd_t v_cmd = { (uint8_t)p_emotionIdx, (uint8_t)p_autoReverse, (uint8_t)EMTP_PLY_DIR_FIRST, (uint8_t)p_mode, p_clipSlot, p_opts->speedQ8, 0 };
+    for (uint8_t v_i = 0; v_i < p_opts->repeat; v_i++) {
+        R310_cmdq_post(&p_eyes->cmdQueue, CMDQ_SRC_LOOP, &v_cmd);
+        v_cmd.mode = CMDQ_APPEND;
+    }
+}
+
+// 시리얼 명령의 오버레이 클립을 재생하고 바로 다시 합성합니다. (반복 횟수/속도 배율 적용)
+void R310_playOverlay(T_R310_Eyes_t* p_eyes, T_R310_tl_Track_Idx_t p_track, const T_R310_tl_Key_t* p_keys, uint8_t p_keyCount, const T_R310_CmdOpts_t* p_opts) {
+    R310_tl_play(&p_eyes->timeline, p_track, p_keys, p_keyCount, G_R310_TL_PRIO_COMMAND, millis(), p_opts->repeat, p_opts->speedQ8);
+    R310_refreshOverlay(p_eyes);
+}
+
+// 다른 태스크/코어에서 애니메이션을 요청합니다. (CMDQ_SRC_EXTERN 링, 이 링에 넣는 태스크는 하나여야 함)
+// 잠금 없이 링에 넣고 대기 중인 루프 태스크를 깨웁니다.
+// @return 넣었으면 true (인스턴스 번호가 잘못됐거나 링이 가득 차면 false)
+bool R310_postAnimation(uint8_t p_eyesIdx, T_R310_emotion_idx_t p_emotionIdx, EMTP_Ply_AutoReverse_t p_autoReverse, T_R310_CmdQ_Mode_t p_mode) {
+    if (p_eyesIdx >= G_R310_EYES_COUNT) return false;
+
+    T_R310_AniCmd_t v_cmd = { (uint8_t)p_emotionIdx, (uint8_t)p_autoReverse, (uint8_t)EMTP_PLY_DIR_FIRST, (uint8_t)p_mode, -1, G_R310_TL_SPEED_1X, 0 };
+    if (!R310_cmdq_post(&g_R310_eyes[p_eyesIdx].cmdQueue, CMDQ_SRC_EXTERN, &v_cmd)) return false;
+    R310_sched_notify();
+    return true;
+}
+
 // R310_setRobotState 함수
-void R310_setRobotState(T_R310_RobotState_t p_robotState) { // 변경된 열거형명
-    if (p_robotState != g_R310_robotStatus.robotState) { // 구조체 멤버 사용
-        if (p_robotState == R_STATE_SLEEPING && g_R310_robotStatus.robotState == R_STATE_AWAKE) { // 구조체 멤버 사용
-            R310_setAnimation(EMT_SLEEP_BLINK, EMTP_AUTO_REVERSE_OFF, EMTP_PLY_DIR_FIRST, EMTP_FORCE_PLY_ON);
-        } else if (p_robotState == R_STATE_AWAKE && g_R310_robotStatus.robotState == R_STATE_SLEEPING) { // 구조체 멤버 사용
-            R310_setAnimation(EMT_SLEEP, EMTP_AUTO_REVERSE_OFF, EMTP_PLY_DIR_LAST, EMTP_FORCE_PLY_ON);
+void R310_setRobotState(T_R310_Eyes_t* p_eyes, T_R310_RobotState_t p_robotState) { // 변경된 열거형명
+    if (p_robotState != p_eyes->robotStatus.robotState) { // 구조체 멤버 사용
+        if (p_robotState == R_STATE_SLEEPING && p_eyes->robotStatus.robotState == R_STATE_AWAKE) { // 구조체 멤버 사용
+            R310_tl_stop(&p_eyes->timeline, TL_TRACK_LID, G_R310_TL_PRIO_STATE);   // 잠드는 시퀀스 위에 깜빡임/윙크가 남지 않도록
+            R310_tl_stop(&p_eyes->timeline, TL_TRACK_PUPIL, G_R310_TL_PRIO_STATE);
+            R310_setAnimation(p_eyes, EMT_SLEEP_BLINK, EMTP_AUTO_REVERSE_OFF, EMTP_PLY_DIR_FIRST, EMTP_FORCE_PLY_ON);
+        } else if (p_robotState == R_STATE_AWAKE && p_eyes->robotStatus.robotState == R_STATE_SLEEPING) { // 구조체 멤버 사용
+            R310_setAnimation(p_eyes, EMT_SLEEP, EMTP_AUTO_REVERSE_OFF, EMTP_PLY_DIR_LAST, EMTP_FORCE_PLY_ON);
         }
-        g_R310_robotStatus.robotState = p_robotState; // 구조체 멤버 사용
+        p_eyes->robotStatus.robotState = p_robotState; // 구조체 멤버 사용
     }
 }
 
-// R310_runAnimation 함수
-bool R310_runAnimation(void) {
-    static T_R310_ani_Frame_t   v_thisFrame;
-    static uint32_t             v_timeOfLastFrame = 0;
+// R310_runAnimation 함수 - 인스턴스의 애니메이션 상태 머신을 한 단계 진행합니다.
+// 기본 표정 트랙(시퀀스 상태 머신)을 진행한 뒤, 오버레이 트랙이 바뀌었고 기본 트랙이 이번에 출력하지 않았으면 다시 합성합니다.
+// @return 상태가 바뀔 수 있는 다음 시점까지 남은 시간 (밀리초, 0 이면 다음 틱에 바로 다시 호출)
+uint16_t R310_runAnimation(T_R310_Eyes_t* p_eyes) {
+    bool     v_tlChanged  = R310_tl_step(&p_eyes->timeline, millis());
+    uint32_t v_framesSent = p_eyes->showState.framesSent;
 
-    switch (g_R310_aniControl.anyPly_State) { // 구조체 멤버 사용
+    switch (p_eyes->aniControl.anyPly_State) { // 구조체 멤버 사용
         case ANI_PLY_STATE_IDLE:
-            if (g_R310_textDisplay.pointer_buf != nullptr && g_R310_textDisplay.buffer[0] != '\0') { // 구조체 멤버 사용
-                g_R310_aniControl.anyPly_State = ANI_PLY_STATE_TEXT; // 구조체 멤버 사용
+            if (p_eyes->textDisplay.pointer_buf != nullptr && p_eyes->textDisplay.buffer[0] != '\0') { // 구조체 멤버 사용
+                p_eyes->aniControl.anyPly_State = ANI_PLY_STATE_TEXT; // 구조체 멤버 사용
                 break;
             }
-            if (g_R310_aniControl.emotionIdx_next != EMT_NONE) { // 구조체 멤버 사용
-                g_R310_aniControl.anyPly_State = ANI_PLY_STATE_RESTART; // 구조체 멤버 사용
+            if (p_eyes->aniControl.emotionIdx_next == EMT_NONE) { // 재생이 끝났으면 대기열(APPEND)의 다음 요청
+                T_R310_AniCmd_t v_cmd;
+                if (R310_cmdq_pop(&p_eyes->cmdQueue, &v_cmd)) R310_startCommand(p_eyes, &v_cmd);
+            }
+            if (p_eyes->aniControl.emotionIdx_next != EMT_NONE) { // 구조체 멤버 사용
+                p_eyes->aniControl.anyPly_State = ANI_PLY_STATE_RESTART; // 구조체 멤버 사용
                 break;
             }
-            if (g_R310_aniControl.autoBlinkOn && (millis() - g_R310_robotStatus.lastAnimationTime) >= g_R310_robotStatus.blinkMinimumTime) { // 구조체 멤버 사용
+            // 잠든 상태의 자동 깜빡임은 기본 트랙 시퀀스 (깨어 있을 때는 아래에서 눈꺼풀 트랙으로 재생)
+            if (p_eyes->aniControl.autoBlinkOn && p_eyes->robotStatus.robotState == R_STATE_SLEEPING &&
+                (millis() - p_eyes->robotStatus.lastAnimationTime) >= p_eyes->robotStatus.blinkMinimumTime) { // 구조체 멤버 사용
                 if (random(1000) > 700) {
-                    if (g_R310_robotStatus.robotState == R_STATE_SLEEPING) { // 구조체 멤버 사용
-                        R310_setAnimation(EMT_SLEEP_BLINK, EMTP_AUTO_REVERSE_ON, EMTP_PLY_DIR_LAST, EMTP_FORCE_PLY_ON);
-                    } else if (g_R310_robotStatus.robotState == R_STATE_AWAKE) { // 구조체 멤버 사용
-                        R310_setAnimation(EMT_BLINK, EMTP_AUTO_REVERSE_ON, EMTP_PLY_DIR_FIRST, EMTP_FORCE_PLY_ON);
-                    }
-                    g_R310_robotStatus.lastAnimationTime = millis(); // 구조체 멤버 사용
-                } else {
-                    g_R310_robotStatus.lastAnimationTime = millis(); // 구조체 멤버 사용
+                    R310_setAnimation(p_eyes, EMT_SLEEP_BLINK, EMTP_AUTO_REVERSE_ON, EMTP_PLY_DIR_LAST, EMTP_FORCE_PLY_ON);
                 }
+                p_eyes->robotStatus.lastAnimationTime = millis(); // 구조체 멤버 사용
             }
             break;
 
         case ANI_PLY_STATE_RESTART:
-            if (g_R310_aniControl.emotionIdx_next != EMT_NONE) { // 구조체 멤버 사용
-                R310_loadSequence(g_R310_aniControl.emotionIdx_next); // 구조체 멤버 사용
-                g_R310_aniControl.emotionIdx_current = g_R310_aniControl.emotionIdx_next; // 구조체 멤버 사용
-                g_R310_aniControl.emotionIdx_next = EMT_NONE; // 구조체 멤버 사용
-                g_R310_aniControl.anyPly_State = ANI_PLY_STATE_ANIMATE; // 구조체 멤버 사용
+            if (p_eyes->aniControl.emotionIdx_next != EMT_NONE) { // 구조체 멤버 사용
+                R310_loadSequence(p_eyes, p_eyes->aniControl.emotionIdx_next); // 구조체 멤버 사용
+                p_eyes->aniControl.emotionIdx_current = p_eyes->aniControl.emotionIdx_next; // 구조체 멤버 사용
+                p_eyes->aniControl.emotionIdx_next = EMT_NONE; // 구조체 멤버 사용
+                p_eyes->aniControl.anyPly_State = ANI_PLY_STATE_ANIMATE; // 구조체 멤버 사용
             } else {
-                g_R310_aniControl.anyPly_State = ANI_PLY_STATE_IDLE; // 구조체 멤버 사용
+                p_eyes->aniControl.anyPly_State = ANI_PLY_STATE_IDLE; // 구조체 멤버 사용
             }
             break;
 
         case ANI_PLY_STATE_ANIMATE:
-            R310_loadFrame(&v_thisFrame);
-            R310_drawEyes(v_thisFrame.eyeData[0], v_thisFrame.eyeData[1]);
-            v_timeOfLastFrame = millis();
+            if (p_eyes->aniControl.procSeq != nullptr) {
+                // 재생 방향의 다음 키프레임까지 보간 (마지막 키프레임은 유지)
+                int8_t v_nextIdx = p_eyes->aniControl.aniFrameIndex + ((p_eyes->aniControl.playDirection == EMTP_PLY_DIR_LAST) ? -1 : 1);
+                if (v_nextIdx < 0 || v_nextIdx >= p_eyes->aniControl.currentAniTable.seqSize) v_nextIdx = p_eyes->aniControl.aniFrameIndex;
+                memcpy_P(&p_eyes->aniControl.procFrom, &p_eyes->aniControl.procSeq[p_eyes->aniControl.aniFrameIndex], sizeof(T_R310_proc_Keyframe_t));
+                memcpy_P(&p_eyes->aniControl.procTo, &p_eyes->aniControl.procSeq[v_nextIdx], sizeof(T_R310_proc_Keyframe_t));
+                // 보간 시간은 두 키프레임 중 앞쪽(시퀀스 순서 기준) 키프레임의 timeFrame
+                p_eyes->aniControl.thisFrame.timeFrame = (v_nextIdx < p_eyes->aniControl.aniFrameIndex) ? p_eyes->aniControl.procTo.timeFrame : p_eyes->aniControl.procFrom.timeFrame;
+                p_eyes->aniControl.thisFrame.timeFrame = R310_tl_scaleTime(p_eyes->aniControl.thisFrame.timeFrame, p_eyes->aniControl.speedQ8);
+                R310_drawEyesProc(p_eyes, &p_eyes->aniControl.procFrom, &p_eyes->aniControl.procTo, 0);
+                p_eyes->aniControl.procLastStep = millis();
+            } else {
+                R310_loadFrame(p_eyes, &p_eyes->aniControl.thisFrame);
+                p_eyes->aniControl.thisFrame.timeFrame = R310_tl_scaleTime(p_eyes->aniControl.thisFrame.timeFrame, p_eyes->aniControl.speedQ8);
+                if (p_eyes->aniControl.currentAniTable.blendMode == EMTP_BLEND_CROSSFADE) {
+                    R310_composeEyes(p_eyes, p_eyes->aniControl.thisFrame.eyeData[0], p_eyes->aniControl.thisFrame.eyeData[1], p_eyes->aniControl.thisFrame.eyeTransform[0], p_eyes->aniControl.thisFrame.eyeTransform[1]);
+                    R310_beginCrossfade(p_eyes, p_eyes->aniControl.thisFrame.timeFrame); // 표시 시간 동안 이전 프레임에서 서서히 전환
+                } else {
+                    R310_drawEyes(p_eyes, p_eyes->aniControl.thisFrame.eyeData[0], p_eyes->aniControl.thisFrame.eyeData[1], p_eyes->aniControl.thisFrame.eyeTransform[0], p_eyes->aniControl.thisFrame.eyeTransform[1]);
+                }
+            }
+            p_eyes->aniControl.timeOfLastFrame = millis();
 
-            if (g_R310_aniControl.playDirection == EMTP_PLY_DIR_LAST) { // 구조체 멤버 사용
-                g_R310_aniControl.aniFrameIndex--; // 구조체 멤버 사용
+            if (p_eyes->aniControl.playDirection == EMTP_PLY_DIR_LAST) { // 구조체 멤버 사용
+                p_eyes->aniControl.aniFrameIndex--; // 구조체 멤버 사용
             } else {
-                g_R310_aniControl.aniFrameIndex++; // 구조체 멤버 사용
+                p_eyes->aniControl.aniFrameIndex++; // 구조체 멤버 사용
             }
-            g_R310_aniControl.anyPly_State = ANI_PLY_STATE_PAUSE; // 구조체 멤버 사용
+            p_eyes->aniControl.anyPly_State = ANI_PLY_STATE_PAUSE; // 구조체 멤버 사용
             break;
 
         case ANI_PLY_STATE_PAUSE:
-            if ((millis() - v_timeOfLastFrame) < v_thisFrame.timeFrame) {
+            R310_stepCrossfade(p_eyes); // 크로스페이드 시퀀스면 표시 시간 동안 화면 갱신
+            if ((millis() - p_eyes->aniControl.timeOfLastFrame) < p_eyes->aniControl.thisFrame.timeFrame) {
+                // 절차적 시퀀스면 다음 키프레임까지 파라미터 보간 (G_R310_CROSSFADE_REFRESH_MS 주기)
+                if (p_eyes->aniControl.procSeq != nullptr && (millis() - p_eyes->aniControl.procLastStep) >= G_R310_CROSSFADE_REFRESH_MS) {
+                    p_eyes->aniControl.procLastStep = millis();
+                    R310_drawEyesProc(p_eyes, &p_eyes->aniControl.procFrom, &p_eyes->aniControl.procTo, (fract8)(((millis() - p_eyes->aniControl.timeOfLastFrame) * 255) / p_eyes->aniControl.thisFrame.timeFrame));
+                }
                 break;
             }
-            if ((g_R310_aniControl.playDirection == EMTP_PLY_DIR_FIRST && g_R310_aniControl.aniFrameIndex >= g_R310_aniControl.currentAniTable.seqSize) ||
-                (g_R310_aniControl.playDirection == EMTP_PLY_DIR_LAST && g_R310_aniControl.aniFrameIndex < 0)) { // 구조체 멤버 사용
-                if (g_R310_aniControl.autoReverse == EMTP_AUTO_REVERSE_ON) { // 구조체 멤버 사용
+            if (p_eyes->aniControl.procSeq != nullptr) {
+                R310_drawEyesProc(p_eyes, &p_eyes->aniControl.procFrom, &p_eyes->aniControl.procTo, 255); // 보간 종료 시 다음 키프레임 그대로
+            }
+            if ((p_eyes->aniControl.playDirection == EMTP_PLY_DIR_FIRST && p_eyes->aniControl.aniFrameIndex >= p_eyes->aniControl.currentAniTable.seqSize) ||
+                (p_eyes->aniControl.playDirection == EMTP_PLY_DIR_LAST && p_eyes->aniControl.aniFrameIndex < 0)) { // 구조체 멤버 사용
+                if (p_eyes->aniControl.autoReverse == EMTP_AUTO_REVERSE_ON) { // 구조체 멤버 사용
                     EMTP_Ply_Direct_t v_emtp_ply_dir;
-                    if( g_R310_aniControl.playDirection == EMTP_PLY_DIR_FIRST){ // 구조체 멤버 사용
+                    if( p_eyes->aniControl.playDirection == EMTP_PLY_DIR_FIRST){ // 구조체 멤버 사용
                         v_emtp_ply_dir  = EMTP_PLY_DIR_LAST; // 역방향 시작으로 변경 (자동 역재생)
                     } else {
                         v_emtp_ply_dir  = EMTP_PLY_DIR_FIRST; // 정방향 시작으로 변경 (자동 역재생)
                     }
-                    R310_setAnimation(g_R310_aniControl.currentAniTable.emotionIdx, EMTP_AUTO_REVERSE_OFF, v_emtp_ply_dir, EMTP_FORCE_PLY_ON); // 구조체 멤버 사용
+                    p_eyes->aniControl.clipNext  = p_eyes->aniControl.clipSlot; // 이름으로 재생한 클립도 같은 클립으로 역재생
+                    p_eyes->aniControl.speedNext = p_eyes->aniControl.speedQ8;  // 역재생도 같은 속도
+                    R310_setAnimation(p_eyes, p_eyes->aniControl.currentAniTable.emotionIdx, EMTP_AUTO_REVERSE_OFF, v_emtp_ply_dir, EMTP_FORCE_PLY_ON); // 구조체 멤버 사용
                 } else {
-                    g_R310_aniControl.anyPly_State        = ANI_PLY_STATE_IDLE; // 구조체 멤버 사용
-                    g_R310_aniControl.emotionIdx_current   = EMT_NONE; // 구조체 멤버 사용
-                    g_R310_robotStatus.lastAnimationTime     = millis(); // 구조체 멤버 사용
+                    p_eyes->aniControl.anyPly_State        = ANI_PLY_STATE_IDLE; // 구조체 멤버 사용
+                    p_eyes->aniControl.emotionIdx_current   = EMT_NONE; // 구조체 멤버 사용
+                    p_eyes->robotStatus.lastAnimationTime     = millis(); // 구조체 멤버 사용
                 }
             } else {
-                g_R310_aniControl.anyPly_State = ANI_PLY_STATE_ANIMATE; // 구조체 멤버 사용
+                p_eyes->aniControl.anyPly_State = ANI_PLY_STATE_ANIMATE; // 구조체 멤버 사용
             }
             break;
 
         case ANI_PLY_STATE_TEXT:
-            if (g_R310_textDisplay.buffer[0] == '\0') { // 구조체 멤버 사용
-                g_R310_aniControl.anyPly_State = ANI_PLY_STATE_IDLE; // 구조체 멤버 사용
-                g_R310_robotStatus.lastAnimationTime = millis(); // 구조체 멤버 사용
+            R310_showText(p_eyes, false); // 마퀴 진행 (스크롤이 끝나면 텍스트를 지우고 IDLE 로 전환)
+            if (p_eyes->textDisplay.buffer[0] == '\0') { // 구조체 멤버 사용
+                p_eyes->aniControl.anyPly_State = ANI_PLY_STATE_IDLE; // 구조체 멤버 사용
+                p_eyes->robotStatus.lastAnimationTime = millis(); // 구조체 멤버 사용
             }
             break;
 
         default:
-            g_R310_aniControl.anyPly_State = ANI_PLY_STATE_IDLE; // 구조체 멤버 사용
-            g_R310_aniControl.emotionIdx_current = EMT_NONE; // 구조체 멤버 사용
-            R310_clearText();
-            g_R310_robotStatus.lastAnimationTime = millis(); // 구조체 멤버 사용
+            p_eyes->aniControl.anyPly_State = ANI_PLY_STATE_IDLE; // 구조체 멤버 사용
+            p_eyes->aniControl.emotionIdx_current = EMT_NONE; // 구조체 멤버 사용
+            R310_clearText(p_eyes);
+            p_eyes->robotStatus.lastAnimationTime = millis(); // 구조체 멤버 사용
             break;
     }
-    return (g_R310_aniControl.anyPly_State == ANI_PLY_STATE_IDLE); // 구조체 멤버 사용
+
+    // 깨어 있을 때 자동 깜빡임은 눈꺼풀 트랙으로 재생 (기본 표정을 다시 시작하지 않으므로 표정 재생 중에도 깜빡임)
+    uint32_t v_elapsed = millis() - p_eyes->robotStatus.lastAnimationTime;
+    if (p_eyes->aniControl.autoBlinkOn && p_eyes->robotStatus.robotState == R_STATE_AWAKE &&
+        p_eyes->aniControl.anyPly_State != ANI_PLY_STATE_TEXT && v_elapsed >= p_eyes->robotStatus.blinkMinimumTime) {
+        if (random(1000) > 700 &&
+            R310_tl_play(&p_eyes->timeline, TL_TRACK_LID, g_R310_tlClip_Blink, sizeof(g_R310_tlClip_Blink) / sizeof(T_R310_tl_Key_t), G_R310_TL_PRIO_AUTO, millis())) {
+            v_tlChanged = true;
+        }
+        p_eyes->robotStatus.lastAnimationTime = millis();
+        v_elapsed = 0;
+    }
+    if (v_tlChanged && p_eyes->showState.framesSent == v_framesSent) R310_refreshOverlay(p_eyes); // 기본 트랙이 이미 새 오버레이로 출력했으면 생략
+
+    // 다음 호출 시점 (대기 중인 인스턴스는 R310_batch_tick 이 상태를 읽지 않고 건너뜀)
+    // 상태 대기, 자동 깜빡임 대기, 오버레이 트랙의 다음 키프레임 중 가장 이른 시점
+    uint16_t v_blinkWait = (!p_eyes->aniControl.autoBlinkOn) ? p_eyes->robotStatus.blinkMinimumTime : // 명령이 오면 R310_batch_wake 로 깨움
+                           (v_elapsed >= p_eyes->robotStatus.blinkMinimumTime) ? 0 : (uint16_t)(p_eyes->robotStatus.blinkMinimumTime - v_elapsed);
+    uint16_t v_wait;
+    switch (p_eyes->aniControl.anyPly_State) {
+        case ANI_PLY_STATE_IDLE:
+            if ((p_eyes->textDisplay.pointer_buf != nullptr && p_eyes->textDisplay.buffer[0] != '\0') || p_eyes->aniControl.emotionIdx_next != EMT_NONE ||
+                p_eyes->cmdQueue.listCount > 0) return 0;
+            v_wait = v_blinkWait;
+            break;
+
+        case ANI_PLY_STATE_PAUSE: {
+            uint32_t v_frameElapsed = millis() - p_eyes->aniControl.timeOfLastFrame;
+            v_wait = (v_frameElapsed >= p_eyes->aniControl.thisFrame.timeFrame) ? 0 : (uint16_t)(p_eyes->aniControl.thisFrame.timeFrame - v_frameElapsed);
+            if ((p_eyes->crossfade.isActive || p_eyes->aniControl.procSeq != nullptr) && v_wait > G_R310_CROSSFADE_REFRESH_MS) {
+                v_wait = G_R310_CROSSFADE_REFRESH_MS; // 표시 시간 동안 화면 갱신
+            }
+            if (p_eyes->robotStatus.robotState == R_STATE_AWAKE && v_blinkWait < v_wait) v_wait = v_blinkWait;
+            break;
+        }
+
+        case ANI_PLY_STATE_TEXT:
+            return G_R310_CROSSFADE_REFRESH_MS; // 마퀴 스크롤 갱신 (오버레이는 텍스트 중 적용하지 않음)
+
+        default:
+            return 0; // RESTART / ANIMATE 는 바로 다음 단계로
+    }
+    uint16_t v_tlWait = R310_tl_wait(&p_eyes->timeline, millis());
+    return (v_tlWait < v_wait) ? v_tlWait : v_wait;
 }
 
-// R310_init 함수
-void R310_init() {
-    // ... (기존 FastLED 초기화 부분 동일) ...
-    g_R310_ledsPtr = g_R310_leds; // 변경된 변수명
+// 눈 인스턴스 하나를 초기 상태로 만들고 체인 백 버퍼의 구간에 연결합니다.
+// @param p_leds 인스턴스가 그릴 구간 시작 (G_R310_NEOPIXEL_NUM_LEDS 픽셀)
+// @param p_ledOffset 체인 내 시작 픽셀
+void R310_eyes_init(T_R310_Eyes_t* p_eyes, CRGB* p_leds, uint16_t p_ledOffset) {
+    R310_pwr_init(&p_eyes->power, G_R310_BRIGHTNESS); // 밝기는 R310_batch_present 가 show(scale) 로 적용
+    R310_gaze_init(&p_eyes->gaze);
+    R310_tl_init(&p_eyes->timeline);
+    R310_cmdq_init(&p_eyes->cmdQueue);
+    memset(&p_eyes->remote, 0, sizeof(T_R310_Remote_t));
+
+    p_eyes->output.leds      = p_leds;
+    p_eyes->output.ledOffset = p_ledOffset;
+    p_eyes->output.isDirty   = false;
+    p_eyes->palette = G_R310_DEFAULT_PALETTE;
+    p_eyes->aniControl.procSeq = nullptr;
+    p_eyes->aniControl.clipSlot = -1;
+    p_eyes->aniControl.clipNext = -1;
+    p_eyes->aniControl.speedQ8   = G_R310_TL_SPEED_1X;
+    p_eyes->aniControl.speedNext = G_R310_TL_SPEED_1X;
+    p_eyes->aniControl.timeOfLastFrame = 0;
+    p_eyes->aniControl.procLastStep    = 0;
+    p_eyes->aniControl.emotionIdx_next    = EMT_NONE;
+    p_eyes->aniControl.emotionIdx_current = EMT_NONE;
 
     // 로봇 상태 관련 변수 초기화 (구조체 멤버 사용)
-    g_R310_robotStatus.robotState            = R_STATE_AWAKE;
-    g_R310_aniControl.anyPly_State        = ANI_PLY_STATE_IDLE;
-    g_R310_aniControl.autoBlinkOn      = true;     // 이제 명시적으로 설정
-    g_R310_robotStatus.blinkMinimumTime      = 5000;
-    g_R310_robotStatus.lastAnimationTime     = millis();
+    p_eyes->robotStatus.robotState            = R_STATE_AWAKE;
+    p_eyes->aniControl.anyPly_State        = ANI_PLY_STATE_IDLE;
+    p_eyes->aniControl.autoBlinkOn      = true;     // 이제 명시적으로 설정
+    p_eyes->robotStatus.blinkMinimumTime      = 5000;
+    p_eyes->robotStatus.lastAnimationTime     = millis();
 
     // 텍스트 버퍼 초기화 및 포인터 연결 (구조체 멤버 사용)
-    g_R310_textDisplay.buffer[0]        = '\0';
-    g_R310_textDisplay.pointer_buf          = g_R310_textDisplay.buffer;
+    p_eyes->textDisplay.buffer[0]        = '\0';
+    p_eyes->textDisplay.pointer_buf          = p_eyes->textDisplay.buffer;
+
+    // 화면 출력 상태 초기화 (첫 프레임은 항상 출력)
+    p_eyes->showState.isValid        = false;
+    p_eyes->showState.framesSent     = 0;
+    p_eyes->showState.framesSkipped  = 0;
+    p_eyes->crossfade.isActive       = false;
+}
+
+// 배치 초기화 (등록된 인스턴스 없음)
+void R310_batch_init(T_R310_EyesBatch_t* p_batch) {
+    p_batch->count = 0;
+}
+
+// 인스턴스를 배치에 등록합니다. 등록 즉시 다음 틱에서 애니메이션/시선을 갱신합니다.
+// @return 배치 내 슬롯 번호 (가득 차 있으면 0xFF)
+uint8_t R310_batch_add(T_R310_EyesBatch_t* p_batch, T_R310_Eyes_t* p_eyes) {
+    if (p_batch->count >= G_R310_EYES_COUNT) return 0xFF;
+
+    uint8_t  v_slot = p_batch->count++;
+    uint32_t v_now  = millis();
+    p_batch->eyes[v_slot]         = p_eyes;
+    p_batch->wakeTime[v_slot]     = v_now;
+    p_batch->gazeTime[v_slot]     = v_now;
+    p_batch->activityTime[v_slot] = v_now;
+    return v_slot;
+}
+
+// 명령 등 외부 입력이 들어온 인스턴스를 다음 틱에 바로 갱신하도록 깨웁니다. (정지해 있던 시선 타이머 포함)
+// @param p_isActivity true 이면 잠들기 타이머도 다시 시작
+void R310_batch_wake(T_R310_EyesBatch_t* p_batch, uint8_t p_slot, bool p_isActivity) {
+    uint32_t v_now = millis();
+    p_batch->wakeTime[p_slot] = v_now;
+    p_batch->gazeTime[p_slot] = v_now;
+    if (p_isActivity) p_batch->activityTime[p_slot] = v_now;
+}
 
-    g_R310_robotStatus.lastActivityTime      = millis(); // 구조체 멤버 사용
+// 배치의 모든 인스턴스를 한 틱 진행합니다.
+// 타이머 배열만 훑어서 때가 된 인스턴스만 상태 머신/시선을 갱신하므로, 대기 중인 인스턴스의 상태 구조체는 읽지 않습니다.
+// @return 출력할 구간이 있으면 true (이어서 R310_batch_present 호출)
+bool G_R310_HOT_CODE R310_batch_tick(T_R310_EyesBatch_t* p_batch, uint32_t p_now) {
+    bool v_isDirty = false;
 
-    R310_setAnimation(EMT_NEUTRAL, EMTP_AUTO_REVERSE_OFF, EMTP_PLY_DIR_FIRST, EMTP_FORCE_PLY_ON);
+    for (uint8_t v_i = 0; v_i < p_batch->count; v_i++) {
+        T_R310_Eyes_t* v_eyes = p_batch->eyes[v_i];
+
+        // 원격 표시 중: 상태 머신/시선/잠들기를 멈추고 (요청은 링에 남겨 두었다가 복귀 후 재생) 마지막 프레임 이후 제한 시간까지 쉼
+        if (v_eyes->remote.isActive) {
+            uint32_t v_timeout = v_eyes->remote.lastFrameTime + G_R310_REMOTE_TIMEOUT_MS;
+            if ((int32_t)(p_now - v_timeout) < 0) {
+                p_batch->wakeTime[v_i] = v_timeout;
+                p_batch->gazeTime[v_i] = v_timeout;
+                v_isDirty |= v_eyes->output.isDirty;
+                continue;
+            }
+            v_eyes->remote.isActive = false;
+            R310_invalidateFrame(v_eyes);
+            R310_showFrame(v_eyes, &v_eyes->palette); // 원격 프레임 대신 현재 애니메이션 프레임을 다시 출력
+            p_batch->wakeTime[v_i]     = p_now;
+            p_batch->gazeTime[v_i]     = p_now;
+            p_batch->activityTime[v_i] = p_now;
+        }
+
+        // 새 요청: REPLACE 는 바로 재생, 나머지는 대기열로 (IDLE 이면 이번 틱에 상태 머신이 꺼냄)
+        if (R310_cmdq_hasPosted(&v_eyes->cmdQueue)) {
+            T_R310_AniCmd_t v_cmd;
+            bool            v_isBusy = v_eyes->aniControl.anyPly_State != ANI_PLY_STATE_IDLE || v_eyes->aniControl.emotionIdx_next != EMT_NONE;
+            if (R310_cmdq_drain(&v_eyes->cmdQueue, v_isBusy, &v_cmd)) R310_startCommand(v_eyes, &v_cmd);
+            p_batch->wakeTime[v_i] = p_now;
+        }
+        if ((int32_t)(p_now - p_batch->wakeTime[v_i]) >= 0) {
+            p_batch->wakeTime[v_i] = p_now + R310_runAnimation(v_eyes);
+        }
+        if ((int32_t)(p_now - p_batch->gazeTime[v_i]) >= 0) {
+            R310_stepGaze(v_eyes); // 센서 기반 시선 오버레이 (100Hz, 스프링이 멈추면 새 목표가 올 때까지 쉼)
+            p_batch->gazeTime[v_i] = p_now + (R310_gaze_isSettled(&v_eyes->gaze) ? G_R310_BATCH_IDLE_MS : G_R310_GAZE_REFRESH_MS);
+        }
+
+        bool v_isIdle = (p_now - p_batch->activityTime[v_i]) >= G_R310_TIME_TO_SLEEP;
+        if (v_isIdle != (v_eyes->robotStatus.robotState == R_STATE_SLEEPING)) {
+            R310_setRobotState(v_eyes, v_isIdle ? R_STATE_SLEEPING : R_STATE_AWAKE);
+            p_batch->wakeTime[v_i] = p_now; // 상태 전환 애니메이션 바로 시작
+        }
+
+        v_isDirty |= v_eyes->output.isDirty;
+    }
+    return v_isDirty;
+}
+
+// 배치에서 다음 이벤트(애니메이션 상태 전환, 시선 갱신, 잠들기)가 일어날 가장 이른 절대 시간 (millis 기준)
+// R310_sched_waitUntil 에 넘겨 그때까지 루프를 재웁니다.
+uint32_t R310_batch_nextDue(const T_R310_EyesBatch_t* p_batch, uint32_t p_now) {
+    uint32_t v_due = p_now + G_R310_BATCH_IDLE_MS;
+
+    for (uint8_t v_i = 0; v_i < p_batch->count; v_i++) {
+        if ((int32_t)(p_batch->wakeTime[v_i] - v_due) < 0) v_due = p_batch->wakeTime[v_i];
+        if ((int32_t)(p_batch->gazeTime[v_i] - v_due) < 0) v_due = p_batch->gazeTime[v_i];
+        if (p_batch->eyes[v_i]->robotStatus.robotState != R_STATE_SLEEPING) {
+            uint32_t v_sleepDue = p_batch->activityTime[v_i] + G_R310_TIME_TO_SLEEP;
+            if ((int32_t)(v_sleepDue - v_due) < 0) v_due = v_sleepDue;
+        }
+    }
+    return v_due;
+}
+
+// 바뀐 구간이 있는 체인 백 버퍼를 한 번에 출력 단계로 제출합니다.
+// FastLED show(scale) 는 체인 전체에 한 밝기만 적용하므로, 인스턴스별 전원 제한 밝기 중 가장 낮은 값을 씁니다.
+void G_R310_HOT_CODE R310_batch_present(T_R310_EyesBatch_t* p_batch) {
+    uint8_t v_brightness = 255;
+
+    for (uint8_t v_i = 0; v_i < p_batch->count; v_i++) {
+        uint8_t v_eyeBrightness = R310_pwr_brightness(&p_batch->eyes[v_i]->power);
+        if (v_eyeBrightness < v_brightness) v_brightness = v_eyeBrightness;
+        p_batch->eyes[v_i]->output.isDirty = false;
+    }
+    R310_ledOut_present(g_R310_leds, v_brightness); // 전송 태스크로 넘기고 바로 반환
+}
+
+// 모든 인스턴스의 시선 목표를 갱신합니다. (M010 차량 상태에서 호출)
+// 목표가 바뀌면 정지해 있던 시선 타이머를 다시 돌립니다.
+void R310_setGazeTarget(float p_yawRate_degps, float p_pitch_deg) {
+    uint32_t v_now = millis();
+    for (uint8_t v_i = 0; v_i < g_R310_batch.count; v_i++) {
+        T_R310_Gaze_t* v_gaze    = &g_R310_batch.eyes[v_i]->gaze;
+        bool           v_settled = R310_gaze_isSettled(v_gaze);
+        if (!R310_gaze_setTarget(v_gaze, p_yawRate_degps, p_pitch_deg) || !v_settled) continue;
+        v_gaze->lastStepTime        = v_now - G_R310_GAZE_REFRESH_MS; // 쉬던 시간만큼 한 번에 적분하지 않도록
+        g_R310_batch.gazeTime[v_i]  = v_now;
+    }
+}
+
+// 모든 인스턴스의 애니메이션 상태를 RTC 메모리 스냅샷으로 저장합니다. (R310_snapshot_001.h)
+// 원격 표시 중에도 멈춰 있는 애니메이션 상태를 저장하므로, 복귀하면 원격 프레임 대신 애니메이션 화면으로 시작합니다.
+void R310_snap_save(uint32_t p_now) {
+    for (uint8_t v_i = 0; v_i < g_R310_batch.count; v_i++) {
+        const T_R310_Eyes_t*       v_eyes = g_R310_batch.eyes[v_i];
+        const T_R310_AnimationControl_t* v_ani = &v_eyes->aniControl;
+        T_R310_SnapEyes_t*         v_snap = &g_R310_snapshot.eyes[v_i];
+        uint32_t                   v_frameElapsed = p_now - v_ani->timeOfLastFrame;
+
+        v_snap->plyState         = (uint8_t)v_ani->anyPly_State;
+        v_snap->emotionIdx       = (uint8_t)v_ani->currentAniTable.emotionIdx;
+        v_snap->emotionCurrent   = (uint8_t)v_ani->emotionIdx_current;
+        v_snap->emotionNext      = (uint8_t)v_ani->emotionIdx_next;
+        v_snap->aniFrameIndex    = v_ani->aniFrameIndex;
+        v_snap->playDirection    = (uint8_t)v_ani->playDirection;
+        v_snap->autoReverse      = (uint8_t)v_ani->autoReverse;
+        v_snap->robotState       = (uint8_t)v_eyes->robotStatus.robotState;
+        v_snap->autoBlinkOn      = v_ani->autoBlinkOn;
+        v_snap->userBrightness   = v_eyes->power.userBrightness;
+        v_snap->speedQ8          = v_ani->speedQ8;
+        v_snap->blinkMinimumTime = v_eyes->robotStatus.blinkMinimumTime;
+        v_snap->timeFrame        = v_ani->thisFrame.timeFrame;
+        v_snap->frameElapsed     = (uint16_t)((v_frameElapsed < v_ani->thisFrame.timeFrame) ? v_frameElapsed : v_ani->thisFrame.timeFrame);
+        v_snap->sinceAnimation   = p_now - v_eyes->robotStatus.lastAnimationTime;
+        v_snap->sinceActivity    = p_now - g_R310_batch.activityTime[v_i];
+
+        v_snap->clipName[0] = '\0';
+        if (v_ani->clipSlot >= 0) {
+            memcpy(v_snap->clipName, g_R310_clipBank.index[v_ani->clipSlot].name, G_R310_CLIP_NAME_LEN);
+            v_snap->clipName[G_R310_CLIP_NAME_LEN] = '\0';
+        }
+        memcpy(v_snap->text, v_eyes->textDisplay.buffer, sizeof(v_snap->text));
+        memcpy(v_snap->textRows, v_eyes->textScroll.rows, sizeof(v_snap->textRows));
+        v_snap->textCharIdx   = v_eyes->textScroll.charIdx;
+        v_snap->textColInChar = v_eyes->textScroll.colInChar;
+        v_snap->textTailCols  = v_eyes->textScroll.tailCols;
+        v_snap->textIsDone    = v_eyes->textScroll.isDone;
+        v_snap->eyeFb         = v_eyes->eyeFb;
+        v_snap->palette       = v_eyes->palette;
+    }
+    A04_rtc_seal(&g_R310_snapshot.header, G_R310_SNAP_MAGIC, G_R310_SNAP_VERSION, g_R310_snapshot.eyes, sizeof(g_R310_snapshot.eyes));
+    g_R310_snapTime = p_now;
+}
+
+// RTC 메모리 스냅샷으로 인스턴스 상태를 되살리고 마지막 화면을 다시 출력합니다. (R310_init 에서 R310_eyes_init 뒤에 호출)
+// 재생 중이던 시퀀스는 같은 프레임의 남은 표시 시간부터, 텍스트는 스크롤하던 위치부터 이어갑니다.
+// @return 복원했으면 true (스냅샷이 없거나 맞지 않으면 false, 호출한 쪽이 기본 애니메이션으로 시작)
+bool R310_snap_restore() {
+    if (!A04_rtc_open(&g_R310_snapshot.header, G_R310_SNAP_MAGIC, G_R310_SNAP_VERSION, g_R310_snapshot.eyes, sizeof(g_R310_snapshot.eyes))) return false;
+
+    uint32_t v_now = millis();
+    uint32_t v_offMs = A04_rtc_elapsedMs(&g_R310_snapshot.header); // 꺼져 있던 시간 (잠들기/자동 깜빡임 타이머에만 더함, 시퀀스는 저장한 프레임부터)
+    for (uint8_t v_i = 0; v_i < g_R310_batch.count; v_i++) {
+        T_R310_Eyes_t*             v_eyes = g_R310_batch.eyes[v_i];
+        T_R310_AnimationControl_t* v_ani  = &v_eyes->aniControl;
+        const T_R310_SnapEyes_t*   v_snap = &g_R310_snapshot.eyes[v_i];
+
+        v_eyes->robotStatus.robotState        = (T_R310_RobotState_t)v_snap->robotState;
+        v_eyes->robotStatus.blinkMinimumTime  = v_snap->blinkMinimumTime;
+        v_eyes->robotStatus.lastAnimationTime = v_now - v_snap->sinceAnimation - v_offMs;
+        v_eyes->power.userBrightness          = v_snap->userBrightness;
+        v_ani->autoBlinkOn     = v_snap->autoBlinkOn;
+        v_ani->playDirection   = (EMTP_Ply_Direct_t)v_snap->playDirection;
+        v_ani->autoReverse     = (EMTP_Ply_AutoReverse_t)v_snap->autoReverse;
+        v_ani->emotionIdx_next = (T_R310_emotion_idx_t)v_snap->emotionNext;
+        v_ani->clipNext        = (v_snap->clipName[0] != '\0') ? R310_clip_findByName(v_snap->clipName) : -1; // 뱅크에서 빠졌으면 내장 시퀀스
+        v_ani->speedNext       = v_snap->speedQ8;
+        memcpy(v_eyes->textDisplay.buffer, v_snap->text, sizeof(v_eyes->textDisplay.buffer));
+        v_eyes->textDisplay.buffer[G_R310_MAX_TEXT_LENGTH] = '\0';
+
+        switch ((T_R310_ani_ply_state_t)v_snap->plyState) {
+            case ANI_PLY_STATE_ANIMATE:
+            case ANI_PLY_STATE_PAUSE: { // 시퀀스를 다시 읽고 같은 프레임 위치로 (ANIMATE: 다음 프레임 표시 전, PAUSE: 표시 시간 대기 중)
+                T_R310_emotion_idx_t v_emotionNext = v_ani->emotionIdx_next;
+                R310_loadSequence(v_eyes, (T_R310_emotion_idx_t)v_snap->emotionIdx);
+                int8_t v_seqSize = (int8_t)v_ani->currentAniTable.seqSize;
+                v_ani->emotionIdx_current  = (T_R310_emotion_idx_t)v_snap->emotionCurrent;
+                v_ani->emotionIdx_next     = v_emotionNext;
+                v_ani->aniFrameIndex       = constrain(v_snap->aniFrameIndex, (int8_t)-1, v_seqSize); // 클립 길이가 바뀐 경우
+                v_ani->thisFrame.timeFrame = v_snap->timeFrame;
+                v_ani->timeOfLastFrame     = v_now - v_snap->frameElapsed;
+                if (v_ani->procSeq != nullptr) { // 보간 중이던 두 키프레임 (PAUSE 의 aniFrameIndex 는 이미 다음 키프레임)
+                    int8_t v_step = (v_ani->playDirection == EMTP_PLY_DIR_LAST) ? -1 : 1;
+                    int8_t v_cur  = constrain((int8_t)(v_ani->aniFrameIndex - ((v_snap->plyState == ANI_PLY_STATE_PAUSE) ? v_step : 0)), (int8_t)0, (int8_t)(v_seqSize - 1));
+                    int8_t v_next = v_cur + v_step;
+                    if (v_next < 0 || v_next >= v_seqSize) v_next = v_cur;
+                    memcpy_P(&v_ani->procFrom, &v_ani->procSeq[v_cur], sizeof(T_R310_proc_Keyframe_t));
+                    memcpy_P(&v_ani->procTo, &v_ani->procSeq[v_next], sizeof(T_R310_proc_Keyframe_t));
+                    v_ani->procLastStep = v_now;
+                }
+                v_ani->anyPly_State = (T_R310_ani_ply_state_t)v_snap->plyState;
+                break;
+            }
+
+            case ANI_PLY_STATE_TEXT: // 마퀴 캔버스와 다음 글자 위치
+                R310_text_begin(&v_eyes->textScroll, v_eyes->textDisplay.pointer_buf, G_R310_TEXT_SCROLL_PPS);
+                memcpy(v_eyes->textScroll.rows, v_snap->textRows, sizeof(v_eyes->textScroll.rows));
+                v_eyes->textScroll.charIdx   = v_snap->textCharIdx;
+                v_eyes->textScroll.colInChar = v_snap->textColInChar;
+                v_eyes->textScroll.tailCols  = v_snap->textTailCols;
+                v_eyes->textScroll.isDone    = v_snap->textIsDone;
+                v_ani->anyPly_State = ANI_PLY_STATE_TEXT;
+                break;
+
+            default: // IDLE / RESTART (다음 요청은 emotionIdx_next, clipNext, speedNext 로 이미 복원)
+                v_ani->emotionIdx_current = (T_R310_emotion_idx_t)v_snap->emotionCurrent;
+                v_ani->anyPly_State       = (T_R310_ani_ply_state_t)v_snap->plyState;
+                break;
+        }
+
+        v_eyes->eyeFb   = v_snap->eyeFb;
+        v_eyes->palette = v_snap->palette; // R310_loadSequence 가 감정 팔레트로 바꿨어도 마지막 출력 팔레트로
+        R310_showFrame(v_eyes, (v_ani->anyPly_State == ANI_PLY_STATE_TEXT) ? &G_R310_DEFAULT_PALETTE : &v_eyes->palette);
+        g_R310_batch.activityTime[v_i] = v_now - v_snap->sinceActivity - v_offMs;
+    }
+    g_R310_snapIsResumed = true;
+    g_R310_snapTime      = v_now;
+    return true;
+}
+
+// R310_init 함수
+void R310_init() {
+    R310_hot_init(T_R310_EyeFont_t<G_R310_EYE_COL_SIZE, G_R310_DISPLAY_HEIGHT>::PACKED); // 글리프/시퀀스 테이블 DRAM 사본 (플래시 캐시 미스 방지)
+    R310_clip_mount(); // 외부 클립 뱅크 (있으면 해당 감정의 내장 시퀀스 대체)
+
+    // FastLED 초기화: 프런트 버퍼를 등록하고 전송 태스크 시작 (렌더링은 g_R310_leds 백 버퍼에서)
+    R310_ledOut_init(nullptr);
+    g_R310_ledsPtr = g_R310_leds; // 변경된 변수명
+
+    // 인스턴스 i 는 체인의 i 번째 눈 한 쌍 구간에 그림
+    R310_batch_init(&g_R310_batch);
+    for (uint8_t v_i = 0; v_i < G_R310_EYES_COUNT; v_i++) {
+        uint16_t v_offset = v_i * G_R310_NEOPIXEL_NUM_LEDS;
+        R310_eyes_init(&g_R310_eyes[v_i], &g_R310_leds[v_offset], v_offset);
+        R310_batch_add(&g_R310_batch, &g_R310_eyes[v_i]);
+    }
+
+    #ifdef R310_BENCH
+        R310_bench_run();
+    #endif
+
+    if (R310_snap_restore()) { // 딥슬립/워치독 리셋 전 상태에서 이어서 재생
+        Serial.println("R310: resumed from RTC snapshot");
+    } else {
+        for (uint8_t v_i = 0; v_i < G_R310_EYES_COUNT; v_i++) {
+            R310_setAnimation(&g_R310_eyes[v_i], EMT_NEUTRAL, EMTP_AUTO_REVERSE_OFF, EMTP_PLY_DIR_FIRST, EMTP_FORCE_PLY_ON);
+        }
+    }
+    R310_sched_init(); // 이 태스크(loop)를 대기 대상으로 등록, 시리얼 수신 시 깨움
+    A02_serialMux_register("r310", nullptr, R310_handleSerialLine, true); // 다른 모듈 접두사에 맞지 않는 줄은 모두 눈 명령
+    A02_serialMux_registerFrames("r310", LINK_MSG_FIRST, LINK_MSG_LAST, R310_handleLinkFrame); // 원격 표시/글리프/상태 보고
 }
 
 // R310_run 함수
 void R310_run() {
-    R310_runAnimation();
-
-    if (g_R310_robotStatus.robotState != R_STATE_SLEEPING && millis() - g_R310_robotStatus.lastActivityTime >= G_R310_TIME_TO_SLEEP) { // 구조체 멤버 사용
-        R310_setRobotState(R_STATE_SLEEPING); // 변경된 함수명
-    } else if (g_R310_robotStatus.robotState == R_STATE_SLEEPING && millis() - g_R310_robotStatus.lastActivityTime < G_R310_TIME_TO_SLEEP) { // 구조체 멤버 사용
-        R310_setRobotState(R_STATE_AWAKE); // 변경된 함수명
-    }
-	
-    #ifdef G_R310_BUFFEREDSERIAL_USE	
-    	if (g_R310_BufferedSerial.available()) {
-            String v_commandString = g_R310_BufferedSerial.readStringUntil('\n'); // 변경된 지역변수명
-            v_commandString.trim();
-            Serial.print("Received command: ");
-            Serial.println(v_commandString);
-            R310_processCommand(v_commandString.c_str());
-            g_R310_robotStatus.lastActivityTime = millis(); // 구조체 멤버 사용
-         }
-	#else
-        if (Serial.available()) {
-            String v_commandString = Serial.readStringUntil('\n'); // 변경된 지역변수명
-            v_commandString.trim();
-            Serial.print("Received command: ");
-            Serial.println(v_commandString);
-            R310_processCommand(v_commandString.c_str());
-            g_R310_robotStatus.lastActivityTime = millis(); // 구조체 멤버 사용
+    A02_serialMux_poll(); // 들어온 바이트만 읽음 (명령/원격 표시 프레임을 이번 틱에 바로 반영)
+
+    bool v_isDirty = R310_batch_tick(&g_R310_batch, millis());
+    if (v_isDirty) {
+        R310_batch_present(&g_R310_batch); // 틱에서 바뀐 구간을 한 번의 전송으로
+    }
+    if (v_isDirty || (millis() - g_R310_snapTime) >= G_R310_SNAP_PERIOD_MS) {
+        R310_snap_save(millis()); // 리셋/딥슬립 후 이어서 재생할 상태 (RTC 메모리, 수 us)
+    }
+
+    uint32_t v_due = R310_batch_nextDue(&g_R310_batch, millis());
+    if (g_R310_link.telemetryPeriodMs != 0) { // 호스트 주기 상태 보고
+        uint32_t v_now = millis();
+        if ((int32_t)(v_now - g_R310_link.telemetryTime) >= 0) {
+            R310_sendTelemetry(g_R310_link.telemetryEyesIdx);
+            g_R310_link.telemetryTime += g_R310_link.telemetryPeriodMs;
+            if ((int32_t)(v_now - g_R310_link.telemetryTime) >= 0) g_R310_link.telemetryTime = v_now + g_R310_link.telemetryPeriodMs; // 밀린 보고는 건너뜀
         }
-	#endif
-    delay(1);
+        if ((int32_t)(g_R310_link.telemetryTime - v_due) < 0) v_due = g_R310_link.telemetryTime;
+    }
+
+    // 다음 이벤트까지 대기 (시리얼 수신 시 알림으로 바로 깨어남, 처리할 입력이 남아 있으면 대기하지 않음)
+    if (!A02_serialMux_hasPending()) R310_sched_waitUntil(v_due);
 }
 
 // R310_clearText 함수
-void R310_clearText() {
-    g_R310_textDisplay.buffer[0] = '\0'; // 구조체 멤버 사용
+void R310_clearText(T_R310_Eyes_t* p_eyes) {
+    p_eyes->textDisplay.buffer[0] = '\0'; // 구조체 멤버 사용
 }
 
-// R310_showText 함수
-void R310_showText(bool p_bInit) {
-    if (g_R310_textDisplay.pointer_buf == nullptr || g_R310_textDisplay.buffer[0] == '\0') { // 구조체 멤버 사용
-         R310_clearText();
-         g_R310_aniControl.anyPly_State = ANI_PLY_STATE_IDLE; // 구조체 멤버 사용
-         g_R310_robotStatus.lastAnimationTime = millis(); // 구조체 멤버 사용
+// R310_showText 함수 - 텍스트 버퍼를 16x8 캔버스(두 눈 패널)에 가로 스크롤로 표시합니다.
+// @param p_bInit true 이면 스크롤을 처음부터 시작, false 이면 경과 시간만큼 진행 (비블로킹)
+void R310_showText(T_R310_Eyes_t* p_eyes, bool p_bInit) {
+    if (p_eyes->textDisplay.pointer_buf == nullptr || p_eyes->textDisplay.buffer[0] == '\0') { // 구조체 멤버 사용
+         R310_clearText(p_eyes);
+         p_eyes->aniControl.anyPly_State = ANI_PLY_STATE_IDLE; // 구조체 멤버 사용
+         p_eyes->robotStatus.lastAnimationTime = millis(); // 구조체 멤버 사용
          return;
     }
-    FastLED.clear();
-    R310_drawEye(EYE_RIGHT, (uint8_t)g_R310_textDisplay.pointer_buf[0]); // 구조체 멤버 사용
-    if (g_R310_textDisplay.pointer_buf[1] != '\0') { // 구조체 멤버 사용
-        R310_drawEye(EYE_LEFT, (uint8_t)g_R310_textDisplay.pointer_buf[1]); // 구조체 멤버 사용
+    if (p_bInit) {
+        R310_text_begin(&p_eyes->textScroll, p_eyes->textDisplay.pointer_buf, G_R310_TEXT_SCROLL_PPS);
+    } else if (!R310_text_step(&p_eyes->textScroll)) {
+        if (p_eyes->textScroll.isDone) { // 마지막 글자까지 화면을 빠져나감
+            R310_clearText(p_eyes);
+            p_eyes->aniControl.anyPly_State = ANI_PLY_STATE_IDLE;
+            p_eyes->robotStatus.lastAnimationTime = millis();
+        }
+        return;
     }
-    FastLED.show();
+    R310_text_toFrameBuf(&p_eyes->textScroll, &p_eyes->eyeFb);
+    R310_showFrame(p_eyes, &G_R310_DEFAULT_PALETTE);
 }
 
-// R310_processCommand 함수
+// R310_handleSerialLine 함수 - 시리얼 멀티플렉서가 넘겨준 한 줄 (앞뒤 공백 제거됨)
+// 바이너리 프레임으로 온 명령은 호스트 도구가 보낸 것이므로 에코하지 않습니다.
+void R310_handleSerialLine(const char* p_line) {
+    if (!A02_serialMux_isBinary()) {
+        Serial.print("Received command: ");
+        Serial.println(p_line);
+    }
+    R310_processCommand(p_line);
+}
+
+// R310_handleLinkFrame 함수 - 호스트 바이너리 프레임 메시지 (R310_link_001.h)
+void R310_handleLinkFrame(uint8_t p_type, const uint8_t* p_payload, uint16_t p_len) {
+    switch (p_type) {
+        case LINK_MSG_FRAME: { // 원격 표시: 애니메이션을 멈추고 받은 프레임을 그대로 출력
+            if (p_len != G_R310_LINK_FRAME_LEN || p_payload[0] >= g_R310_batch.count) break;
+            uint8_t        v_slot = p_payload[0];
+            T_R310_Eyes_t* v_eyes = g_R310_batch.eyes[v_slot];
+            uint16_t       v_rowSums[G_R310_POWER_ROWS];
+            uint32_t       v_now  = millis();
+
+            R310_link_scatterFrame(&p_payload[1], v_eyes->output.leds, v_rowSums);
+            R310_pwr_updateFromRows(&v_eyes->power, v_rowSums);
+            v_eyes->crossfade.isActive   = false;
+            v_eyes->output.isDirty       = true; // 이번 루프의 R310_batch_tick/present 에서 전송
+            v_eyes->remote.isActive      = true;
+            v_eyes->remote.lastFrameTime = v_now;
+            v_eyes->remote.frames++;
+            g_R310_batch.activityTime[v_slot] = v_now; // 원격 표시 중에는 잠들지 않음
+            return;
+        }
+        case LINK_MSG_GLYPH: { // 글리프 교체 (DRAM 핫 테이블, 다음에 그 글리프를 그리는 프레임부터 반영)
+            if (!g_R310_hot.isReady || p_len != 1 + sizeof(g_R310_hot.glyphs[0]) || p_payload[0] >= G_R310_ROBOT_EYES_FONT_LEN) break;
+            memcpy(g_R310_hot.glyphs[p_payload[0]], &p_payload[1], sizeof(g_R310_hot.glyphs[0]));
+            for (uint8_t v_i = 0; v_i < g_R310_batch.count; v_i++) R310_invalidateFrame(g_R310_batch.eyes[v_i]);
+            return;
+        }
+        case LINK_MSG_TELEMETRY: { // 상태 요청 (+ 주기 보고 설정)
+            uint8_t v_eyesIdx;
+            if (!R310_link_parseTelemetryReq(p_payload, p_len, g_R310_batch.count, &v_eyesIdx)) break;
+            R310_sendTelemetry(v_eyesIdx);
+            return;
+        }
+        default:
+            break;
+    }
+    g_R310_link.errors++;
+}
+
+// R310_sendTelemetry 함수 - 인스턴스 상태와 링크 통계를 호스트로 보냅니다. (송신 버퍼가 모자라면 건너뜀)
+void R310_sendTelemetry(uint8_t p_eyesIdx) {
+    const T_R310_Eyes_t*     v_eyes = g_R310_batch.eyes[p_eyesIdx];
+    const T_A02_SerialMux_t* v_mux  = &g_A02_serialMux;
+    T_R310_Link_Telemetry_t  v_tm;
+
+    v_tm.uptimeMs        = millis();
+    v_tm.eyesIdx         = p_eyesIdx;
+    v_tm.robotState      = (uint8_t)v_eyes->robotStatus.robotState;
+    v_tm.emotionIdx      = (uint8_t)v_eyes->aniControl.emotionIdx_current;
+    v_tm.isRemote        = v_eyes->remote.isActive ? 1 : 0;
+    v_tm.brightness      = v_eyes->power.appliedBrightness;
+    v_tm.pendingCmds     = v_eyes->cmdQueue.listCount;
+    v_tm.framesSent      = v_eyes->showState.framesSent;
+    v_tm.framesSkipped   = v_eyes->showState.framesSkipped;
+    v_tm.remoteFrames    = v_eyes->remote.frames;
+    v_tm.rxBytes         = v_mux->bytes;
+    v_tm.rxFramesOk      = v_mux->framesOk;
+    v_tm.rxFramesBad     = v_mux->framesBad;
+    v_tm.rxSeqGaps       = v_mux->seqGaps;
+    v_tm.rxDropsOverlong = v_mux->dropsOverlong;
+    v_tm.linkErrors      = g_R310_link.errors;
+    A02_serialMux_sendFrame(LINK_MSG_TELEMETRY, (const uint8_t*)&v_tm, sizeof(v_tm));
+}
+
+// R310_processCommand 함수 - 시리얼 명령을 인스턴스에 전달합니다.
+// "N:명령" 형식이면 N 번 인스턴스에만, 접두사가 없으면 모든 인스턴스에 적용합니다. (예: "1:angry")
 void R310_processCommand(const char* p_command) {
-    R310_clearText();
-
-    // ... (기존 strcmp를 통한 명령 처리 로직 동일) ...
-    // 단, R310_set_RobotState -> R310_setRobotState 로 함수명 변경
-    // R310_set_RobotState(R_STATE_AWAKE); -> R310_setRobotState(R_STATE_AWAKE);
-	// 명령 문자열에 따라 애니메이션 설정
-    if (strcmp(p_command, "neutral") == 0) {
-        R310_setAnimation(EMT_NEUTRAL, EMTP_AUTO_REVERSE_ON, EMTP_PLY_DIR_FIRST, EMTP_FORCE_PLY_ON);
-    } else if (strcmp(p_command, "blink") == 0) {
-        R310_setAnimation(EMT_BLINK, EMTP_AUTO_REVERSE_ON, EMTP_PLY_DIR_FIRST, EMTP_FORCE_PLY_ON);
-    
-    } else if (strcmp(p_command, "wink") == 0) {
-        R310_setAnimation(EMT_WINK, EMTP_AUTO_REVERSE_ON, EMTP_PLY_DIR_FIRST, EMTP_FORCE_PLY_ON);
-
-    } else if (strcmp(p_command, "left") == 0) {
-        R310_setAnimation(EMT_LOOK_L, EMTP_AUTO_REVERSE_ON, EMTP_PLY_DIR_FIRST, EMTP_FORCE_PLY_ON);
-    } else if (strcmp(p_command, "right") == 0) {
-        R310_setAnimation(EMT_LOOK_R, EMTP_AUTO_REVERSE_ON, EMTP_PLY_DIR_FIRST, EMTP_FORCE_PLY_ON);
-    } else if (strcmp(p_command, "up") == 0) {
-        R310_setAnimation(EMT_LOOK_U, EMTP_AUTO_REVERSE_ON, EMTP_PLY_DIR_FIRST, EMTP_FORCE_PLY_ON);
-    } else if (strcmp(p_command, "down") == 0) {
-        R310_setAnimation(EMT_LOOK_D, EMTP_AUTO_REVERSE_ON, EMTP_PLY_DIR_FIRST, EMTP_FORCE_PLY_ON);
-    
-    } else if (strcmp(p_command, "updown") == 0) {
-        R310_setAnimation(EMT_SCAN_UD, EMTP_AUTO_REVERSE_ON, EMTP_PLY_DIR_FIRST, EMTP_FORCE_PLY_ON);
-    } else if (strcmp(p_command, "leftright") == 0) {
-        R310_setAnimation(EMT_SCAN_LR, EMTP_AUTO_REVERSE_ON, EMTP_PLY_DIR_FIRST, EMTP_FORCE_PLY_ON);
-	} else if (strcmp(p_command, "angry") == 0) {
-        R310_setAnimation(EMT_ANGRY2, EMTP_AUTO_REVERSE_ON, EMTP_PLY_DIR_FIRST, EMTP_FORCE_PLY_ON);
-	} else if (strcmp(p_command, "smile") == 0) {
-        R310_setAnimation(EMT_SMILE, EMTP_AUTO_REVERSE_ON, EMTP_PLY_DIR_FIRST, EMTP_FORCE_PLY_ON);
-	} else if (strcmp(p_command, "sleep") == 0) { // 잠자는 애니메이션 명시적 실행
-        R310_setAnimation(EMT_SLEEP, EMTP_AUTO_REVERSE_ON, EMTP_PLY_DIR_FIRST, EMTP_FORCE_PLY_ON);
-	} else if (strcmp(p_command, "sleepblink") == 0) { // 잠자는 애니메이션 명시적 실행
-        R310_setAnimation(EMT_SLEEP_BLINK, EMTP_AUTO_REVERSE_ON, EMTP_PLY_DIR_FIRST, EMTP_FORCE_PLY_ON);
-    }
-	
-    // 로봇 상태 직접 변경 명령
-    else if (strcmp(p_command, "awake") == 0) {
-        R310_setRobotState(R_STATE_AWAKE);
-    } else if (strcmp(p_command, "sleeping") == 0) {
-        R310_setRobotState(R_STATE_SLEEPING);
-    }
-
-    else {
-        strncpy(g_R310_textDisplay.buffer, p_command, G_R310_MAX_TEXT_LENGTH); // 구조체 멤버 사용
-        g_R310_textDisplay.buffer[G_R310_MAX_TEXT_LENGTH] = '\0'; // 구조체 멤버 사용
-        g_R310_aniControl.anyPly_State = ANI_PLY_STATE_TEXT; // 구조체 멤버 사용
+    uint8_t v_first = 0;
+    uint8_t v_last  = g_R310_batch.count;
+
+    if (p_command[0] >= '0' && p_command[0] <= '9' && p_command[1] == ':') {
+        v_first = p_command[0] - '0';
+        if (v_first >= g_R310_batch.count) {
+            Serial.print("Error: Invalid eyes instance: ");
+            Serial.println(v_first);
+            return;
+        }
+        v_last     = v_first + 1;
+        p_command += 2;
+    }
+
+    for (uint8_t v_i = v_first; v_i < v_last; v_i++) {
+        R310_applyCommand(g_R310_batch.eyes[v_i], p_command);
+        R310_batch_wake(&g_R310_batch, v_i, true); // 명령은 활동으로 간주 (잠들기 타이머 재시작)
+    }
+}
+
+// R310_applyCommand 함수 - 명령 하나를 인스턴스에 적용합니다.
+// 첫 토큰을 완전 해시 표(R310_cmdDispatch_001.h)로 찾아 분기하며, 표에 없는 문자열은 텍스트로 표시합니다.
+// 애니메이션/오버레이 명령은 "x<N>" 반복과 "speed <배율>" 옵션을 받습니다. (예: "blink x3 speed 2", "look 30 -20")
+void R310_applyCommand(T_R310_Eyes_t* p_eyes, const char* p_command) {
+    // 애니메이션 요청의 병합 방식 접두사: "+smile" 은 현재 재생이 끝난 뒤 순서대로, "?smile" 은 재생 중이면 버림
+    T_R310_CmdQ_Mode_t v_mode = CMDQ_REPLACE;
+    if (p_command[0] == '+') {
+        v_mode = CMDQ_APPEND;
+        p_command++;
+    } else if (p_command[0] == '?') {
+        v_mode = CMDQ_DROP_IF_BUSY;
+        p_command++;
+    }
+
+    T_R310_CmdArgs_t v_args;
+    T_R310_CmdOpts_t v_opts;
+    uint8_t          v_cmdId = (R310_cmd_tokenize(p_command, &v_args) > 0) ? R310_cmd_lookup(&v_args.tok[0]) : CMD_NONE;
+    R310_cmd_parseOpts(&v_args, &v_opts);
+
+    switch (v_cmdId) {
+        // 기본 표정 (요청 큐를 거쳐 재생)
+        case CMD_NEUTRAL:    R310_requestAnimation(p_eyes, EMT_NEUTRAL, EMTP_AUTO_REVERSE_ON, v_mode, &v_opts); break;
+        case CMD_BLINKSEQ:   R310_requestAnimation(p_eyes, EMT_BLINK, EMTP_AUTO_REVERSE_ON, v_mode, &v_opts); break;     // 기존 깜빡임 시퀀스 (기본 트랙)
+        case CMD_WINKSEQ:    R310_requestAnimation(p_eyes, EMT_WINK, EMTP_AUTO_REVERSE_ON, v_mode, &v_opts); break;
+        case CMD_LEFT:       R310_requestAnimation(p_eyes, EMT_LOOK_L, EMTP_AUTO_REVERSE_ON, v_mode, &v_opts); break;
+        case CMD_RIGHT:      R310_requestAnimation(p_eyes, EMT_LOOK_R, EMTP_AUTO_REVERSE_ON, v_mode, &v_opts); break;
+        case CMD_UP:         R310_requestAnimation(p_eyes, EMT_LOOK_U, EMTP_AUTO_REVERSE_ON, v_mode, &v_opts); break;
+        case CMD_DOWN:       R310_requestAnimation(p_eyes, EMT_LOOK_D, EMTP_AUTO_REVERSE_ON, v_mode, &v_opts); break;
+        case CMD_UPDOWN:     R310_requestAnimation(p_eyes, EMT_SCAN_UD, EMTP_AUTO_REVERSE_ON, v_mode, &v_opts); break;
+        case CMD_LEFTRIGHT:  R310_requestAnimation(p_eyes, EMT_SCAN_LR, EMTP_AUTO_REVERSE_ON, v_mode, &v_opts); break;
+        case CMD_ANGRY:      R310_requestAnimation(p_eyes, EMT_ANGRY2, EMTP_AUTO_REVERSE_ON, v_mode, &v_opts); break;
+        case CMD_SMILE:      R310_requestAnimation(p_eyes, EMT_SMILE, EMTP_AUTO_REVERSE_ON, v_mode, &v_opts); break;
+        case CMD_SLEEP:      R310_requestAnimation(p_eyes, EMT_SLEEP, EMTP_AUTO_REVERSE_ON, v_mode, &v_opts); break;        // 잠자는 애니메이션 명시적 실행
+        case CMD_SLEEPBLINK: R310_requestAnimation(p_eyes, EMT_SLEEP_BLINK, EMTP_AUTO_REVERSE_ON, v_mode, &v_opts); break;
+        case CMD_ANGRYCOLOR: R310_requestAnimation(p_eyes, EMT_ANGRY_COLOR, EMTP_AUTO_REVERSE_ON, v_mode, &v_opts); break;  // 2bpp 컬러 글리프 화남
+        case CMD_PROCLOOK:   R310_requestAnimation(p_eyes, EMT_PROC_LOOK, EMTP_AUTO_REVERSE_OFF, v_mode, &v_opts); break;   // 절차적 눈 둘러보기
+        case CMD_PROCANGRY:  R310_requestAnimation(p_eyes, EMT_PROC_ANGRY, EMTP_AUTO_REVERSE_ON, v_mode, &v_opts); break;   // 절차적 눈 화남
+
+        // 오버레이 트랙 (현재 표정 위에 겹쳐 재생)
+        case CMD_BLINK:
+            R310_playOverlay(p_eyes, TL_TRACK_LID, g_R310_tlClip_Blink, sizeof(g_R310_tlClip_Blink) / sizeof(T_R310_tl_Key_t), &v_opts);
+            break;
+        case CMD_WINK:
+            R310_playOverlay(p_eyes, TL_TRACK_LID, g_R310_tlClip_Wink, sizeof(g_R310_tlClip_Wink) / sizeof(T_R310_tl_Key_t), &v_opts);
+            break;
+        case CMD_DROWSY: // 반쯤 감은 눈 유지 (다시 입력하면 해제)
+            if (!R310_tl_stop(&p_eyes->timeline, TL_TRACK_LID, G_R310_TL_PRIO_COMMAND)) {
+                R310_tl_play(&p_eyes->timeline, TL_TRACK_LID, g_R310_tlClip_Drowsy, sizeof(g_R310_tlClip_Drowsy) / sizeof(T_R310_tl_Key_t), G_R310_TL_PRIO_COMMAND, millis(), 1, v_opts.speedQ8);
+            }
+            R310_refreshOverlay(p_eyes);
+            break;
+        case CMD_GLANCE:
+            R310_playOverlay(p_eyes, TL_TRACK_PUPIL, g_R310_tlClip_Glance, sizeof(g_R310_tlClip_Glance) / sizeof(T_R310_tl_Key_t), &v_opts);
+            break;
+
+        // 시선 각도 ("look <yaw> <pitch>", 인자 없으면 정면)
+        case CMD_LOOK:
+            if (R310_gaze_isSettled(&p_eyes->gaze)) p_eyes->gaze.lastStepTime = millis() - G_R310_GAZE_REFRESH_MS; // 쉬던 시간만큼 한 번에 적분하지 않도록
+            R310_gaze_setLook(&p_eyes->gaze, R310_cmd_argInt(&v_args, 1, 0), R310_cmd_argInt(&v_args, 2, 0));
+            break;
+
+        // 로봇 상태 직접 변경 명령 (잠들기/깨기 시퀀스가 화면을 바꾸므로 텍스트도 끊음)
+        case CMD_AWAKE:
+            if (v_mode == CMDQ_REPLACE) R310_clearText(p_eyes);
+            R310_setRobotState(p_eyes, R_STATE_AWAKE);
+            break;
+        case CMD_SLEEPING:
+            if (v_mode == CMDQ_REPLACE) R310_clearText(p_eyes);
+            R310_setRobotState(p_eyes, R_STATE_SLEEPING);
+            break;
+
+        // 화면 출력 통계 (출력/생략 프레임 수)
+        case CMD_FRAMESTATS:
+            R310_printFrameStats(p_eyes);
+            R310_ledOut_printStats();
+            R310_pwr_printStats(&p_eyes->power);
+            R310_sched_printStats();
+            R310_cmdq_printStats(&p_eyes->cmdQueue);
+            A02_serialMux_printStats();
+            break;
+
+        // 외부 클립 뱅크: 목록, 다시 마운트(업로드 후), 이름으로 재생
+        case CMD_CLIPS:
+            R310_clip_printList();
+            break;
+        case CMD_CLIPLOAD:
+            R310_clip_mount();
+            R310_clip_printList();
+            break;
+        case CMD_CLIP: {
+            char   v_name[G_R310_CLIP_NAME_LEN + 2] = "";
+            int8_t v_slot = -1;
+            if (v_args.count > 1 && v_args.tok[1].len <= G_R310_CLIP_NAME_LEN) {
+                memcpy(v_name, v_args.tok[1].str, v_args.tok[1].len);
+                v_name[v_args.tok[1].len] = '\0';
+                v_slot = R310_clip_findByName(v_name);
+            }
+            if (v_slot < 0) {
+                Serial.print("Unknown clip: ");
+                if (v_args.count > 1) Serial.write((const uint8_t*)v_args.tok[1].str, v_args.tok[1].len); // 토큰은 종료 문자가 없으므로 길이만큼
+                Serial.println();
+                break;
+            }
+            T_R310_emotion_idx_t v_emotionIdx = (T_R310_emotion_idx_t)g_R310_clipBank.index[v_slot].emotionIdx;
+            R310_requestAnimation(p_eyes, (v_emotionIdx != EMT_NONE) ? v_emotionIdx : EMT_NEUTRAL, EMTP_AUTO_REVERSE_ON, v_mode, &v_opts, v_slot);
+            break;
+        }
+
+        // 시선 오버레이 켜기/끄기
+        case CMD_GAZE:
+            p_eyes->gaze.isEnabled = !p_eyes->gaze.isEnabled;
+            Serial.println(p_eyes->gaze.isEnabled ? "Gaze overlay: ON" : "Gaze overlay: OFF");
+            R310_showFrame(p_eyes, (p_eyes->aniControl.anyPly_State == ANI_PLY_STATE_TEXT) ? &G_R310_DEFAULT_PALETTE : &p_eyes->palette); // 마퀴는 기본 팔레트
+            break;
+
+        // 사용자 밝기 변경 ("bright 0~255", 전류 예산을 넘으면 자동으로 낮춰 표시)
+        case CMD_BRIGHT:
+            p_eyes->power.userBrightness = (uint8_t)constrain((int)R310_cmd_argInt(&v_args, 1, 0), 0, 255);
+            R310_invalidateFrame(p_eyes);
+            R310_showFrame(p_eyes, (p_eyes->aniControl.anyPly_State == ANI_PLY_STATE_TEXT) ? &G_R310_DEFAULT_PALETTE : &p_eyes->palette); // 마퀴는 기본 팔레트
+            break;
+
+        default: // 명령이 아니면 텍스트 마퀴 (표시 중인 텍스트를 새 텍스트로 바꿈)
+            strncpy(p_eyes->textDisplay.buffer, p_command, G_R310_MAX_TEXT_LENGTH); // 구조체 멤버 사용
+            p_eyes->textDisplay.buffer[G_R310_MAX_TEXT_LENGTH] = '\0'; // 구조체 멤버 사용
+            p_eyes->aniControl.anyPly_State = ANI_PLY_STATE_TEXT; // 구조체 멤버 사용
+            R310_showText(p_eyes, true); // 마퀴 시작
+            break;
     }
 }
@@ -0,0 +1,127 @@
+#pragma once
+
+// R310_palette_001.h - 2bpp(4색) 팔레트 글리프 및 감정별 팔레트 데이터
+// 글리프 한 행은 uint16_t 하나(열당 2비트)로, 8x8 글리프 하나가 16바이트입니다. (RGB 비트맵 대비 1/12 크기)
+// 픽셀 값은 팔레트 인덱스입니다: 0 = 배경(꺼짐), 1 = 외곽선/기본, 2 = 눈동자, 3 = 하이라이트
+// 1bpp 글리프도 팔레트 인덱스 1로 그려지므로, 감정별 팔레트만으로 기존 눈 모양에 색을 입힐 수 있습니다.
+
+#include "R310_config_009.h"
+#include "R310_data2_014.h"
+
+// 팔레트 (인덱스 0~3 의 색상)
+typedef struct {
+    CRGB color[4];
+} T_R310_Palette_t;
+
+// 감정별 팔레트 조회 테이블 항목
+typedef struct {
+    T_R310_emotion_idx_t    emotionIdx;     // 감정 종류
+    T_R310_Palette_t        palette;        // 해당 감정의 팔레트
+} T_R310_EmotionPalette_t;
+
+// 2bpp 글리프 (행당 uint16_t, 열 0 이 최상위 2비트)
+typedef struct {
+    uint16_t rows[8];
+} T_R310_FontChar2bpp_t;
+
+
+// 두 개의 1bpp 비트 평면을 2bpp 행 하나로 묶습니다. (글리프 작성용, 컴파일 타임 계산)
+// @param p_lo 팔레트 인덱스 bit0 평면 (외곽선)
+// @param p_hi 팔레트 인덱스 bit1 평면 (눈동자), 두 평면이 겹치면 인덱스 3 (하이라이트)
+constexpr uint16_t R310_pal_packRow(uint8_t p_lo, uint8_t p_hi) {
+    uint16_t v_row = 0;
+    for (uint8_t v_col = 0; v_col < 8; v_col++) {
+        uint16_t v_idx = (uint16_t)(((p_lo >> (7 - v_col)) & 0x01) | (((p_hi >> (7 - v_col)) & 0x01) << 1));
+        v_row |= (uint16_t)(v_idx << (14 - v_col * 2));
+    }
+    return v_row;
+}
+
+
+// 기본 팔레트 (감정별 팔레트가 없을 때 사용, 기존 단색 눈과 동일)
+const T_R310_Palette_t G_R310_DEFAULT_PALETTE = {{ CRGB(0, 0, 0), CRGB(G_R310_EYE_COLOR), CRGB(0, 120, 255), CRGB(255, 255, 255) }};
+
+// 감정별 팔레트 테이블 (등록되지 않은 감정은 G_R310_DEFAULT_PALETTE)
+const T_R310_EmotionPalette_t g_R310_emotionPalette_arr[] PROGMEM = {
+    //  감정               배경              외곽선/기본            눈동자               하이라이트
+    {EMT_ANGRY2       , {{ CRGB(0, 0, 0), CRGB(255,   0,   0), CRGB(255,  80,   0), CRGB(255, 200,   0) }}}, // 화남: 빨강
+    {EMT_ANGRY_COLOR  , {{ CRGB(0, 0, 0), CRGB(255,   0,   0), CRGB(255,  80,   0), CRGB(255, 200,   0) }}}, // 화남: 빨강
+    {EMT_PROC_ANGRY   , {{ CRGB(0, 0, 0), CRGB(255,   0,   0), CRGB(255,  80,   0), CRGB(255, 200,   0) }}}, // 화남: 빨강
+    {EMT_SLEEP        , {{ CRGB(0, 0, 0), CRGB(  0,  40, 255), CRGB(  0,   0, 120), CRGB( 80,  80, 255) }}}, // 졸림: 파랑
+    {EMT_SLEEP_BLINK  , {{ CRGB(0, 0, 0), CRGB(  0,  40, 255), CRGB(  0,   0, 120), CRGB( 80,  80, 255) }}}, // 졸림: 파랑
+};
+
+
+// 2bpp 로봇 눈 글리프 (T_R310_EyeFont2bppIndex_t 순서)
+const T_R310_FontChar2bpp_t g_R310_RobotEyes_Font2bpp_arr[] PROGMEM = {
+    // EYE2_NEUTRAL (외곽선 + 눈동자 + 하이라이트)
+    {{
+        R310_pal_packRow(0b00000000, 0b00000000), // . . . . . . . .
+        R310_pal_packRow(0b00111100, 0b00000000), // . . 1 1 1 1 . .
+        R310_pal_packRow(0b01000010, 0b00111100), // . 1 2 2 2 2 1 .
+        R310_pal_packRow(0b01010010, 0b00111100), // . 1 2 3 2 2 1 .
+        R310_pal_packRow(0b01000010, 0b00111100), // . 1 2 2 2 2 1 .
+        R310_pal_packRow(0b01000010, 0b00111100), // . 1 2 2 2 2 1 .
+        R310_pal_packRow(0b00111100, 0b00000000), // . . 1 1 1 1 . .
+        R310_pal_packRow(0b00000000, 0b00000000)  // . . . . . . . .
+    }},
+
+    // EYE2_ANGRY_RIGHT (바깥쪽이 내려간 눈꺼풀)
+    {{
+        R310_pal_packRow(0b11100000, 0b00000000), // 1 1 1 . . . . .
+        R310_pal_packRow(0b01111000, 0b00000000), // . 1 1 1 1 . . .
+        R310_pal_packRow(0b01000110, 0b00111000), // . 1 2 2 2 1 1 .
+        R310_pal_packRow(0b01010010, 0b00111100), // . 1 2 3 2 2 1 .
+        R310_pal_packRow(0b01000010, 0b00111100), // . 1 2 2 2 2 1 .
+        R310_pal_packRow(0b01000010, 0b00111100), // . 1 2 2 2 2 1 .
+        R310_pal_packRow(0b00111100, 0b00000000), // . . 1 1 1 1 . .
+        R310_pal_packRow(0b00000000, 0b00000000)  // . . . . . . . .
+    }},
+
+    // EYE2_ANGRY_LEFT (EYE2_ANGRY_RIGHT 좌우 대칭)
+    {{
+        R310_pal_packRow(0b00000111, 0b00000000), // . . . . . 1 1 1
+        R310_pal_packRow(0b00011110, 0b00000000), // . . . 1 1 1 1 .
+        R310_pal_packRow(0b01100010, 0b00011100), // . 1 1 2 2 2 1 .
+        R310_pal_packRow(0b01001010, 0b00111100), // . 1 2 2 3 2 1 .
+        R310_pal_packRow(0b01000010, 0b00111100), // . 1 2 2 2 2 1 .
+        R310_pal_packRow(0b01000010, 0b00111100), // . 1 2 2 2 2 1 .
+        R310_pal_packRow(0b00111100, 0b00000000), // . . 1 1 1 1 . .
+        R310_pal_packRow(0b00000000, 0b00000000)  // . . . . . . . .
+    }},
+
+    // EYE2_SLEEPY (반쯤 감긴 눈)
+    {{
+        R310_pal_packRow(0b00000000, 0b00000000), // . . . . . . . .
+        R310_pal_packRow(0b00000000, 0b00000000), // . . . . . . . .
+        R310_pal_packRow(0b00000000, 0b00000000), // . . . . . . . .
+        R310_pal_packRow(0b01111110, 0b00000000), // . 1 1 1 1 1 1 .
+        R310_pal_packRow(0b01000010, 0b00111100), // . 1 2 2 2 2 1 .
+        R310_pal_packRow(0b01000010, 0b00111100), // . 1 2 2 2 2 1 .
+        R310_pal_packRow(0b00111100, 0b00000000), // . . 1 1 1 1 . .
+        R310_pal_packRow(0b00000000, 0b00000000)  // . . . . . . . .
+    }},
+};
+
+// 2bpp 글리프 개수
+const int G_R310_ROBOT_EYES_FONT2BPP_LEN = sizeof(g_R310_RobotEyes_Font2bpp_arr) / sizeof(T_R310_FontChar2bpp_t);
+
+static_assert(R310_ani_isGlyphValid(G_R310_ROBOT_EYES_FONT_LEN, G_R310_ROBOT_EYES_FONT2BPP_LEN), "g_R310_ani_Tables_arr: 프레임의 글리프 인덱스가 폰트 범위를 벗어납니다");
+
+static_assert(sizeof(T_R310_FontChar2bpp_t) == 16, "2bpp 8x8 글리프는 16바이트여야 합니다");
+
+
+// 감정에 해당하는 팔레트를 읽어옵니다. 등록되지 않은 감정이면 기본 팔레트.
+// @param p_emotionIdx 감정 종류
+// @param p_palette 결과 팔레트
+void R310_pal_loadEmotionPalette(T_R310_emotion_idx_t p_emotionIdx, T_R310_Palette_t* p_palette) {
+    for (uint8_t v_i = 0; v_i < G_R310_ARRAY_SIZE(g_R310_emotionPalette_arr); v_i++) {
+        T_R310_EmotionPalette_t v_entry;
+        memcpy_P(&v_entry, &g_R310_emotionPalette_arr[v_i], sizeof(T_R310_EmotionPalette_t));
+        if (v_entry.emotionIdx == p_emotionIdx) {
+            *p_palette = v_entry.palette;
+            return;
+        }
+    }
+    *p_palette = G_R310_DEFAULT_PALETTE;
+}
@@ -0,0 +1,120 @@
+#pragma once
+
+// R310_pixelMap_001.h - 패널 배선(지오메트리) 템플릿 및 컴파일 타임 픽셀 인덱스 LUT
+// (눈, 행, 열) 좌표를 g_R310_leds 선형 인덱스로 바꾸는 계산을 컴파일 시점에 표로 만들어 두고,
+// 그리기 경로에서는 테이블 1회 로드만 수행합니다. 범위 검사는 static_assert로 빌드 시점에 끝납니다.
+
+#include "R310_config_009.h"
+
+// 패널 내부 픽셀 배선 순서
+typedef enum {
+    R310_PANEL_ORDER_PROGRESSIVE,   // 모든 행이 같은 방향으로 배선 (행 우선)
+    R310_PANEL_ORDER_SERPENTINE,    // 짝수 행 정방향, 홀수 행 역방향 (지그재그)
+} T_R310_PanelOrder_t;
+
+// 패널 장착 회전 (논리 좌표 기준 시계 방향)
+typedef enum {
+    R310_PANEL_ROT_0,
+    R310_PANEL_ROT_90,
+    R310_PANEL_ROT_180,
+    R310_PANEL_ROT_270,
+} T_R310_PanelRotation_t;
+
+
+// 패널 하나의 지오메트리 (크기, 배선 순서, 회전)
+// offset()은 논리 좌표(행, 열)를 패널 내부 픽셀 오프셋(0 ~ W*H-1)으로 변환합니다.
+template <uint8_t W, uint8_t H, T_R310_PanelOrder_t ORDER, T_R310_PanelRotation_t ROT>
+struct T_R310_PanelGeometry_t {
+    static constexpr uint8_t  WIDTH  = W;
+    static constexpr uint8_t  HEIGHT = H;
+    static constexpr uint16_t PIXELS = (uint16_t)W * H;
+
+    static_assert(W > 0 && H > 0, "패널 크기는 0보다 커야 합니다");
+    static_assert(ROT == R310_PANEL_ROT_0 || ROT == R310_PANEL_ROT_180 || W == H, "90/270도 회전은 정사각 패널만 지원합니다");
+
+    static constexpr uint16_t offset(uint8_t p_row, uint8_t p_col) {
+        uint8_t v_row = p_row;
+        uint8_t v_col = p_col;
+
+        // 회전: 논리 좌표 -> 물리 좌표
+        switch (ROT) {
+            case R310_PANEL_ROT_90:
+                v_row = p_col;
+                v_col = (uint8_t)(H - 1 - p_row);
+                break;
+            case R310_PANEL_ROT_180:
+                v_row = (uint8_t)(H - 1 - p_row);
+                v_col = (uint8_t)(W - 1 - p_col);
+                break;
+            case R310_PANEL_ROT_270:
+                v_row = (uint8_t)(W - 1 - p_col);
+                v_col = p_row;
+                break;
+            default:
+                break;
+        }
+
+        // 지그재그 배선이면 홀수 행은 역방향
+        if (ORDER == R310_PANEL_ORDER_SERPENTINE && (v_row & 0x01)) {
+            v_col = (uint8_t)(W - 1 - v_col);
+        }
+        return (uint16_t)(v_row * W + v_col);
+    }
+};
+
+
+// 패널 체인 전체의 픽셀 인덱스 LUT ([패널][행][열] -> 선형 인덱스)
+template <class GEOM, uint8_t N_PANELS>
+struct T_R310_PixelLut_t {
+    uint16_t idx[N_PANELS][GEOM::HEIGHT][GEOM::WIDTH];
+};
+
+// 패널별 시작 픽셀(G_R310_RIGHT_EYE_START_PIXEL 등)로부터 LUT를 생성합니다. (constexpr 전용)
+template <class GEOM, uint8_t N_PANELS>
+constexpr T_R310_PixelLut_t<GEOM, N_PANELS> R310_buildPixelLut(const uint16_t (&p_startPixel)[N_PANELS]) {
+    T_R310_PixelLut_t<GEOM, N_PANELS> v_lut{};
+    for (uint8_t v_panel = 0; v_panel < N_PANELS; v_panel++) {
+        for (uint8_t v_row = 0; v_row < GEOM::HEIGHT; v_row++) {
+            for (uint8_t v_col = 0; v_col < GEOM::WIDTH; v_col++) {
+                v_lut.idx[v_panel][v_row][v_col] = (uint16_t)(p_startPixel[v_panel] + GEOM::offset(v_row, v_col));
+            }
+        }
+    }
+    return v_lut;
+}
+
+// LUT 내 최대 인덱스 (static_assert 범위 검사용)
+template <class GEOM, uint8_t N_PANELS>
+constexpr uint16_t R310_pixelLutMax(const T_R310_PixelLut_t<GEOM, N_PANELS>& p_lut) {
+    uint16_t v_max = 0;
+    for (uint8_t v_panel = 0; v_panel < N_PANELS; v_panel++)
+        for (uint8_t v_row = 0; v_row < GEOM::HEIGHT; v_row++)
+            for (uint8_t v_col = 0; v_col < GEOM::WIDTH; v_col++)
+                if (p_lut.idx[v_panel][v_row][v_col] > v_max) v_max = p_lut.idx[v_panel][v_row][v_col];
+    return v_max;
+}
+
+// 두 패널이 같은 LED를 가리키지 않는지 검사 (시작 픽셀 설정 실수 방지)
+template <class GEOM, uint8_t N_PANELS>
+constexpr bool R310_pixelLutIsUnique(const T_R310_PixelLut_t<GEOM, N_PANELS>& p_lut) {
+    const uint16_t v_count = (uint16_t)N_PANELS * GEOM::PIXELS;
+    for (uint16_t v_i = 0; v_i < v_count; v_i++) {
+        const uint16_t v_a = p_lut.idx[v_i / GEOM::PIXELS][(v_i % GEOM::PIXELS) / GEOM::WIDTH][v_i % GEOM::WIDTH];
+        for (uint16_t v_j = v_i + 1; v_j < v_count; v_j++) {
+            if (v_a == p_lut.idx[v_j / GEOM::PIXELS][(v_j % GEOM::PIXELS) / GEOM::WIDTH][v_j % GEOM::WIDTH]) return false;
+        }
+    }
+    return true;
+}
+
+
+// --- 로봇 눈 패널 체인 (오른쪽 눈, 왼쪽 눈) ---
+typedef T_R310_PanelGeometry_t<G_R310_EYE_COL_SIZE, G_R310_DISPLAY_HEIGHT, G_R310_PANEL_ORDER, G_R310_PANEL_ROTATION> T_R310_EyePanel_t;
+
+// 패널 시작 픽셀 (T_R310_EyeSide_Idx_t 순서: EYE_RIGHT, EYE_LEFT)
+constexpr uint16_t G_R310_EYE_START_PIXELS[] = { G_R310_RIGHT_EYE_START_PIXEL, G_R310_LEFT_EYE_START_PIXEL };
+
+constexpr T_R310_PixelLut_t<T_R310_EyePanel_t, 2> G_R310_HOT_DATA g_R310_pixelLut = R310_buildPixelLut<T_R310_EyePanel_t, 2>(G_R310_EYE_START_PIXELS);
+
+static_assert(R310_pixelLutMax(g_R310_pixelLut) < G_R310_NEOPIXEL_NUM_LEDS, "픽셀 LUT 인덱스가 G_R310_NEOPIXEL_NUM_LEDS 범위를 벗어납니다");
+static_assert(R310_pixelLutIsUnique(g_R310_pixelLut), "눈 패널 픽셀 영역이 서로 겹칩니다 (시작 픽셀 설정 확인)");
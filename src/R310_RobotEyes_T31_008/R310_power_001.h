@@ -0,0 +1,138 @@
+#pragma once
+
+// R310_power_001.h - LED 전류(전원) 예산 제한기
+// 화면 전체 채널 값(R+G+B) 합을 패널 행 단위로 나누어 들고 있다가, 렌더러가 다시 쓴 행만 차이만큼 갱신합니다.
+// 밝기 상한은 채널 합 -> 최대 밝기 테이블(컴파일 타임 생성)을 한 번 조회해서 구하므로,
+// show() 마다 전체 LED를 다시 훑지 않습니다. (WS2812 전류 모델: 채널당 최대 20mA + LED당 대기 1mA)
+
+#include "R310_config_009.h"
+#include "R310_frameBuf_001.h"
+#include "R310_palette_001.h"
+
+#define G_R310_POWER_MA_PER_CHANNEL     20      // 채널 1개 최대 밝기(255) 전류 (mA)
+#define G_R310_POWER_IDLE_MA_PER_LED    1       // LED 1개 대기 전류 (mA)
+#define G_R310_POWER_ROW_PIXELS         G_R310_EYE_COL_SIZE     // 갱신 단위 (패널 한 행)
+#define G_R310_POWER_ROWS               (G_R310_NEOPIXEL_NUM_LEDS / G_R310_POWER_ROW_PIXELS)
+#define G_R310_POWER_MAX_SUM            ((uint32_t)G_R310_NEOPIXEL_NUM_LEDS * 255 * 3)
+
+static_assert(G_R310_NEOPIXEL_NUM_LEDS % G_R310_POWER_ROW_PIXELS == 0, "LED 수는 전원 갱신 행 단위의 배수여야 합니다");
+static_assert(G_R310_POWER_ROWS == 2 * G_R310_DISPLAY_HEIGHT, "프레임버퍼 행(눈 2개 x 높이)과 전원 갱신 행 수가 같아야 합니다");
+static_assert((uint32_t)G_R310_NEOPIXEL_NUM_LEDS * G_R310_POWER_IDLE_MA_PER_LED < G_R310_POWER_BUDGET_MA, "전류 예산이 LED 대기 전류보다 작습니다");
+
+// 채널 합을 테이블 인덱스(0~255)로 줄이는 시프트 (LED 수에 맞춰 컴파일 타임 결정)
+constexpr uint8_t R310_pwr_sumShift() {
+    uint8_t v_shift = 0;
+    while ((G_R310_POWER_MAX_SUM >> v_shift) > 255) v_shift++;
+    return v_shift;
+}
+
+// 채널 합 구간 -> 예산 내 최대 밝기 테이블 (구간 상한 기준으로 보수적으로 계산)
+typedef struct {
+    uint8_t maxBrightness[256];
+} T_R310_PowerTable_t;
+
+constexpr T_R310_PowerTable_t R310_pwr_buildTable() {
+    T_R310_PowerTable_t v_table{};
+    const uint32_t v_drive_mA = G_R310_POWER_BUDGET_MA - (uint32_t)G_R310_NEOPIXEL_NUM_LEDS * G_R310_POWER_IDLE_MA_PER_LED;
+    for (uint16_t v_i = 0; v_i < 256; v_i++) {
+        uint64_t v_sumHi  = ((uint64_t)(v_i + 1) << R310_pwr_sumShift());                   // 구간 최대 채널 합
+        uint64_t v_full   = v_sumHi * G_R310_POWER_MA_PER_CHANNEL;                          // 밝기 255 에서의 전류 x 255
+        uint64_t v_bright = v_full ? ((uint64_t)v_drive_mA * 255 * 255) / v_full : 255;
+        v_table.maxBrightness[v_i] = (uint8_t)(v_bright > 255 ? 255 : v_bright);
+    }
+    return v_table;
+}
+
+constexpr T_R310_PowerTable_t G_R310_HOT_DATA g_R310_pwr_table = R310_pwr_buildTable();
+
+
+// 전원 제한기 상태
+typedef struct {
+    uint32_t    channelSum;                         // 화면 전체 채널 값 합 (R+G+B)
+    uint16_t    rowSum[G_R310_POWER_ROWS];          // 행별 채널 합
+    uint32_t    rowKey[G_R310_POWER_ROWS];          // 프레임버퍼 경로: 행별 마지막 비트 평면 (rows | rowsHi << 패널 너비)
+    uint16_t    palSum[4];                          // 프레임버퍼 경로: 마지막 팔레트 색별 채널 합
+    bool        isKeyValid;                         // rowKey/palSum 유효 여부 (직접 CRGB 를 쓴 뒤에는 false)
+    uint8_t     userBrightness;                     // 사용자 지정 밝기
+    uint8_t     appliedBrightness;                  // 마지막으로 적용한 (제한 후) 밝기
+    uint32_t    limitedFrames;                      // 예산 때문에 밝기를 낮춘 프레임 수
+} T_R310_Power_t;
+
+
+// 제한기 초기화 (화면은 모두 꺼진 상태로 가정)
+void R310_pwr_init(T_R310_Power_t* p_pwr, uint8_t p_userBrightness) {
+    memset(p_pwr, 0, sizeof(T_R310_Power_t));
+    p_pwr->userBrightness    = p_userBrightness;
+    p_pwr->appliedBrightness = p_userBrightness;
+}
+
+// 한 행의 채널 합을 교체하고 전체 합을 차이만큼 갱신합니다.
+void G_R310_HOT_CODE R310_pwr_setRow(T_R310_Power_t* p_pwr, uint8_t p_row, uint16_t p_sum) {
+    p_pwr->channelSum   = p_pwr->channelSum - p_pwr->rowSum[p_row] + p_sum;
+    p_pwr->rowSum[p_row] = p_sum;
+}
+
+// 프레임버퍼 경로: 비트 평면이나 팔레트가 바뀐 행만 다시 계산합니다.
+// 행 채널 합은 팔레트 인덱스별 픽셀 수(popcount) x 팔레트 색 채널 합으로 구하므로 픽셀을 읽지 않습니다.
+void G_R310_HOT_CODE R310_pwr_updateFromFb(T_R310_Power_t* p_pwr, const T_R310_EyeFrameBuf_t* p_fb, const T_R310_Palette_t* p_palette) {
+    uint16_t v_palSum[4];
+    bool     v_palChanged = !p_pwr->isKeyValid;
+    for (uint8_t v_i = 0; v_i < 4; v_i++) {
+        v_palSum[v_i] = (uint16_t)p_palette->color[v_i].r + p_palette->color[v_i].g + p_palette->color[v_i].b;
+        if (v_palSum[v_i] != p_pwr->palSum[v_i]) v_palChanged = true;
+    }
+
+    for (uint8_t v_eye = 0; v_eye < 2; v_eye++) {
+        for (uint8_t v_row = 0; v_row < G_R310_DISPLAY_HEIGHT; v_row++) {
+            uint8_t         v_slot = v_eye * G_R310_DISPLAY_HEIGHT + v_row;
+            T_R310_EyeRow_t v_lo  = p_fb->rows[v_eye][v_row];
+            T_R310_EyeRow_t v_hi  = p_fb->rowsHi[v_eye][v_row];
+            uint32_t        v_key = (uint32_t)v_lo | ((uint32_t)v_hi << G_R310_EYE_COL_SIZE);
+            if (!v_palChanged && v_key == p_pwr->rowKey[v_slot]) continue; // 변경 없는 행
+
+            uint8_t v_n3 = (uint8_t)__builtin_popcount(v_lo & v_hi);
+            uint8_t v_n1 = (uint8_t)__builtin_popcount(v_lo) - v_n3;
+            uint8_t v_n2 = (uint8_t)__builtin_popcount(v_hi) - v_n3;
+            uint8_t v_n0 = (uint8_t)(G_R310_EYE_COL_SIZE - v_n1 - v_n2 - v_n3);
+            R310_pwr_setRow(p_pwr, v_slot, (uint16_t)(v_n0 * v_palSum[0] + v_n1 * v_palSum[1] + v_n2 * v_palSum[2] + v_n3 * v_palSum[3]));
+            p_pwr->rowKey[v_slot] = v_key;
+        }
+    }
+    memcpy(p_pwr->palSum, v_palSum, sizeof(v_palSum));
+    p_pwr->isKeyValid = true;
+}
+
+// 직접 CRGB 경로(크로스페이드 등): 렌더러가 계산한 행별 합을 반영합니다. 프레임버퍼 행 캐시는 무효화됩니다.
+// @param p_rowSums G_R310_POWER_ROWS 개 행 합 (LED 순서 G_R310_POWER_ROW_PIXELS 픽셀 단위)
+void G_R310_HOT_CODE R310_pwr_updateFromRows(T_R310_Power_t* p_pwr, const uint16_t* p_rowSums) {
+    for (uint8_t v_row = 0; v_row < G_R310_POWER_ROWS; v_row++) {
+        if (p_rowSums[v_row] != p_pwr->rowSum[v_row]) R310_pwr_setRow(p_pwr, v_row, p_rowSums[v_row]);
+    }
+    p_pwr->isKeyValid = false;
+}
+
+// 현재 화면을 예산 안에서 표시할 밝기 (사용자 밝기 이하)
+uint8_t G_R310_HOT_CODE R310_pwr_brightness(T_R310_Power_t* p_pwr) {
+    uint8_t v_max = g_R310_pwr_table.maxBrightness[p_pwr->channelSum >> R310_pwr_sumShift()];
+    uint8_t v_bright = p_pwr->userBrightness;
+    if (v_max < v_bright) {
+        v_bright = v_max;
+        p_pwr->limitedFrames++;
+    }
+    p_pwr->appliedBrightness = v_bright;
+    return v_bright;
+}
+
+// 현재 화면을 p_brightness 로 표시할 때의 예상 전류 (mA)
+uint32_t R310_pwr_estimate_mA(const T_R310_Power_t* p_pwr, uint8_t p_brightness) {
+    return (uint32_t)G_R310_NEOPIXEL_NUM_LEDS * G_R310_POWER_IDLE_MA_PER_LED +
+           (uint32_t)(((uint64_t)p_pwr->channelSum * G_R310_POWER_MA_PER_CHANNEL * p_brightness) / (255 * 255));
+}
+
+// 제한기 상태 출력
+void R310_pwr_printStats(const T_R310_Power_t* p_pwr) {
+    Serial.printf("R310 power: sum %lu, brightness %u/%u, est %lu mA (budget %u mA), limited frames %lu\n",
+                  (unsigned long)p_pwr->channelSum, p_pwr->appliedBrightness, p_pwr->userBrightness,
+                  (unsigned long)R310_pwr_estimate_mA(p_pwr, p_pwr->appliedBrightness), G_R310_POWER_BUDGET_MA,
+                  (unsigned long)p_pwr->limitedFrames);
+}
@@ -0,0 +1,183 @@
+#pragma once
+
+// R310_procEye_001.h - 파라미터 기반 절차적 눈 래스터라이저
+// 눈동자 위치, 위/아래 눈꺼풀, 눈꺼풀 기울기(화남/슬픔), 찡그림으로 이루어진 작은 파라미터 구조체로
+// 눈 모양을 계산합니다. 손으로 그린 글리프 대신 파라미터 키프레임을 보간하므로 연속적인 시선 이동이 가능합니다.
+// 좌표는 눈 영역을 -128 ~ 127 로 정규화한 정수 단위(u)이며, 부호 있는 거리(SDF)의 최댓값(교집합)으로 모양을 합성합니다.
+// 같은 파라미터로 패널 크기(8x8, 16x16)에 맞춰 1bpp 프레임버퍼에 그립니다.
+
+#include "R310_config_009.h"
+#include "R310_data2_014.h"
+#include "R310_pixelMap_001.h"
+#include "R310_frameBuf_001.h"
+
+#define G_R310_PROC_EYE_RADIUS      104     // 눈 흰자 반지름 (u, 8x8 기준 EYE_NEUTRAL 과 같은 외곽)
+#define G_R310_PROC_PUPIL_RADIUS    36      // 눈동자 반지름 (u, 8x8 기준 2x2 픽셀)
+
+// 눈 모양 파라미터
+typedef struct {
+    int8_t      pupilX;     // 눈동자 가로 위치 (-127: 왼쪽 끝 ~ 127: 오른쪽 끝)
+    int8_t      pupilY;     // 눈동자 세로 위치 (-127: 위 끝 ~ 127: 아래 끝)
+    uint8_t     lidUpper;   // 위 눈꺼풀 (0: 완전히 뜸 ~ 255: 완전히 감음)
+    uint8_t     lidLower;   // 아래 눈꺼풀 (0: 완전히 뜸 ~ 255: 완전히 감음)
+    int8_t      lidTilt;    // 위 눈꺼풀 기울기 (+: 안쪽(코 쪽)이 내려감 = 화남, -: 바깥쪽이 내려감 = 슬픔)
+    uint8_t     squint;     // 찡그림 (0 ~ 255, 눈 세로 반지름을 최대 절반까지 줄임)
+} T_R310_EyeParam_t;
+
+// 파라미터 키프레임 (다음 키프레임까지 timeFrame 동안 보간)
+typedef struct {
+    T_R310_EyeParam_t   eye[2];         // [T_R310_EyeSide_Idx_t] 눈별 파라미터
+    uint16_t            timeFrame;      // 다음 키프레임까지의 보간 시간 (밀리초)
+} T_R310_proc_Keyframe_t;
+
+// 절차적 감정 애니메이션 조회 테이블 항목
+typedef struct {
+    T_R310_emotion_idx_t            emotionIdx;     // 감정 종류
+    const T_R310_proc_Keyframe_t*   seq;            // 키프레임 시퀀스 PROGMEM 주소
+    uint8_t                         seqSize;        // 키프레임 개수
+} T_R310_proc_Table_t;
+
+
+// 정수 제곱근 (비트 단위, 부동소수점 미사용)
+uint16_t R310_proc_isqrt32(uint32_t p_value) {
+    uint32_t v_result = 0;
+    uint32_t v_bit    = 1UL << 30;
+    while (v_bit > p_value) v_bit >>= 2;
+    while (v_bit) {
+        if (p_value >= v_result + v_bit) {
+            p_value  -= v_result + v_bit;
+            v_result  = (v_result >> 1) + v_bit;
+        } else {
+            v_result >>= 1;
+        }
+        v_bit >>= 2;
+    }
+    return (uint16_t)v_result;
+}
+
+// 한 점(u 좌표)에서 눈 모양까지의 부호 있는 거리 (음수: 켜짐 영역 안쪽)
+// @param p_xInner 안쪽(코 쪽)이 + 방향이 되도록 좌우를 맞춘 x 좌표 (눈꺼풀 기울기용)
+int16_t R310_proc_distance(const T_R310_EyeParam_t* p_param, int16_t p_x, int16_t p_y, int16_t p_xInner) {
+    const int32_t v_rx = G_R310_PROC_EYE_RADIUS;
+    const int32_t v_ry = G_R310_PROC_EYE_RADIUS - ((G_R310_PROC_EYE_RADIUS / 2) * p_param->squint) / 255;
+
+    // 눈 흰자 (타원): 정규화 반지름으로 근사한 거리
+    int32_t v_nx   = ((int32_t)p_x << 8) / v_rx;
+    int32_t v_ny   = ((int32_t)p_y << 8) / v_ry;
+    int32_t v_dist = ((int32_t)R310_proc_isqrt32((uint32_t)(v_nx * v_nx + v_ny * v_ny)) - 256) * v_ry / 256;
+
+    // 눈동자 (원형 구멍)
+    int32_t v_px   = (int32_t)p_param->pupilX * (v_rx - G_R310_PROC_PUPIL_RADIUS) / 127;
+    int32_t v_py   = (int32_t)p_param->pupilY * (v_ry - G_R310_PROC_PUPIL_RADIUS) / 127;
+    int32_t v_dx   = p_x - v_px;
+    int32_t v_dy   = p_y - v_py;
+    int32_t v_hole = G_R310_PROC_PUPIL_RADIUS - (int32_t)R310_proc_isqrt32((uint32_t)(v_dx * v_dx + v_dy * v_dy));
+    if (v_hole > v_dist) v_dist = v_hole;
+
+    // 위 눈꺼풀 (기울어진 반평면), 아래 눈꺼풀 (수평 반평면)
+    int32_t v_upper = (-128 + (int32_t)p_param->lidUpper + ((int32_t)p_param->lidTilt * p_xInner) / 128) - p_y;
+    int32_t v_lower = p_y - (128 - (int32_t)p_param->lidLower);
+    if (v_upper > v_dist) v_dist = v_upper;
+    if (v_lower > v_dist) v_dist = v_lower;
+
+    return (int16_t)v_dist;
+}
+
+// 파라미터로 계산한 눈을 1bpp 프레임버퍼에 OR 합성합니다. (패널 크기 N x N, 팔레트 인덱스 1)
+// @param p_eyeSideIdx 눈꺼풀 기울기의 좌우 대칭 기준 (EYE_RIGHT 는 열 N-1 쪽이 안쪽)
+template <uint8_t N>
+void R310_proc_drawEye(T_R310_EyeFrameBufWH_t<N, N>* p_fb, T_R310_EyeSide_Idx_t p_eyeSideIdx, const T_R310_EyeParam_t* p_param) {
+    typedef typename T_R310_EyeFrameBufWH_t<N, N>::row_t row_t;
+    for (uint8_t v_row = 0; v_row < N; v_row++) {
+        int16_t v_y       = (int16_t)(((2 * v_row + 1) * 128) / N - 128); // 픽셀 중심
+        row_t   v_rowBits = 0;
+        for (uint8_t v_col = 0; v_col < N; v_col++) {
+            int16_t v_x      = (int16_t)(((2 * v_col + 1) * 128) / N - 128);
+            int16_t v_xInner = (p_eyeSideIdx == EYE_RIGHT) ? v_x : (int16_t)-v_x;
+            if (R310_proc_distance(p_param, v_x, v_y, v_xInner) <= 0) v_rowBits |= (row_t)((row_t)1 << (N - 1 - v_col));
+        }
+        p_fb->rows[p_eyeSideIdx][v_row] |= v_rowBits;
+    }
+}
+
+// 두 파라미터 사이를 p_amount(0~255) 비율로 보간합니다.
+void R310_proc_lerpParam(const T_R310_EyeParam_t* p_from, const T_R310_EyeParam_t* p_to, fract8 p_amount, T_R310_EyeParam_t* p_out) {
+    p_out->pupilX   = (int8_t)(p_from->pupilX + (((int16_t)p_to->pupilX - p_from->pupilX) * p_amount) / 256);
+    p_out->pupilY   = (int8_t)(p_from->pupilY + (((int16_t)p_to->pupilY - p_from->pupilY) * p_amount) / 256);
+    p_out->lidUpper = lerp8by8(p_from->lidUpper, p_to->lidUpper, p_amount);
+    p_out->lidLower = lerp8by8(p_from->lidLower, p_to->lidLower, p_amount);
+    p_out->lidTilt  = (int8_t)(p_from->lidTilt + (((int16_t)p_to->lidTilt - p_from->lidTilt) * p_amount) / 256);
+    p_out->squint   = lerp8by8(p_from->squint, p_to->squint, p_amount);
+}
+
+
+// --- 절차적 키프레임 시퀀스 (PROGMEM) ---
+// 파라미터 순서: { pupilX, pupilY, lidUpper, lidLower, lidTilt, squint }
+
+// 둘러보기: 가운데 -> 왼쪽 -> 오른쪽 -> 가운데 (연속 시선 이동)
+const T_R310_proc_Keyframe_t g_R310_procSeq_LookAround[] PROGMEM = {
+    {{{    0,   0,   0,   0,   0,   0 }, {    0,   0,   0,   0,   0,   0 }}, G_R310_FRAME_TIME * 4},   // 가운데
+    {{{ -127,   0,   0,   0,   0,   0 }, { -127,   0,   0,   0,   0,   0 }}, G_R310_FRAME_TIME * 3},   // 왼쪽 (유지)
+    {{{ -127,   0,   0,   0,   0,   0 }, { -127,   0,   0,   0,   0,   0 }}, G_R310_FRAME_TIME * 6},   // 왼쪽 -> 오른쪽
+    {{{  127,   0,   0,   0,   0,   0 }, {  127,   0,   0,   0,   0,   0 }}, G_R310_FRAME_TIME * 3},   // 오른쪽 (유지)
+    {{{  127,   0,   0,   0,   0,   0 }, {  127,   0,   0,   0,   0,   0 }}, G_R310_FRAME_TIME * 4},   // 오른쪽 -> 가운데
+    {{{    0,   0,   0,   0,   0,   0 }, {    0,   0,   0,   0,   0,   0 }}, G_R310_FRAME_TIME    },   // 가운데
+};
+
+// 화남: 눈꺼풀이 안쪽으로 기울며 내려오고 살짝 찡그림
+const T_R310_proc_Keyframe_t g_R310_procSeq_Angry[] PROGMEM = {
+    {{{    0,   0,   0,   0,   0,   0 }, {    0,   0,   0,   0,   0,   0 }}, G_R310_FRAME_TIME * 3},   // 기본 눈
+    {{{    0,  40,  80,  20,  70,  60 }, {    0,  40,  80,  20,  70,  60 }}, G_R310_FRAME_TIME * 10},  // 화난 눈 (유지)
+};
+
+// 절차적 감정 애니메이션 조회 테이블
+constexpr T_R310_proc_Table_t g_R310_proc_Tables_arr[] PROGMEM = {
+    {EMT_PROC_LOOK    , g_R310_procSeq_LookAround    , G_R310_ARRAY_SIZE(g_R310_procSeq_LookAround)}, // 둘러보기 (절차적)
+    {EMT_PROC_ANGRY   , g_R310_procSeq_Angry         , G_R310_ARRAY_SIZE(g_R310_procSeq_Angry)    }, // 화남 (절차적)
+};
+
+#define G_R310_PROC_NONE    0xFF    // g_R310_proc_Lookup: 절차적 시퀀스가 없는 감정
+
+// 감정별 절차적 시퀀스 항목 번호 (g_R310_proc_Tables_arr 인덱스, 없으면 G_R310_PROC_NONE)
+typedef struct {
+    uint8_t     tableIdx[EMT_COUNT];
+} T_R310_proc_Lookup_t;
+
+constexpr T_R310_proc_Lookup_t R310_proc_buildLookup() {
+    T_R310_proc_Lookup_t v_lookup = {};
+    for (uint8_t v_e = 0; v_e < EMT_COUNT; v_e++) v_lookup.tableIdx[v_e] = G_R310_PROC_NONE;
+    for (uint8_t v_i = 0; v_i < G_R310_ARRAY_SIZE(g_R310_proc_Tables_arr); v_i++) {
+        v_lookup.tableIdx[g_R310_proc_Tables_arr[v_i].emotionIdx] = v_i;
+    }
+    return v_lookup;
+}
+
+// 감정 커버리지 검사: EMT_NONE 을 뺀 모든 감정은 글리프 시퀀스(g_R310_ani_Tables_arr)나
+// 절차적 시퀀스 중 정확히 하나를 가져야 합니다. (감정을 추가하고 시퀀스 등록을 빠뜨리면 빌드 실패)
+constexpr bool R310_proc_coversEmotions() {
+    for (uint8_t v_e = EMT_NONE + 1; v_e < EMT_COUNT; v_e++) {
+        uint8_t v_count = (g_R310_ani_Lookup.entry[v_e].seq != nullptr) ? 1 : 0;
+        for (const T_R310_proc_Table_t& v_proc : g_R310_proc_Tables_arr) {
+            if (v_proc.emotionIdx == v_e) v_count++;
+        }
+        if (v_count != 1) return false;
+    }
+    for (const T_R310_proc_Table_t& v_proc : g_R310_proc_Tables_arr) {
+        if (v_proc.emotionIdx == EMT_NONE || v_proc.emotionIdx >= EMT_COUNT || v_proc.seqSize == 0 || v_proc.seqSize > INT8_MAX) return false;
+    }
+    return true;
+}
+
+static_assert(R310_proc_coversEmotions(), "감정마다 글리프 시퀀스 또는 절차적 시퀀스가 정확히 하나 있어야 합니다 (시퀀스 길이 1 ~ 127)");
+
+constexpr T_R310_proc_Lookup_t g_R310_proc_Lookup PROGMEM = R310_proc_buildLookup();
+
+// 감정에 해당하는 절차적 키프레임 시퀀스를 찾습니다. (감정 인덱스로 바로 조회)
+// @return 찾았으면 true (p_table 에 결과 기록)
+bool R310_proc_findSequence(T_R310_emotion_idx_t p_emotionIdx, T_R310_proc_Table_t* p_table) {
+    if (p_emotionIdx >= EMT_COUNT) return false;
+    uint8_t v_tableIdx = pgm_read_byte(&g_R310_proc_Lookup.tableIdx[p_emotionIdx]);
+    if (v_tableIdx == G_R310_PROC_NONE) return false;
+    memcpy_P(p_table, &g_R310_proc_Tables_arr[v_tableIdx], sizeof(T_R310_proc_Table_t));
+    return true;
+}
@@ -0,0 +1,144 @@
+#pragma once
+
+// R310_sched_001.h - 마감 시간 기반 루프 대기
+// 애니메이션 엔진이 다음 이벤트(프레임 전환, 자동 깜빡임, 오버레이 키프레임, 시선 갱신, 잠들기)의 절대 시간을 계산하면,
+// R310_sched_waitUntil()이 그 시간까지 루프 태스크를 재웁니다. 시리얼 명령이 들어오면 태스크 알림으로 바로 깨어납니다.
+// 기존의 매 루프 delay(1) 폴링 대신 이벤트 사이를 통째로 쉬므로, 대기 비율(유휴 CPU)과 깨어난 시각의 지연(지터)을 함께 기록합니다.
+//
+// 백엔드
+//   ESP32 : ulTaskNotifyTake(마감까지 남은 틱) + Serial.onReceive 에서 xTaskNotifyGive
+//   그 외 : delay() 로 마감까지 대기 (명령 알림이 없으므로 G_R310_SCHED_POLL_MS 단위로 나누어 시리얼 확인)
+//
+// 같은 loop() 에서 도는 다른 모듈(M010/W010)은 매 루프 R310_sched_setDue() 로 자기 다음 마감(주기 출력, 웹 갱신)을 알리고,
+// 비동기 이벤트(MPU DMP 인터럽트, 웹 UI 콜백)는 R310_sched_notifyFromISR()/R310_sched_notify() 로 루프를 깨웁니다.
+// 알린 마감은 다음 대기에 한 번 반영됩니다. (R310_run 이 loop() 에서 먼저 돌고 대기하므로, 다른 모듈이 이번 루프에 알린 값은 다음 루프의 대기에 적용)
+
+#include "R310_config_009.h"
+
+#if defined(ARDUINO_ARCH_ESP32)
+    #define G_R310_SCHED_BACKEND_ESP32
+    #include <freertos/FreeRTOS.h>
+    #include <freertos/task.h>
+#endif
+
+#ifndef G_R310_SCHED_MAX_BLOCK_MS
+    #define G_R310_SCHED_MAX_BLOCK_MS   1000        // 다음 마감까지 대기하되, 알림을 놓쳐도 1초 안에 복구
+#endif
+#define G_R310_SCHED_POLL_MS        10          // 알림 없는 백엔드의 시리얼 확인 주기 (밀리초)
+
+// 스케줄러 통계 (R310_sched_printStats 에서 출력 후 초기화)
+typedef struct {
+    uint32_t    windowStartUs;      // 측정 구간 시작
+    uint32_t    idleUs;             // 구간 내 대기 누적 시간
+    uint32_t    waits;              // 대기 횟수
+    uint32_t    notified;           // 마감 전 알림(명령)으로 깨어난 횟수
+    uint32_t    jitterCount;        // 마감으로 깨어난 횟수 (지터 표본)
+    uint32_t    jitterSumUs;        // 마감 대비 늦게 깨어난 시간 누적
+    uint32_t    jitterMaxUs;        // 마감 대비 늦게 깨어난 최대 시간
+} T_R310_SchedStats_t;
+
+// 스케줄러 상태
+typedef struct {
+#if defined(G_R310_SCHED_BACKEND_ESP32)
+    TaskHandle_t            loopTask;       // 대기하는 루프 태스크 (R310_sched_init 을 호출한 태스크)
+#endif
+    uint32_t                externDue;      // 다른 모듈이 알린 가장 이른 마감 (millis 기준)
+    bool                    hasExternDue;   // externDue 가 유효한지 (대기 한 번에 반영 후 지움)
+    T_R310_SchedStats_t     stats;
+} T_R310_Sched_t;
+
+T_R310_Sched_t g_R310_sched;
+
+
+// 대기 중인 루프 태스크를 깨웁니다. (시리얼 수신 콜백 등 다른 태스크에서 호출 가능)
+void R310_sched_notify() {
+#if defined(G_R310_SCHED_BACKEND_ESP32)
+    if (g_R310_sched.loopTask != nullptr) xTaskNotifyGive(g_R310_sched.loopTask);
+#endif
+}
+
+// 인터럽트 서비스 루틴에서 대기 중인 루프 태스크를 깨웁니다. (예: MPU DMP 데이터 준비 인터럽트)
+void IRAM_ATTR R310_sched_notifyFromISR() {
+#if defined(G_R310_SCHED_BACKEND_ESP32)
+    if (g_R310_sched.loopTask != nullptr) {
+        BaseType_t v_isWoken = pdFALSE;
+        vTaskNotifyGiveFromISR(g_R310_sched.loopTask, &v_isWoken);
+        if (v_isWoken) portYIELD_FROM_ISR();
+    }
+#endif
+}
+
+// 같은 loop() 에서 도는 다른 모듈이 다음에 할 일이 있는 절대 시간(millis 기준)을 알립니다.
+// 여러 번 부르면 가장 이른 값을 쓰고, 다음 R310_sched_waitUntil 한 번에만 반영합니다.
+void R310_sched_setDue(uint32_t p_due) {
+    if (!g_R310_sched.hasExternDue || (int32_t)(p_due - g_R310_sched.externDue) < 0) {
+        g_R310_sched.externDue    = p_due;
+        g_R310_sched.hasExternDue = true;
+    }
+}
+
+// 스케줄러 초기화: 호출한 태스크를 루프 태스크로 등록하고 시리얼 수신 시 깨어나도록 연결합니다.
+void R310_sched_init() {
+    memset(&g_R310_sched.stats, 0, sizeof(T_R310_SchedStats_t));
+    g_R310_sched.stats.windowStartUs = micros();
+    g_R310_sched.hasExternDue        = false;
+#if defined(G_R310_SCHED_BACKEND_ESP32)
+    g_R310_sched.loopTask = xTaskGetCurrentTaskHandle(); // setup()/loop() 는 같은 loopTask
+    Serial.onReceive(R310_sched_notify);
+#endif
+}
+
+// p_due(millis 기준 절대 시간)와 다른 모듈이 알린 마감 중 이른 시간까지 대기합니다. 명령/인터럽트 알림이 오면 일찍 돌아옵니다.
+// 대기 시간은 G_R310_SCHED_MAX_BLOCK_MS 로 제한하며, 마감이 이미 지났으면 바로 돌아옵니다.
+// @return 알림으로 일찍 깨어났으면 true
+bool R310_sched_waitUntil(uint32_t p_due) {
+    if (g_R310_sched.hasExternDue) {
+        if ((int32_t)(g_R310_sched.externDue - p_due) < 0) p_due = g_R310_sched.externDue;
+        g_R310_sched.hasExternDue = false;
+    }
+
+    int32_t v_waitMs = (int32_t)(p_due - millis());
+    if (v_waitMs <= 0) return false;
+    if (v_waitMs > G_R310_SCHED_MAX_BLOCK_MS) v_waitMs = G_R310_SCHED_MAX_BLOCK_MS;
+
+    uint32_t v_startUs = micros();
+    uint32_t v_dueUs   = v_startUs + (uint32_t)v_waitMs * 1000;
+    bool     v_isNotified;
+#if defined(G_R310_SCHED_BACKEND_ESP32)
+    v_isNotified = ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(v_waitMs)) != 0;
+#else
+    if (v_waitMs > G_R310_SCHED_POLL_MS) v_waitMs = G_R310_SCHED_POLL_MS;
+    v_dueUs = v_startUs + (uint32_t)v_waitMs * 1000;
+    delay(v_waitMs);
+    v_isNotified = false;
+#endif
+    uint32_t v_endUs = micros();
+
+    g_R310_sched.stats.idleUs += v_endUs - v_startUs;
+    g_R310_sched.stats.waits++;
+    if (v_isNotified) {
+        g_R310_sched.stats.notified++;
+    } else {
+        uint32_t v_lateUs = ((int32_t)(v_endUs - v_dueUs) > 0) ? (v_endUs - v_dueUs) : 0;
+        g_R310_sched.stats.jitterCount++;
+        g_R310_sched.stats.jitterSumUs += v_lateUs;
+        if (v_lateUs > g_R310_sched.stats.jitterMaxUs) g_R310_sched.stats.jitterMaxUs = v_lateUs;
+    }
+    return v_isNotified;
+}
+
+// 유휴 CPU 비율과 깨어남 지터를 출력하고 측정 구간을 다시 시작합니다.
+void R310_sched_printStats() {
+    uint32_t v_nowUs    = micros();
+    uint32_t v_windowUs = v_nowUs - g_R310_sched.stats.windowStartUs;
+    float    v_idlePct  = (v_windowUs > 0) ? (100.0f * g_R310_sched.stats.idleUs / v_windowUs) : 0.0f;
+    float    v_jitterUs = (g_R310_sched.stats.jitterCount > 0) ? ((float)g_R310_sched.stats.jitterSumUs / g_R310_sched.stats.jitterCount) : 0.0f;
+
+    Serial.printf("R310 sched: idle %.1f%% of %lu ms, waits %lu (notified %lu), wake jitter avg %.0f us / max %lu us, block cap %u ms\n",
+                  v_idlePct, (unsigned long)(v_windowUs / 1000), (unsigned long)g_R310_sched.stats.waits,
+                  (unsigned long)g_R310_sched.stats.notified, v_jitterUs, (unsigned long)g_R310_sched.stats.jitterMaxUs,
+                  (unsigned)G_R310_SCHED_MAX_BLOCK_MS);
+
+    memset(&g_R310_sched.stats, 0, sizeof(T_R310_SchedStats_t));
+    g_R310_sched.stats.windowStartUs = v_nowUs;
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+// R310_snapshot_001.h - 애니메이션 상태 스냅샷 (RTC 저속 메모리, A04_rtcSnapshot_001.h)
+// 딥슬립 복귀나 워치독 리셋 뒤 R310_init 이 EMT_NEUTRAL 로 다시 시작하지 않고, 재생 중이던 시퀀스의 같은 프레임,
+// 스크롤 중이던 텍스트, 잠든 상태와 화면 내용을 그대로 이어서 표시합니다.
+//
+// 인스턴스별로 포인터 없이 다시 찾을 수 있는 값만 저장합니다.
+//   - 시퀀스: 감정 인덱스 + 외부 클립 이름 (슬롯 번호는 뱅크가 바뀌면 달라짐) + 프레임 인덱스/방향/속도
+//   - 시간: 저장 시점 기준 경과 시간 (millis 는 재부팅하면 0 부터 다시 시작)
+//   - 화면: 마지막 1bpp 프레임과 팔레트 (IDLE 로 멈춘 마지막 프레임도 그대로 다시 출력)
+// 시선/눈꺼풀 오버레이와 대기열 요청은 짧은 동안만 의미가 있으므로 저장하지 않습니다.
+//
+// 저장은 R310_run 에서 화면이 바뀐 틱마다 (+ G_R310_SNAP_PERIOD_MS 주기), 복원은 R310_init 에서 한 번 합니다.
+
+#include "R310_config_009.h"
+#include "R310_frameBuf_001.h"
+#include "R310_palette_001.h"
+#include "R310_text_001.h"
+#include "R310_clip_001.h"
+#include "../M010_CarState_001/A04_rtcSnapshot_001.h"
+
+#define G_R310_SNAP_MAGIC           0x30313352  // "R310"
+#define G_R310_SNAP_VERSION         1           // 아래 구조체를 바꾸면 올림 (이전 스냅샷은 버림)
+#define G_R310_SNAP_PERIOD_MS       1000        // 화면 변화가 없어도 경과 시간을 갱신하는 주기 (밀리초)
+
+// 인스턴스 하나의 스냅샷
+typedef struct {
+    uint8_t                 plyState;           // T_R310_ani_ply_state_t
+    uint8_t                 emotionIdx;         // 재생 중인 시퀀스의 감정 (currentAniTable.emotionIdx)
+    uint8_t                 emotionCurrent;     // aniControl.emotionIdx_current
+    uint8_t                 emotionNext;        // aniControl.emotionIdx_next (RESTART 대기)
+    int8_t                  aniFrameIndex;      // 다음에 표시할 프레임 인덱스
+    uint8_t                 playDirection;      // EMTP_Ply_Direct_t
+    uint8_t                 autoReverse;        // EMTP_Ply_AutoReverse_t
+    uint8_t                 robotState;         // T_R310_RobotState_t
+    uint8_t                 autoBlinkOn;
+    uint8_t                 userBrightness;     // 사용자 밝기 ("brightness N")
+    uint16_t                speedQ8;            // 재생 속도 배율
+    uint16_t                blinkMinimumTime;
+    uint16_t                timeFrame;          // 현재 프레임 표시 시간 (속도 반영 후)
+    uint16_t                frameElapsed;       // 현재 프레임 표시 후 경과 시간 (밀리초)
+    uint32_t                sinceAnimation;     // lastAnimationTime 이후 경과 시간 (자동 깜빡임 기준)
+    uint32_t                sinceActivity;      // 배치 activityTime 이후 경과 시간 (잠들기 기준)
+    char                    clipName[G_R310_CLIP_NAME_LEN + 1]; // 재생 중인 외부 클립 이름 (빈 문자열: 내장 시퀀스)
+    char                    text[G_R310_MAX_TEXT_LENGTH + 1];   // 표시 중인 텍스트
+    T_R310_TextRow_t        textRows[G_R310_TEXT_CANVAS_ROWS];  // 마퀴 캔버스
+    uint8_t                 textCharIdx;
+    uint8_t                 textColInChar;
+    uint8_t                 textTailCols;
+    uint8_t                 textIsDone;
+    T_R310_EyeFrameBuf_t    eyeFb;              // 마지막 기본 프레임
+    T_R310_Palette_t        palette;            // 마지막 팔레트
+} T_R310_SnapEyes_t;
+
+// RTC 메모리에 두는 전체 스냅샷
+typedef struct {
+    T_A04_RtcHeader_t       header;
+    T_R310_SnapEyes_t       eyes[G_R310_EYES_COUNT];
+} T_R310_Snapshot_t;
+
+static_assert(sizeof(T_R310_Snapshot_t) <= 2048, "R310 스냅샷이 RTC 저속 메모리(8KB)에 비해 너무 큽니다");
+
+G_A04_RTC_NOINIT T_R310_Snapshot_t  g_R310_snapshot;            // 리셋/딥슬립 후에도 유지
+uint32_t                            g_R310_snapTime = 0;        // 마지막 저장 시간 (millis)
+bool                                g_R310_snapIsResumed = false; // 이번 부팅에서 스냅샷으로 복원했는지
@@ -0,0 +1,207 @@
+#pragma once
+
+// R310_text_001.h - ASCII 텍스트 마퀴(가로 스크롤) 엔진
+// 두 눈 패널을 하나의 (패널 너비 x 2) x 8 캔버스로 보고, 5x7 ASCII 폰트를 오른쪽에서 왼쪽으로 1픽셀씩 흘려 보냅니다.
+// 캔버스는 행마다 정수 하나(MSB = 캔버스 열 0, 8x8 패널은 uint16_t)이며, 한 스텝은 "모든 행 1비트 시프트 + 새 열 1개 삽입"이므로
+// 프레임당 비용은 문자열 길이와 무관하게 일정합니다. 스크롤 속도는 초당 픽셀 수로 지정합니다.
+// 16x16 패널에서는 캔버스를 패널 세로 가운데에 놓습니다.
+
+#include "R310_config_009.h"
+#include "R310_data2_014.h"
+#include "R310_frameBuf_001.h"
+#include "R310_glyph_001.h"
+
+#define G_R310_TEXT_FONT_FIRST      0x20    // 폰트 첫 문자 (' ')
+#define G_R310_TEXT_FONT_LAST       0x7E    // 폰트 마지막 문자 ('~')
+#define G_R310_TEXT_FONT_COLS       5       // 문자당 열 수
+#define G_R310_TEXT_CHAR_SPACING    1       // 문자 사이 빈 열 수
+#define G_R310_TEXT_CANVAS_COLS     (G_R310_EYE_COL_SIZE * 2)   // 캔버스 폭 (오른쪽 눈 패널 + 왼쪽 눈 패널)
+#define G_R310_TEXT_CANVAS_ROWS     8       // 캔버스 높이 (폰트 열 바이트 8비트)
+#define G_R310_TEXT_TOP_ROW         ((G_R310_DISPLAY_HEIGHT - G_R310_TEXT_CANVAS_ROWS) / 2)    // 캔버스를 놓을 패널 행
+#define G_R310_TEXT_MAX_CATCHUP     4       // 한 번의 호출에서 밀린 스텝을 따라잡는 최대 횟수
+
+// 5x7 ASCII 폰트 (열 우선, 각 바이트 bit0 = 맨 위 행, bit7 = 밑줄/하강부 행)
+const uint8_t g_R310_TextFont_arr[][G_R310_TEXT_FONT_COLS] PROGMEM = {
+    {0x00, 0x00, 0x00, 0x00, 0x00}, // 0x20 ' '
+    {0x00, 0x00, 0x5F, 0x00, 0x00}, // 0x21 '!'
+    {0x00, 0x07, 0x00, 0x07, 0x00}, // 0x22 '"'
+    {0x14, 0x7F, 0x14, 0x7F, 0x14}, // 0x23 '#'
+    {0x24, 0x2A, 0x7F, 0x2A, 0x12}, // 0x24 '$'
+    {0x23, 0x13, 0x08, 0x64, 0x62}, // 0x25 '%'
+    {0x36, 0x49, 0x56, 0x20, 0x50}, // 0x26 '&'
+    {0x00, 0x08, 0x07, 0x03, 0x00}, // 0x27 '''
+    {0x00, 0x1C, 0x22, 0x41, 0x00}, // 0x28 '('
+    {0x00, 0x41, 0x22, 0x1C, 0x00}, // 0x29 ')'
+    {0x2A, 0x1C, 0x7F, 0x1C, 0x2A}, // 0x2A '*'
+    {0x08, 0x08, 0x3E, 0x08, 0x08}, // 0x2B '+'
+    {0x00, 0x80, 0x70, 0x30, 0x00}, // 0x2C ','
+    {0x08, 0x08, 0x08, 0x08, 0x08}, // 0x2D '-'
+    {0x00, 0x00, 0x60, 0x60, 0x00}, // 0x2E '.'
+    {0x20, 0x10, 0x08, 0x04, 0x02}, // 0x2F '/'
+    {0x3E, 0x51, 0x49, 0x45, 0x3E}, // 0x30 '0'
+    {0x00, 0x42, 0x7F, 0x40, 0x00}, // 0x31 '1'
+    {0x72, 0x49, 0x49, 0x49, 0x46}, // 0x32 '2'
+    {0x21, 0x41, 0x49, 0x4D, 0x33}, // 0x33 '3'
+    {0x18, 0x14, 0x12, 0x7F, 0x10}, // 0x34 '4'
+    {0x27, 0x45, 0x45, 0x45, 0x39}, // 0x35 '5'
+    {0x3C, 0x4A, 0x49, 0x49, 0x31}, // 0x36 '6'
+    {0x41, 0x21, 0x11, 0x09, 0x07}, // 0x37 '7'
+    {0x36, 0x49, 0x49, 0x49, 0x36}, // 0x38 '8'
+    {0x46, 0x49, 0x49, 0x29, 0x1E}, // 0x39 '9'
+    {0x00, 0x00, 0x14, 0x00, 0x00}, // 0x3A ':'
+    {0x00, 0x40, 0x34, 0x00, 0x00}, // 0x3B ';'
+    {0x00, 0x08, 0x14, 0x22, 0x41}, // 0x3C '<'
+    {0x14, 0x14, 0x14, 0x14, 0x14}, // 0x3D '='
+    {0x00, 0x41, 0x22, 0x14, 0x08}, // 0x3E '>'
+    {0x02, 0x01, 0x59, 0x09, 0x06}, // 0x3F '?'
+    {0x3E, 0x41, 0x5D, 0x59, 0x4E}, // 0x40 '@'
+    {0x7C, 0x12, 0x11, 0x12, 0x7C}, // 0x41 'A'
+    {0x7F, 0x49, 0x49, 0x49, 0x36}, // 0x42 'B'
+    {0x3E, 0x41, 0x41, 0x41, 0x22}, // 0x43 'C'
+    {0x7F, 0x41, 0x41, 0x41, 0x3E}, // 0x44 'D'
+    {0x7F, 0x49, 0x49, 0x49, 0x41}, // 0x45 'E'
+    {0x7F, 0x09, 0x09, 0x09, 0x01}, // 0x46 'F'
+    {0x3E, 0x41, 0x41, 0x51, 0x73}, // 0x47 'G'
+    {0x7F, 0x08, 0x08, 0x08, 0x7F}, // 0x48 'H'
+    {0x00, 0x41, 0x7F, 0x41, 0x00}, // 0x49 'I'
+    {0x20, 0x40, 0x41, 0x3F, 0x01}, // 0x4A 'J'
+    {0x7F, 0x08, 0x14, 0x22, 0x41}, // 0x4B 'K'
+    {0x7F, 0x40, 0x40, 0x40, 0x40}, // 0x4C 'L'
+    {0x7F, 0x02, 0x1C, 0x02, 0x7F}, // 0x4D 'M'
+    {0x7F, 0x04, 0x08, 0x10, 0x7F}, // 0x4E 'N'
+    {0x3E, 0x41, 0x41, 0x41, 0x3E}, // 0x4F 'O'
+    {0x7F, 0x09, 0x09, 0x09, 0x06}, // 0x50 'P'
+    {0x3E, 0x41, 0x51, 0x21, 0x5E}, // 0x51 'Q'
+    {0x7F, 0x09, 0x19, 0x29, 0x46}, // 0x52 'R'
+    {0x26, 0x49, 0x49, 0x49, 0x32}, // 0x53 'S'
+    {0x03, 0x01, 0x7F, 0x01, 0x03}, // 0x54 'T'
+    {0x3F, 0x40, 0x40, 0x40, 0x3F}, // 0x55 'U'
+    {0x1F, 0x20, 0x40, 0x20, 0x1F}, // 0x56 'V'
+    {0x3F, 0x40, 0x38, 0x40, 0x3F}, // 0x57 'W'
+    {0x63, 0x14, 0x08, 0x14, 0x63}, // 0x58 'X'
+    {0x03, 0x04, 0x78, 0x04, 0x03}, // 0x59 'Y'
+    {0x61, 0x59, 0x49, 0x4D, 0x43}, // 0x5A 'Z'
+    {0x00, 0x7F, 0x41, 0x41, 0x41}, // 0x5B '['
+    {0x02, 0x04, 0x08, 0x10, 0x20}, // 0x5C (역슬래시)
+    {0x00, 0x41, 0x41, 0x41, 0x7F}, // 0x5D ']'
+    {0x04, 0x02, 0x01, 0x02, 0x04}, // 0x5E '^'
+    {0x40, 0x40, 0x40, 0x40, 0x40}, // 0x5F '_'
+    {0x00, 0x03, 0x07, 0x08, 0x00}, // 0x60 '`'
+    {0x20, 0x54, 0x54, 0x78, 0x40}, // 0x61 'a'
+    {0x7F, 0x28, 0x44, 0x44, 0x38}, // 0x62 'b'
+    {0x38, 0x44, 0x44, 0x44, 0x28}, // 0x63 'c'
+    {0x38, 0x44, 0x44, 0x28, 0x7F}, // 0x64 'd'
+    {0x38, 0x54, 0x54, 0x54, 0x18}, // 0x65 'e'
+    {0x00, 0x08, 0x7E, 0x09, 0x02}, // 0x66 'f'
+    {0x18, 0xA4, 0xA4, 0x9C, 0x78}, // 0x67 'g'
+    {0x7F, 0x08, 0x04, 0x04, 0x78}, // 0x68 'h'
+    {0x00, 0x44, 0x7D, 0x40, 0x00}, // 0x69 'i'
+    {0x20, 0x40, 0x40, 0x3D, 0x00}, // 0x6A 'j'
+    {0x7F, 0x10, 0x28, 0x44, 0x00}, // 0x6B 'k'
+    {0x00, 0x41, 0x7F, 0x40, 0x00}, // 0x6C 'l'
+    {0x7C, 0x04, 0x78, 0x04, 0x78}, // 0x6D 'm'
+    {0x7C, 0x08, 0x04, 0x04, 0x78}, // 0x6E 'n'
+    {0x38, 0x44, 0x44, 0x44, 0x38}, // 0x6F 'o'
+    {0xFC, 0x18, 0x24, 0x24, 0x18}, // 0x70 'p'
+    {0x18, 0x24, 0x24, 0x18, 0xFC}, // 0x71 'q'
+    {0x7C, 0x08, 0x04, 0x04, 0x08}, // 0x72 'r'
+    {0x48, 0x54, 0x54, 0x54, 0x24}, // 0x73 's'
+    {0x04, 0x04, 0x3F, 0x44, 0x24}, // 0x74 't'
+    {0x3C, 0x40, 0x40, 0x20, 0x7C}, // 0x75 'u'
+    {0x1C, 0x20, 0x40, 0x20, 0x1C}, // 0x76 'v'
+    {0x3C, 0x40, 0x30, 0x40, 0x3C}, // 0x77 'w'
+    {0x44, 0x28, 0x10, 0x28, 0x44}, // 0x78 'x'
+    {0x4C, 0x90, 0x90, 0x90, 0x7C}, // 0x79 'y'
+    {0x44, 0x64, 0x54, 0x4C, 0x44}, // 0x7A 'z'
+    {0x00, 0x08, 0x36, 0x41, 0x00}, // 0x7B '{'
+    {0x00, 0x00, 0x77, 0x00, 0x00}, // 0x7C '|'
+    {0x00, 0x41, 0x36, 0x08, 0x00}, // 0x7D '}'
+    {0x02, 0x01, 0x02, 0x04, 0x02}, // 0x7E '~'
+};
+
+static_assert(G_R310_ARRAY_SIZE(g_R310_TextFont_arr) == G_R310_TEXT_FONT_LAST - G_R310_TEXT_FONT_FIRST + 1, "ASCII 폰트 문자 수 불일치");
+static_assert(G_R310_DISPLAY_HEIGHT >= G_R310_TEXT_CANVAS_ROWS, "텍스트 캔버스가 패널보다 높습니다");
+
+// 캔버스 한 행 (MSB = 캔버스 열 0)
+typedef T_R310_RowBits_t<G_R310_TEXT_CANVAS_COLS>::type T_R310_TextRow_t;
+
+// 텍스트 스크롤 상태 구조체
+typedef struct {
+    T_R310_TextRow_t rows[G_R310_TEXT_CANVAS_ROWS]; // 캔버스 (행당 G_R310_TEXT_CANVAS_COLS 비트, MSB = 왼쪽 끝 열)
+    const char* text;                           // 스크롤할 문자열 (널 종료)
+    uint8_t     charIdx;                        // 다음에 넣을 문자 위치
+    uint8_t     colInChar;                      // 현재 문자 내 다음 열 (폰트 열 + 간격 열)
+    uint8_t     tailCols;                       // 문자열 끝난 뒤 화면을 비우기 위해 남은 빈 열 수
+    uint16_t    stepInterval;                   // 1픽셀 이동 간격 (밀리초)
+    uint32_t    lastStepTime;                   // 마지막 이동 시간 (밀리초)
+    bool        isDone;                         // 마지막 글자가 화면을 빠져나갔는지 여부
+} T_R310_TextScroll_t;
+
+
+// 스크롤 시작: 빈 캔버스에서 오른쪽 끝으로 첫 글자가 들어옵니다.
+// @param p_text 스크롤할 문자열 (스크롤이 끝날 때까지 유지되어야 함)
+// @param p_pixelsPerSec 스크롤 속도 (초당 픽셀)
+void R310_text_begin(T_R310_TextScroll_t* p_scroll, const char* p_text, uint16_t p_pixelsPerSec) {
+    memset(p_scroll->rows, 0, sizeof(p_scroll->rows));
+    p_scroll->text         = p_text;
+    p_scroll->charIdx      = 0;
+    p_scroll->colInChar    = 0;
+    p_scroll->tailCols     = G_R310_TEXT_CANVAS_COLS;
+    p_scroll->stepInterval = (uint16_t)(1000 / (p_pixelsPerSec ? p_pixelsPerSec : 1));
+    p_scroll->lastStepTime = millis();
+    p_scroll->isDone       = (p_text == nullptr);
+}
+
+// 다음에 캔버스로 들어올 열 1개 (열 우선 비트, bit0 = 맨 위 행)
+uint8_t R310_text_nextColumn(T_R310_TextScroll_t* p_scroll) {
+    char v_ch = p_scroll->text[p_scroll->charIdx];
+    if (v_ch == '\0') {
+        if (p_scroll->tailCols > 0) p_scroll->tailCols--;
+        if (p_scroll->tailCols == 0) p_scroll->isDone = true;
+        return 0;
+    }
+
+    uint8_t v_col = 0;
+    if (p_scroll->colInChar < G_R310_TEXT_FONT_COLS) {
+        if (v_ch < G_R310_TEXT_FONT_FIRST || v_ch > G_R310_TEXT_FONT_LAST) v_ch = '?'; // 폰트 범위 밖 문자
+        v_col = pgm_read_byte(&g_R310_TextFont_arr[v_ch - G_R310_TEXT_FONT_FIRST][p_scroll->colInChar]);
+    }
+    if (++p_scroll->colInChar >= G_R310_TEXT_FONT_COLS + G_R310_TEXT_CHAR_SPACING) {
+        p_scroll->colInChar = 0;
+        p_scroll->charIdx++;
+    }
+    return v_col;
+}
+
+// 캔버스를 왼쪽으로 1픽셀 밀고 오른쪽 끝에 새 열을 넣습니다. (행 수만큼의 시프트, 문자열 길이와 무관)
+void R310_text_shiftIn(T_R310_TextScroll_t* p_scroll, uint8_t p_column) {
+    for (uint8_t v_row = 0; v_row < G_R310_TEXT_CANVAS_ROWS; v_row++) {
+        p_scroll->rows[v_row] = (T_R310_TextRow_t)((p_scroll->rows[v_row] << 1) | ((p_column >> v_row) & 0x01));
+    }
+}
+
+// 경과 시간만큼 스크롤을 진행합니다. (블로킹 없음, 밀린 스텝은 G_R310_TEXT_MAX_CATCHUP 까지 따라잡음)
+// @return 캔버스가 바뀌었으면 true
+bool R310_text_step(T_R310_TextScroll_t* p_scroll) {
+    bool    v_changed = false;
+    uint8_t v_steps   = 0;
+    while (!p_scroll->isDone && (millis() - p_scroll->lastStepTime) >= p_scroll->stepInterval) {
+        p_scroll->lastStepTime += p_scroll->stepInterval;
+        R310_text_shiftIn(p_scroll, R310_text_nextColumn(p_scroll));
+        v_changed = true;
+        if (++v_steps >= G_R310_TEXT_MAX_CATCHUP) {
+            p_scroll->lastStepTime = millis(); // 크게 밀렸으면 따라잡기를 포기하고 현재 시간 기준으로 재시작
+            break;
+        }
+    }
+    return v_changed;
+}
+
+// 캔버스를 두 눈 프레임버퍼로 나누어 기록합니다. (캔버스 왼쪽 절반 = 오른쪽 눈 패널)
+void R310_text_toFrameBuf(const T_R310_TextScroll_t* p_scroll, T_R310_EyeFrameBuf_t* p_fb) {
+    R310_fb_clear(p_fb);
+    for (uint8_t v_row = 0; v_row < G_R310_TEXT_CANVAS_ROWS; v_row++) {
+        p_fb->rows[EYE_RIGHT][G_R310_TEXT_TOP_ROW + v_row] = (T_R310_EyeRow_t)(p_scroll->rows[v_row] >> G_R310_EYE_COL_SIZE);
+        p_fb->rows[EYE_LEFT][G_R310_TEXT_TOP_ROW + v_row]  = (T_R310_EyeRow_t)p_scroll->rows[v_row];
+    }
+}
@@ -0,0 +1,227 @@
+#pragma once
+
+// R310_timeline_001.h - 다중 트랙 애니메이션 타임라인 (기본 표정 위에 눈꺼풀/눈동자 오버레이)
+// 트랙 0 은 기본 표정(감정 시퀀스, R310_runAnimation 의 aniControl)이고, 그 위에 독립된 오버레이 트랙을 둡니다.
+//   눈꺼풀 트랙 : 눈별로 위/아래 눈꺼풀 행을 덮어 감김을 표현 (깜빡임, 윙크)
+//   눈동자 트랙 : 눈별 눈동자 오프셋 (시선 오버레이 오프셋에 더함)
+// 트랙마다 자체 시계(키프레임 시작 시간)와 우선순위가 있으며, 같은 트랙에 새 클립은 우선순위가 같거나 높을 때만
+// 재생 중인 클립을 선점합니다. 그래서 왼쪽 보기 도중의 깜빡임이 왼쪽 보기를 끊지 않습니다.
+// 합성은 출력 직전 한 번(R310_tl_compose)이며, 활성 트랙 수와 무관하게 눈당 눈동자 이동 1회 + 행 마스크 1회입니다.
+// 틱마다의 비용은 가장 이른 키프레임 전환 시간(nextDue) 비교 한 번이고, 전환 시점에만 활성 트랙을 훑습니다.
+
+#include "R310_config_009.h"
+#include "R310_data2_014.h"
+#include "R310_frameBuf_001.h"
+#include "R310_gaze_001.h"
+
+#define G_R310_TL_SCALE         (G_R310_PANEL_SIZE / 8)     // 키프레임 값(8x8 픽셀 단위) -> 패널 픽셀 배율
+#define G_R310_TL_SPEED_1X      256                         // 재생 속도 배율 1 (Q8.8, "blink speed 2" 등)
+
+// 트랙 우선순위 (높을수록 우선, 같은 우선순위는 나중 요청이 선점)
+#define G_R310_TL_PRIO_AUTO     0       // 자동 깜빡임 등 배경 동작
+#define G_R310_TL_PRIO_COMMAND  1       // 시리얼 명령
+#define G_R310_TL_PRIO_STATE    2       // 로봇 상태 전환 (잠들기 등)
+
+// 오버레이 트랙 종류
+typedef enum {
+    TL_TRACK_LID,       // 눈꺼풀 (param[눈][0] = 위 눈꺼풀 행 수, param[눈][1] = 아래 눈꺼풀 행 수)
+    TL_TRACK_PUPIL,     // 눈동자 (param[눈][0] = dx(+: 열 증가 방향), param[눈][1] = dy(+: 아래))
+    TL_TRACK_COUNT
+} T_R310_tl_Track_Idx_t;
+
+// 오버레이 키프레임 (값은 8x8 픽셀 단위, 16x16 패널에서는 G_R310_TL_SCALE 배)
+typedef struct {
+    int8_t      param[2][2];        // [T_R310_EyeSide_Idx_t][0/1] 트랙별 의미는 T_R310_tl_Track_Idx_t 참고
+    uint16_t    timeFrame;          // 키프레임 유지 시간 (밀리초, 마지막 키프레임이 0 이면 정지할 때까지 유지)
+} T_R310_tl_Key_t;
+
+// 오버레이 트랙 상태
+typedef struct {
+    const T_R310_tl_Key_t*  keys;           // 재생 중인 클립 PROGMEM 주소 (nullptr = 비활성)
+    uint8_t                 keyCount;       // 클립 키프레임 개수
+    uint8_t                 keyIdx;         // 현재 키프레임
+    uint8_t                 priority;       // 재생 중인 클립 우선순위 (G_R310_TL_PRIO_*)
+    uint8_t                 repeatLeft;     // 클립이 끝난 뒤 처음부터 다시 재생할 남은 횟수
+    uint16_t                speedQ8;        // 재생 속도 배율 (Q8.8, 키프레임 유지 시간을 나눔)
+    uint32_t                keyStart;       // 트랙 시계: 현재 키프레임 시작 시간 (밀리초)
+    T_R310_tl_Key_t         current;        // 현재 키프레임 값 (RAM 사본)
+} T_R310_tl_Track_t;
+
+// 인스턴스 타임라인
+typedef struct {
+    T_R310_tl_Track_t       tracks[TL_TRACK_COUNT];
+    uint8_t                 activeMask;     // 활성 트랙 비트 (1 << T_R310_tl_Track_Idx_t)
+    bool                    hasDue;         // 전환 예정인 트랙이 있는지 (모두 유지 키프레임이거나 비활성이면 false)
+    uint32_t                nextDue;        // 활성 트랙 중 가장 이른 키프레임 전환 시간
+} T_R310_Timeline_t;
+
+
+// --- 오버레이 클립 (PROGMEM) ---
+// 파라미터 순서: {{ 오른쪽 눈 {a, b} }, { 왼쪽 눈 {a, b} }}, 유지 시간
+
+// 깜빡임: 위 눈꺼풀이 내려오고 아래 눈꺼풀이 살짝 올라와 닫혔다가 다시 뜸
+const T_R310_tl_Key_t g_R310_tlClip_Blink[] PROGMEM = {
+    {{{ 2, 0 }, { 2, 0 }}, G_R310_FRAME_TIME / 3},
+    {{{ 4, 1 }, { 4, 1 }}, G_R310_FRAME_TIME / 3},
+    {{{ 5, 2 }, { 5, 2 }}, G_R310_FRAME_TIME    },   // 감김 (눈꺼풀 선 한 줄만 남김)
+    {{{ 4, 1 }, { 4, 1 }}, G_R310_FRAME_TIME / 3},
+    {{{ 2, 0 }, { 2, 0 }}, G_R310_FRAME_TIME / 3},
+};
+
+// 윙크: 오른쪽 눈만 깜빡임보다 길게 감음
+const T_R310_tl_Key_t g_R310_tlClip_Wink[] PROGMEM = {
+    {{{ 2, 0 }, { 0, 0 }}, G_R310_FRAME_TIME / 2},
+    {{{ 4, 1 }, { 0, 0 }}, G_R310_FRAME_TIME / 2},
+    {{{ 5, 2 }, { 0, 0 }}, G_R310_FRAME_TIME * 3},
+    {{{ 4, 1 }, { 0, 0 }}, G_R310_FRAME_TIME / 2},
+    {{{ 2, 0 }, { 0, 0 }}, G_R310_FRAME_TIME / 2},
+};
+
+// 졸림: 위 눈꺼풀을 반쯤 내린 채 유지 (R310_tl_stop 으로 해제)
+const T_R310_tl_Key_t g_R310_tlClip_Drowsy[] PROGMEM = {
+    {{{ 1, 0 }, { 1, 0 }}, G_R310_FRAME_TIME * 2},
+    {{{ 3, 0 }, { 3, 0 }}, 0},
+};
+
+// 곁눈질: 눈동자만 왼쪽 -> 오른쪽으로 빠르게 옮겼다가 돌아옴
+const T_R310_tl_Key_t g_R310_tlClip_Glance[] PROGMEM = {
+    {{{ -2, 0 }, { -2, 0 }}, G_R310_FRAME_TIME * 4},
+    {{{  0, 0 }, {  0, 0 }}, G_R310_FRAME_TIME    },
+    {{{  2, 0 }, {  2, 0 }}, G_R310_FRAME_TIME * 4},
+};
+
+
+// 유지 시간을 속도 배율로 나눕니다. (0 은 정지 유지 키프레임이므로 그대로, 최소 1ms)
+uint16_t R310_tl_scaleTime(uint16_t p_timeFrame, uint16_t p_speedQ8) {
+    if (p_timeFrame == 0 || p_speedQ8 == G_R310_TL_SPEED_1X) return p_timeFrame;
+    uint32_t v_time = ((uint32_t)p_timeFrame * G_R310_TL_SPEED_1X) / p_speedQ8;
+    return (v_time == 0) ? 1 : (v_time > 0xFFFF) ? 0xFFFF : (uint16_t)v_time;
+}
+
+// 트랙의 p_keyIdx 번째 키프레임을 RAM 사본으로 읽습니다. (속도 배율 적용)
+void R310_tl_loadKey(T_R310_tl_Track_t* p_track, uint8_t p_keyIdx) {
+    p_track->keyIdx = p_keyIdx;
+    memcpy_P(&p_track->current, &p_track->keys[p_keyIdx], sizeof(T_R310_tl_Key_t));
+    p_track->current.timeFrame = R310_tl_scaleTime(p_track->current.timeFrame, p_track->speedQ8);
+}
+
+// 타임라인 초기화 (모든 오버레이 트랙 비활성)
+void R310_tl_init(T_R310_Timeline_t* p_tl) {
+    memset(p_tl, 0, sizeof(T_R310_Timeline_t));
+}
+
+// 활성 트랙 중 가장 이른 키프레임 전환 시간을 다시 계산합니다. (재생/정지/전환 시에만 호출)
+void R310_tl_updateDue(T_R310_Timeline_t* p_tl) {
+    p_tl->hasDue = false;
+    for (uint8_t v_t = 0; v_t < TL_TRACK_COUNT; v_t++) {
+        const T_R310_tl_Track_t* v_track = &p_tl->tracks[v_t];
+        if (!(p_tl->activeMask & (1 << v_t)) || v_track->current.timeFrame == 0) continue; // 유지 키프레임은 전환 없음
+        uint32_t v_due = v_track->keyStart + v_track->current.timeFrame;
+        if (!p_tl->hasDue || (int32_t)(v_due - p_tl->nextDue) < 0) p_tl->nextDue = v_due;
+        p_tl->hasDue = true;
+    }
+}
+
+// 트랙을 정지하고 값을 기본(눈꺼풀 뜸, 눈동자 가운데)으로 되돌립니다.
+// @param p_priority 정지 요청 우선순위 (재생 중인 클립보다 낮으면 무시)
+// @return 정지했으면 true
+bool R310_tl_stop(T_R310_Timeline_t* p_tl, T_R310_tl_Track_Idx_t p_track, uint8_t p_priority) {
+    T_R310_tl_Track_t* v_track = &p_tl->tracks[p_track];
+    if (!(p_tl->activeMask & (1 << p_track)) || p_priority < v_track->priority) return false;
+
+    memset(&v_track->current, 0, sizeof(T_R310_tl_Key_t));
+    v_track->keys  = nullptr;
+    p_tl->activeMask &= ~(1 << p_track);
+    R310_tl_updateDue(p_tl);
+    return true;
+}
+
+// 트랙에 클립을 재생합니다. 재생 중인 클립보다 우선순위가 낮으면 거절합니다. (같거나 높으면 선점)
+// @param p_keys 클립 키프레임 PROGMEM 주소
+// @param p_keyCount 키프레임 개수
+// @param p_priority 우선순위 (G_R310_TL_PRIO_*)
+// @param p_repeat 재생 횟수 (유지 키프레임으로 끝나는 클립은 1회만 의미 있음)
+// @param p_speedQ8 재생 속도 배율 (Q8.8, G_R310_TL_SPEED_1X = 1배)
+// @return 재생을 시작했으면 true
+bool R310_tl_play(T_R310_Timeline_t* p_tl, T_R310_tl_Track_Idx_t p_track, const T_R310_tl_Key_t* p_keys, uint8_t p_keyCount, uint8_t p_priority, uint32_t p_now,
+                  uint8_t p_repeat = 1, uint16_t p_speedQ8 = G_R310_TL_SPEED_1X) {
+    T_R310_tl_Track_t* v_track = &p_tl->tracks[p_track];
+    if ((p_tl->activeMask & (1 << p_track)) && p_priority < v_track->priority) return false;
+    if (p_keyCount == 0) return false;
+
+    v_track->keys       = p_keys;
+    v_track->keyCount   = p_keyCount;
+    v_track->priority   = p_priority;
+    v_track->repeatLeft = (p_repeat > 0) ? p_repeat - 1 : 0;
+    v_track->speedQ8    = (p_speedQ8 > 0) ? p_speedQ8 : G_R310_TL_SPEED_1X;
+    v_track->keyStart   = p_now;
+    R310_tl_loadKey(v_track, 0);
+    p_tl->activeMask |= (1 << p_track);
+    R310_tl_updateDue(p_tl);
+    return true;
+}
+
+// 때가 된 트랙의 키프레임을 진행합니다. 클립이 끝난 트랙은 정지합니다.
+// 전환 시점 전에는 nextDue 비교 한 번으로 끝나므로 활성 트랙 수와 무관합니다.
+// @return 오버레이 값이 바뀌어 다시 출력해야 하면 true
+bool G_R310_HOT_CODE R310_tl_step(T_R310_Timeline_t* p_tl, uint32_t p_now) {
+    if (!p_tl->hasDue || (int32_t)(p_now - p_tl->nextDue) < 0) return false;
+
+    for (uint8_t v_t = 0; v_t < TL_TRACK_COUNT; v_t++) {
+        T_R310_tl_Track_t* v_track = &p_tl->tracks[v_t];
+        if (!(p_tl->activeMask & (1 << v_t))) continue;
+
+        // 루프가 늦었으면 지난 키프레임을 건너뜀 (트랙 시계는 키프레임 경계 기준으로 유지)
+        while (v_track->keys != nullptr && v_track->current.timeFrame != 0 &&
+               (uint32_t)(p_now - v_track->keyStart) >= v_track->current.timeFrame) {
+            v_track->keyStart += v_track->current.timeFrame;
+            if (v_track->keyIdx + 1 < v_track->keyCount) {
+                R310_tl_loadKey(v_track, v_track->keyIdx + 1);
+            } else if (v_track->repeatLeft > 0) {
+                v_track->repeatLeft--;
+                R310_tl_loadKey(v_track, 0); // "blink x3" 등 반복 재생
+            } else {
+                memset(&v_track->current, 0, sizeof(T_R310_tl_Key_t));
+                v_track->keys = nullptr;
+                p_tl->activeMask &= ~(1 << v_t);
+                break;
+            }
+        }
+    }
+    R310_tl_updateDue(p_tl);
+    return true;
+}
+
+// 다음 키프레임 전환까지 남은 시간 (밀리초, 전환할 트랙이 없으면 0xFFFF)
+uint16_t R310_tl_wait(const T_R310_Timeline_t* p_tl, uint32_t p_now) {
+    if (!p_tl->hasDue) return 0xFFFF;
+    int32_t v_wait = (int32_t)(p_tl->nextDue - p_now);
+    if (v_wait <= 0) return 0;
+    return (v_wait > 0xFFFF) ? 0xFFFF : (uint16_t)v_wait;
+}
+
+// 출력 프레임에 시선 + 눈동자 오버레이 + 눈꺼풀 오버레이를 한 번에 합성합니다.
+// 눈당 눈동자 이동 1회(시선 오프셋 + 눈동자 트랙 오프셋)와 눈꺼풀 행 마스크 1회이며, 활성 트랙 수와 무관합니다.
+template <uint8_t W, uint8_t H>
+void G_R310_HOT_CODE R310_tl_compose(T_R310_EyeFrameBufWH_t<W, H>* p_fb, const T_R310_Timeline_t* p_tl, const T_R310_Gaze_t* p_gaze) {
+    const int8_t (*v_pupil)[2] = p_tl->tracks[TL_TRACK_PUPIL].current.param;
+    const int8_t (*v_lid)[2]   = p_tl->tracks[TL_TRACK_LID].current.param;
+    int8_t       v_gazeX       = p_gaze->isEnabled ? p_gaze->offsetX : 0;
+    int8_t       v_gazeY       = p_gaze->isEnabled ? p_gaze->offsetY : 0;
+
+    for (uint8_t v_eye = EYE_RIGHT; v_eye <= EYE_LEFT; v_eye++) {
+        int8_t v_dx = (int8_t)(v_gazeX + v_pupil[v_eye][0] * G_R310_TL_SCALE);
+        int8_t v_dy = (int8_t)(v_gazeY + v_pupil[v_eye][1] * G_R310_TL_SCALE);
+        if (v_dx != 0 || v_dy != 0) R310_gaze_applyEye(p_fb, (T_R310_EyeSide_Idx_t)v_eye, v_dx, v_dy);
+
+        uint8_t v_top    = (uint8_t)(v_lid[v_eye][0] * G_R310_TL_SCALE);
+        uint8_t v_bottom = (uint8_t)(v_lid[v_eye][1] * G_R310_TL_SCALE);
+        if (v_top == 0 && v_bottom == 0) continue;
+        for (uint8_t v_row = 0; v_row < H; v_row++) {
+            if (v_row < v_top || v_row + v_bottom >= H) {
+                p_fb->rows[v_eye][v_row]   = 0;
+                p_fb->rowsHi[v_eye][v_row] = 0;
+            }
+        }
+    }
+}
@@ -74,7 +74,11 @@
 
 void setup() {
 
-	Serial.begin(115200);
+	#ifdef G_A02_SERIALMUX_BAUD
+		A02_serialMux_begin();                                 // 모듈 공용 시리얼 멀티플렉서 (바이너리 프레임 스트리밍 속도, 수신 버퍼 확대)
+	#else
+		Serial.begin(115200);
+	#endif
 	
 	#ifdef F100
 	     F100_init();
@@ -0,0 +1,12 @@
+// R310_host_bench.cpp - 픽셀 매핑 LUT / 명령 분기 벤치마크 호스트 드라이버
+// 펌웨어의 R310_bench_001.h 와 같은 코드(R310_benchCore_001.h)를 호스트에서 실행합니다.
+// 빌드/실행: make -C test/host bench
+
+#include "../../src/R310_RobotEyes_T31_008/R310_benchCore_001.h"
+
+int main() {
+    Serial.printf("[R310_BENCH] host, %u frames per case\n", (unsigned)G_R310_BENCH_FRAMES);
+    R310_bench_pixelMap();
+    R310_bench_cmdDispatch();
+    return 0;
+}
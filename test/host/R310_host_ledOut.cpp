@@ -0,0 +1,61 @@
+// R310_host_ledOut.cpp - 더블 버퍼 출력 단계 겹침 측정 호스트 드라이버
+// R310_ledOutput_001.h 의 호스트 백엔드(std::thread 가 WS2812 전송 시간을 흉내)에 프레임을 제출하면서
+// 프레임마다 렌더링 시간을 흉내 내고, 기록된 프레임/타이밍을 CSV 로 출력합니다.
+// 빌드/실행: make -C test/host ledout  (-> test/host/ledout.csv)
+// 사용법: R310_host_ledOut [프레임 수] [렌더링 us] [CSV 파일]
+
+#include "../../src/R310_RobotEyes_T31_008/R310_config_009.h"
+#include "../../src/R310_RobotEyes_T31_008/R310_ledOutput_001.h"
+#include <stdlib.h>
+
+CRGB g_host_back[G_R310_LEDOUT_NUM_LEDS]; // 렌더링 백 버퍼
+
+// p_us 동안 백 버퍼를 다시 그리는 렌더링 흉내 (바쁜 대기, 프레임 번호로 색을 바꿔 CSV 에서 순서 확인)
+void R310_host_render(uint32_t p_frameNo, uint32_t p_us) {
+    uint32_t v_startUs = R310_ledOut_nowUs();
+    do {
+        for (uint16_t v_i = 0; v_i < G_R310_LEDOUT_NUM_LEDS; v_i++) {
+            g_host_back[v_i] = CRGB((uint8_t)p_frameNo, (uint8_t)v_i, 0);
+        }
+    } while (R310_ledOut_nowUs() - v_startUs < p_us);
+}
+
+int main(int argc, char** argv) {
+    uint32_t    v_frames   = (argc > 1) ? (uint32_t)atoi(argv[1]) : 200;
+    uint32_t    v_renderUs = (argc > 2) ? (uint32_t)atoi(argv[2]) : 1500;
+    const char* v_csvPath  = (argc > 3) ? argv[3] : "ledout.csv";
+
+    R310_ledOut_init(nullptr);
+
+    uint32_t v_renderSumUs = 0;
+    uint32_t v_startUs     = R310_ledOut_nowUs();
+    for (uint32_t v_f = 1; v_f <= v_frames; v_f++) {
+        uint32_t v_renderStartUs = R310_ledOut_nowUs();
+        R310_host_render(v_f, v_renderUs);
+        v_renderSumUs += R310_ledOut_nowUs() - v_renderStartUs;
+        R310_ledOut_present(g_host_back, 255);
+    }
+    R310_ledOut_waitIdle();
+    uint32_t v_wallUs = R310_ledOut_nowUs() - v_startUs;
+
+    FILE* v_csv = fopen(v_csvPath, "w");
+    if (v_csv == nullptr) {
+        fprintf(stderr, "cannot open %s\n", v_csvPath);
+        return 1;
+    }
+    R310_ledOut_hostDumpCsv(v_csv);
+    fclose(v_csv);
+
+    // 순차 실행(렌더링 + 동기 show)이었다면 걸렸을 시간과 비교한 겹침
+    uint32_t v_transferSumUs = 0;
+    for (const T_R310_LedOutRecord_t& v_rec : *g_R310_ledOut.records) v_transferSumUs += v_rec.endUs - v_rec.startUs;
+    uint32_t v_serialUs = v_renderSumUs + v_transferSumUs;
+    printf("frames %u, render %u us/frame, transfer %u us/frame\n", (unsigned)v_frames,
+           (unsigned)(v_renderSumUs / v_frames), (unsigned)(v_transferSumUs / v_frames));
+    printf("wall %u us, serial estimate %u us, overlapped %u us (%.1f%%)\n", (unsigned)v_wallUs, (unsigned)v_serialUs,
+           (unsigned)(v_serialUs > v_wallUs ? v_serialUs - v_wallUs : 0),
+           v_serialUs > v_wallUs ? 100.0 * (v_serialUs - v_wallUs) / v_serialUs : 0.0);
+    R310_ledOut_printStats();
+    printf("csv: %s\n", v_csvPath);
+    return 0;
+}
@@ -0,0 +1,124 @@
+// R310_host_serialMux.cpp - 시리얼 멀티플렉서 / 프레임 코덱 호스트 드라이버 (pty 루프백의 기기 쪽)
+// 펌웨어와 같은 A02_serialMux_001.h, A03_frameCodec_001.h, R310_link_001.h 를 호스트에서 빌드하고,
+// Serial(Stream)을 pty 에 연결해 R310_handleSerialLine / R310_handleLinkFrame 과 같은 형식 검사로 응답합니다.
+// 받은 줄/메시지는 표준 출력에 한 줄씩 기록하며, shared/R310_serialLink.py loopback 이 이 기록과 상태 보고로 결과를 확인합니다.
+// 빌드/실행: make -C test/host loopback
+// 사용법: R310_host_serialMux <pty 슬레이브 경로>
+
+#include "../../src/R310_RobotEyes_T31_008/R310_config_009.h"
+#include "../../src/R310_RobotEyes_T31_008/R310_data2_014.h"
+#include "../../src/R310_RobotEyes_T31_008/R310_fontGen_001.h"  // G_R310_ROBOT_EYES_FONT_LEN
+#include "../../src/R310_RobotEyes_T31_008/R310_link_001.h"
+#include "../../src/M010_CarState_001/A02_serialMux_001.h" // R310_link_001.h 뒤 (원격 표시 프레임 크기로 수신 버퍼를 맞춤)
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+
+#define G_R310_HOST_GLYPH_LEN   (G_R310_DISPLAY_HEIGHT * ((G_R310_EYE_COL_SIZE + 7) / 8)) // g_R310_hot.glyphs[0] 크기
+
+static_assert(G_A02_SERIALMUX_FRAME_MAX >= G_R310_LINK_FRAME_LEN + G_A03_FRAME_OVERHEAD, "시리얼 멀티플렉서 프레임 버퍼가 원격 표시 프레임보다 작습니다");
+
+CRGB            g_host_leds[G_R310_NEOPIXEL_NUM_LEDS];  // 원격 표시 프레임을 흩뿌릴 LED 구간
+T_R310_Remote_t g_host_remote;
+
+// 받은 줄 기록 (바이너리 줄은 CRC 자리에 쓴 종료 문자까지 확인하도록 길이 포함), 텍스트 줄은 기기처럼 에코
+void R310_host_handleLine(const char* p_line) {
+    if (A02_serialMux_isBinary()) {
+        printf("line binary %u %s\n", (unsigned)strlen(p_line), p_line);
+        return;
+    }
+    printf("line text %s\n", p_line);
+    Serial.print("Received command: ");
+    Serial.println(p_line);
+}
+
+// 상태 보고 (R310_sendTelemetry 와 같은 필드, 눈 상태는 원격 표시 통계만)
+void R310_host_sendTelemetry(uint8_t p_eyesIdx) {
+    const T_A02_SerialMux_t* v_mux = &g_A02_serialMux;
+    T_R310_Link_Telemetry_t  v_tm  = {};
+
+    v_tm.uptimeMs        = millis();
+    v_tm.eyesIdx         = p_eyesIdx;
+    v_tm.isRemote        = g_host_remote.isActive ? 1 : 0;
+    v_tm.brightness      = G_R310_BRIGHTNESS;
+    v_tm.framesSent      = g_host_remote.frames;
+    v_tm.remoteFrames    = g_host_remote.frames;
+    v_tm.rxBytes         = v_mux->bytes;
+    v_tm.rxFramesOk      = v_mux->framesOk;
+    v_tm.rxFramesBad     = v_mux->framesBad;
+    v_tm.rxSeqGaps       = v_mux->seqGaps;
+    v_tm.rxDropsOverlong = v_mux->dropsOverlong;
+    v_tm.linkErrors      = g_R310_link.errors;
+    A02_serialMux_sendFrame(LINK_MSG_TELEMETRY, (const uint8_t*)&v_tm, sizeof(v_tm));
+}
+
+// R310_handleLinkFrame 과 같은 형식 검사
+void R310_host_handleFrame(uint8_t p_type, const uint8_t* p_payload, uint16_t p_len) {
+    switch (p_type) {
+        case LINK_MSG_FRAME: {
+            if (p_len != G_R310_LINK_FRAME_LEN || p_payload[0] >= G_R310_EYES_COUNT) break;
+            uint16_t v_rowSums[2 * G_R310_DISPLAY_HEIGHT];
+            R310_link_scatterFrame(&p_payload[1], g_host_leds, v_rowSums);
+            g_host_remote.isActive      = true;
+            g_host_remote.lastFrameTime = millis();
+            g_host_remote.frames++;
+            printf("frame %u %04x\n", (unsigned)p_payload[0], (unsigned)A03_crc16(&p_payload[1], p_len - 1));
+            return;
+        }
+        case LINK_MSG_GLYPH: {
+            if (p_len != 1 + G_R310_HOST_GLYPH_LEN || p_payload[0] >= G_R310_ROBOT_EYES_FONT_LEN) break;
+            printf("glyph %u ", (unsigned)p_payload[0]);
+            for (uint16_t v_i = 1; v_i < p_len; v_i++) printf("%02x", (unsigned)p_payload[v_i]);
+            printf("\n");
+            return;
+        }
+        case LINK_MSG_TELEMETRY: {
+            uint8_t v_eyesIdx;
+            if (!R310_link_parseTelemetryReq(p_payload, p_len, G_R310_EYES_COUNT, &v_eyesIdx)) break;
+            R310_host_sendTelemetry(v_eyesIdx);
+            return;
+        }
+        default:
+            break;
+    }
+    g_R310_link.errors++;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: R310_host_serialMux <pty>\n");
+        return 2;
+    }
+    int v_fd = open(argv[1], O_RDWR | O_NOCTTY);
+    if (v_fd < 0) {
+        perror(argv[1]);
+        return 1;
+    }
+    struct termios v_tio;
+    tcgetattr(v_fd, &v_tio);
+    cfmakeraw(&v_tio);
+    tcsetattr(v_fd, TCSANOW, &v_tio);
+    setvbuf(stdout, nullptr, _IOLBF, 0); // 기록은 줄마다 내보냄 (루프백이 상태 보고와 함께 읽음)
+
+    Serial.fd = v_fd;
+    A02_serialMux_register("r310", nullptr, R310_host_handleLine, true);
+    A02_serialMux_registerFrames("r310", LINK_MSG_FIRST, LINK_MSG_LAST, R310_host_handleFrame);
+    printf("ready panel %u frameMax %u lineMax %u telemetry %u brightness %u\n", (unsigned)G_R310_PANEL_SIZE,
+           (unsigned)G_A02_SERIALMUX_FRAME_MAX, (unsigned)G_A02_SERIALMUX_LINE_MAX, (unsigned)sizeof(T_R310_Link_Telemetry_t),
+           (unsigned)G_R310_BRIGHTNESS);
+
+    while (true) {
+        struct pollfd v_pfd = {v_fd, POLLIN, 0};
+        if (poll(&v_pfd, 1, 1) < 0 || (v_pfd.revents & (POLLHUP | POLLERR))) break; // 호스트가 pty 를 닫음
+        A02_serialMux_poll();
+
+        if (g_host_remote.isActive && (millis() - g_host_remote.lastFrameTime) >= G_R310_REMOTE_TIMEOUT_MS) g_host_remote.isActive = false;
+        if (g_R310_link.telemetryPeriodMs != 0 && (int32_t)(millis() - g_R310_link.telemetryTime) >= 0) { // R310_run 의 주기 상태 보고
+            R310_host_sendTelemetry(g_R310_link.telemetryEyesIdx);
+            g_R310_link.telemetryTime += g_R310_link.telemetryPeriodMs;
+            if ((int32_t)(millis() - g_R310_link.telemetryTime) >= 0) g_R310_link.telemetryTime = millis() + g_R310_link.telemetryPeriodMs;
+        }
+    }
+    close(v_fd);
+    return 0;
+}
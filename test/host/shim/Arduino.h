@@ -0,0 +1,84 @@
+#pragma once
+
+// Arduino.h - 호스트 빌드용 최소 대체 헤더 (test/host 전용, 펌웨어 빌드에는 쓰이지 않음)
+// R310 벤치마크/출력 단계가 쓰는 시간 함수와 Serial 입출력만 표준 라이브러리로 흉내 냅니다.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include <thread>
+#include <unistd.h>
+#include <sys/ioctl.h>
+
+#define IRAM_ATTR
+#define DRAM_ATTR
+#define PROGMEM
+#define pgm_read_byte(p_addr)       (*(const uint8_t*)(p_addr))
+#define pgm_read_word(p_addr)       (*(const uint16_t*)(p_addr))
+#define memcpy_P                    memcpy
+#define constrain(p_x, p_lo, p_hi)  ((p_x) < (p_lo) ? (p_lo) : ((p_x) > (p_hi) ? (p_hi) : (p_x)))
+
+uint32_t micros() {
+    static const std::chrono::steady_clock::time_point v_epoch = std::chrono::steady_clock::now();
+    return (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - v_epoch).count();
+}
+
+uint32_t millis() {
+    return micros() / 1000;
+}
+
+void delay(uint32_t p_ms) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(p_ms));
+}
+
+// A02_serialMux_001.h 가 쓰는 Stream 읽기/쓰기 부분
+struct Stream {
+    virtual ~Stream() = default;
+    virtual int    available() = 0;
+    virtual size_t readBytes(char* p_buf, size_t p_len) = 0;
+    virtual size_t write(const uint8_t* p_buf, size_t p_len) = 0;
+    virtual int    availableForWrite() = 0;
+};
+
+// 표준 출력으로 보내는 Serial (fd 를 지정하면 그 파일 기술자로 읽고 씀, 예: R310_host_serialMux 의 pty)
+struct T_HostSerial_t : Stream {
+    int fd = -1;
+
+    void begin(unsigned long) {}
+    int available() override {
+        int v_n = 0;
+        return (fd >= 0 && ioctl(fd, FIONREAD, &v_n) == 0) ? v_n : 0;
+    }
+    size_t readBytes(char* p_buf, size_t p_len) override {
+        ssize_t v_n = (fd >= 0) ? ::read(fd, p_buf, p_len) : 0;
+        return (v_n > 0) ? (size_t)v_n : 0;
+    }
+    size_t write(const uint8_t* p_buf, size_t p_len) override {
+        if (fd < 0) return fwrite(p_buf, 1, p_len, stdout);
+        size_t v_done = 0;
+        while (v_done < p_len) {
+            ssize_t v_n = ::write(fd, p_buf + v_done, p_len - v_done);
+            if (v_n <= 0) break;
+            v_done += (size_t)v_n;
+        }
+        return v_done;
+    }
+    int availableForWrite() override { return 4096; } // 호스트 write 는 다 쓸 때까지 기다림
+    int printf(const char* p_fmt, ...) {
+        va_list v_args;
+        va_start(v_args, p_fmt);
+        int v_len = (fd < 0) ? vprintf(p_fmt, v_args) : vdprintf(fd, p_fmt, v_args);
+        va_end(v_args);
+        return v_len;
+    }
+    void print(const char* p_str)   { printf("%s", p_str); }
+    void print(long p_val)          { printf("%ld", p_val); }
+    void println(const char* p_str) { printf("%s\n", p_str); }
+    void println(long p_val)        { printf("%ld\n", p_val); }
+    void println()                  { printf("\n"); }
+};
+
+T_HostSerial_t Serial;
@@ -0,0 +1,38 @@
+#pragma once
+
+// FastLED.h - 호스트 빌드용 최소 대체 헤더 (test/host 전용, 펌웨어 빌드에는 쓰이지 않음)
+// CRGB 와 컨트롤러 등록/show() 호출만 받아 두고 실제 전송은 하지 않습니다.
+// (호스트 전송 시간 흉내와 기록은 R310_ledOutput_001.h 의 호스트 백엔드가 담당)
+
+#include <stdint.h>
+
+typedef uint8_t fract8;
+
+struct CRGB {
+    uint8_t r, g, b;
+    enum : uint32_t { Black = 0x000000, White = 0xFFFFFF, Red = 0xFF0000, Green = 0x00FF00, Blue = 0x0000FF };
+    CRGB() = default;
+    constexpr CRGB(uint8_t p_r, uint8_t p_g, uint8_t p_b) : r(p_r), g(p_g), b(p_b) {}
+    constexpr CRGB(uint32_t p_rgb) : r((uint8_t)(p_rgb >> 16)), g((uint8_t)(p_rgb >> 8)), b((uint8_t)p_rgb) {}
+    bool operator==(const CRGB& p_o) const { return r == p_o.r && g == p_o.g && b == p_o.b; }
+    bool operator!=(const CRGB& p_o) const { return !(*this == p_o); }
+};
+
+enum { WS2812B };
+enum { GRB };
+enum { TypicalLEDStrip = 0xFFB0F0 };
+
+struct T_HostLedController_t {
+    T_HostLedController_t& setCorrection(uint32_t) { return *this; }
+};
+
+struct T_HostFastLED_t {
+    T_HostLedController_t controller;
+    template <int CHIPSET, int PIN, int ORDER>
+    T_HostLedController_t& addLeds(CRGB*, int) { return controller; }
+    void show(uint8_t) {}
+    void show() {}
+    void setBrightness(uint8_t) {}
+};
+
+T_HostFastLED_t FastLED;